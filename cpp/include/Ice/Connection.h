@@ -408,6 +408,75 @@ namespace Ice
         }
     };
 
+    /**
+     * Provides access to the connection details of a Unix domain socket connection
+     * \headerfile Ice/Ice.h
+     */
+    class ICE_API UnixConnectionInfo final : public ConnectionInfo
+    {
+    public:
+        ~UnixConnectionInfo() final;
+        UnixConnectionInfo(const UnixConnectionInfo&) = delete;
+        UnixConnectionInfo& operator=(const UnixConnectionInfo&) = delete;
+
+        /**
+         * The path of the socket file.
+         */
+        const std::string path;
+
+        /**
+         * The process ID of the peer, or -1 if not available.
+         */
+        const int peerPid;
+
+        /**
+         * The effective user ID of the peer, or -1 if not available.
+         */
+        const int peerUid;
+
+        /**
+         * The effective group ID of the peer, or -1 if not available.
+         */
+        const int peerGid;
+
+        /**
+         * The connection buffer receive size.
+         */
+        const int rcvSize;
+
+        /**
+         * The connection buffer send size.
+         */
+        const int sndSize;
+
+        // internal constructor
+        UnixConnectionInfo(
+            bool incoming,
+            std::string adapterName,
+            std::string connectionId,
+            std::string path,
+            int peerPid,
+            int peerUid,
+            int peerGid,
+            int rcvSize,
+            int sndSize)
+            : ConnectionInfo{incoming, std::move(adapterName), std::move(connectionId)},
+              path{std::move(path)},
+              peerPid{peerPid},
+              peerUid{peerUid},
+              peerGid{peerGid},
+              rcvSize{rcvSize},
+              sndSize{sndSize}
+        {
+        }
+
+        // internal constructor
+        UnixConnectionInfo(bool incoming, std::string adapterName, std::string connectionId, std::string path)
+            : UnixConnectionInfo{incoming, std::move(adapterName), std::move(connectionId), std::move(path), -1, -1, -1, 0, 0}
+        {
+        }
+    };
+
     /**
      * Provides access to the connection details of a WebSocket connection
      * \headerfile Ice/Ice.h
@@ -12,6 +12,7 @@ namespace Ice
     class IPConnectionInfo;
     class TCPConnectionInfo;
     class UDPConnectionInfo;
+    class UnixConnectionInfo;
     class WSConnectionInfo;
 
     using ConnectionPtr = std::shared_ptr<Connection>;
@@ -19,6 +20,7 @@ namespace Ice
     using IPConnectionInfoPtr = std::shared_ptr<IPConnectionInfo>;
     using TCPConnectionInfoPtr = std::shared_ptr<TCPConnectionInfo>;
     using UDPConnectionInfoPtr = std::shared_ptr<UDPConnectionInfo>;
+    using UnixConnectionInfoPtr = std::shared_ptr<UnixConnectionInfo>;
     using WSConnectionInfoPtr = std::shared_ptr<WSConnectionInfo>;
 }
 
@@ -0,0 +1,146 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_COROUTINE_H
+#define ICE_COROUTINE_H
+
+#include "Config.h"
+
+// The coroutine mapping of the proxy operations requires C++20 coroutines.
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#    if __has_include(<coroutine>)
+#        define ICE_HAS_COROUTINES
+#    endif
+#endif
+
+#ifdef ICE_HAS_COROUTINES
+
+#    include <atomic>
+#    include <cassert>
+#    include <coroutine>
+#    include <exception>
+#    include <memory>
+#    include <optional>
+#    include <type_traits>
+
+namespace IceInternal
+{
+    // The completion of an invocation awaited by a coroutine. It holds the result of the invocation and the handle of
+    // the coroutine to resume once the invocation completes. The coroutine outgoing async derives from this class, so
+    // awaiting an invocation doesn't allocate anything besides the outgoing async.
+    template<typename R> class CoroutineCompletion
+    {
+    public:
+        CoroutineCompletion(const CoroutineCompletion&) = delete;
+        CoroutineCompletion& operator=(const CoroutineCompletion&) = delete;
+
+        [[nodiscard]] bool isCompleted() const noexcept
+        {
+            return _continuation.load(std::memory_order_acquire) == completedTag();
+        }
+
+        // Registers the coroutine to resume once the invocation completes. Returns false if the invocation completed
+        // in the meantime, in which case the coroutine must not be suspended.
+        bool setContinuation(std::coroutine_handle<> continuation) noexcept
+        {
+            void* expected = nullptr;
+            return _continuation.compare_exchange_strong(
+                expected,
+                continuation.address(),
+                std::memory_order_acq_rel);
+        }
+
+        // Returns the result of the invocation, or throws the exception raised by the invocation.
+        R takeResult()
+        {
+            assert(isCompleted());
+            if (_exception)
+            {
+                std::rethrow_exception(_exception);
+            }
+            if constexpr (!std::is_void_v<R>)
+            {
+                assert(_result);
+                return std::move(*_result);
+            }
+        }
+
+    protected:
+        CoroutineCompletion() = default;
+        ~CoroutineCompletion() = default;
+
+        // Marks the invocation as completed and resumes the awaiting coroutine, if any. The result or the exception
+        // must be set before calling this function.
+        void complete() const
+        {
+            void* continuation = _continuation.exchange(completedTag(), std::memory_order_acq_rel);
+            if (continuation && continuation != completedTag())
+            {
+                std::coroutine_handle<>::from_address(continuation).resume();
+            }
+        }
+
+        struct Empty
+        {
+        };
+
+        std::optional<std::conditional_t<std::is_void_v<R>, Empty, R>> _result;
+        std::exception_ptr _exception;
+
+    private:
+        // The address of this object is never the address of a coroutine frame.
+        [[nodiscard]] void* completedTag() const noexcept { return const_cast<CoroutineCompletion*>(this); }
+
+        // nullptr, the address of the frame of the awaiting coroutine, or completedTag().
+        mutable std::atomic<void*> _continuation{nullptr};
+    };
+}
+
+namespace Ice
+{
+    /**
+     * The awaitable returned by the coroutine mapping of the operations of the generated proxies, such as
+     * `co_await proxy->opCoro()`. The invocation is sent when the awaitable is created. The awaiting coroutine is
+     * resumed by the Ice thread that completes the invocation, or isn't suspended at all if the invocation is already
+     * completed. `co_await` returns the result of the invocation, or throws the exception raised by the invocation.
+     * \headerfile Ice/Ice.h
+     */
+    template<typename R> class [[nodiscard]] InvocationAwaitable
+    {
+    public:
+        /// \cond INTERNAL
+        explicit InvocationAwaitable(std::shared_ptr<IceInternal::CoroutineCompletion<R>> completion) noexcept
+            : _completion(std::move(completion))
+        {
+        }
+        /// \endcond
+
+        /**
+         * Checks whether the invocation is completed.
+         * @return True if the invocation is completed, false otherwise.
+         */
+        [[nodiscard]] bool await_ready() const noexcept { return _completion->isCompleted(); }
+
+        /**
+         * Suspends the awaiting coroutine until the invocation completes.
+         * @param continuation The awaiting coroutine.
+         * @return False if the invocation completed in the meantime and the coroutine must not be suspended.
+         */
+        bool await_suspend(std::coroutine_handle<> continuation) noexcept
+        {
+            return _completion->setContinuation(continuation);
+        }
+
+        /**
+         * Gets the result of the invocation.
+         * @return The result of the invocation.
+         */
+        R await_resume() { return _completion->takeResult(); }
+
+    private:
+        std::shared_ptr<IceInternal::CoroutineCompletion<R>> _completion;
+    };
+}
+
+#endif
+
+#endif
@@ -0,0 +1,64 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_DIRECT_CALL_H
+#define ICE_DIRECT_CALL_H
+
+#include "Current.h"
+#include "Object.h"
+#include "Proxy.h"
+
+#include <exception>
+#include <memory>
+#include <string_view>
+
+namespace Ice
+{
+    class ObjectAdapterI;
+}
+
+namespace IceInternal
+{
+    class LoggerMiddleware;
+
+    // Helps the generated code of the operations with the cpp:direct-call metadata call a collocated servant directly,
+    // without marshaling the arguments and the results of the invocation. An invocation is dispatched directly when:
+    // - the proxy is a twoway proxy with collocation optimization, and no invocation timeout;
+    // - the target object adapter is in the same communicator and has no middleware other than the logger middleware
+    // (see Ice.Warn.Dispatch), and the communicator has no executor and no observer;
+    // - the target servant is an active servant or a default servant of the generated servant class.
+    // Otherwise, the invocation is marshaled and sent through the regular request handler.
+    class ICE_API DirectCall final
+    {
+    public:
+        DirectCall(
+            const Ice::ObjectPrx& proxy,
+            std::string_view operation,
+            Ice::OperationMode mode,
+            const Ice::Context& context) noexcept;
+        ~DirectCall();
+
+        DirectCall(const DirectCall&) = delete;
+        DirectCall& operator=(const DirectCall&) = delete;
+
+        // Returns the servant if the invocation can be dispatched directly to a servant of type T, nullptr otherwise.
+        template<typename T> [[nodiscard]] std::shared_ptr<T> servant() const noexcept
+        {
+            return std::dynamic_pointer_cast<T>(_servant);
+        }
+
+        // The current object of the direct dispatch.
+        [[nodiscard]] const Ice::Current& current() const noexcept { return _current; }
+
+        // Throws the exception an invocation of the same servant through the marshaled path would throw, for an
+        // exception raised by the servant which is not a user exception declared by the operation.
+        [[noreturn]] void rethrow(std::exception_ptr ex) const;
+
+    private:
+        std::shared_ptr<Ice::ObjectAdapterI> _adapter;
+        std::shared_ptr<LoggerMiddleware> _loggerMiddleware;
+        Ice::ObjectPtr _servant;
+        Ice::Current _current;
+    };
+}
+
+#endif
@@ -211,6 +211,37 @@ namespace Ice
         }
     };
 
+    /**
+     * Provides access to a Unix domain socket endpoint information.
+     * @see Endpoint
+     * \headerfile Ice/Ice.h
+     */
+    class ICE_API UnixEndpointInfo final : public EndpointInfo
+    {
+    public:
+        ~UnixEndpointInfo() final;
+        UnixEndpointInfo(const UnixEndpointInfo&) = delete;
+        UnixEndpointInfo& operator=(const UnixEndpointInfo&) = delete;
+
+        /**
+         * The path of the socket file.
+         */
+        const std::string path;
+
+        [[nodiscard]] std::int16_t type() const noexcept final { return _type; }
+
+        // internal constructor
+        UnixEndpointInfo(int timeout, bool compress, std::string path, std::int16_t type)
+            : EndpointInfo{timeout, compress},
+              path{std::move(path)},
+              _type{type}
+        {
+        }
+
+    private:
+        const std::int16_t _type;
+    };
+
     /**
      * Provides access to a WebSocket endpoint information.
      * \headerfile Ice/Ice.h
@@ -14,6 +14,7 @@ namespace Ice
     class OpaqueEndpointInfo;
     class TCPEndpointInfo;
     class UDPEndpointInfo;
+    class UnixEndpointInfo;
     class WSEndpointInfo;
 
     using EndpointPtr = std::shared_ptr<Endpoint>;
@@ -22,6 +23,7 @@ namespace Ice
     using OpaqueEndpointInfoPtr = std::shared_ptr<OpaqueEndpointInfo>;
     using TCPEndpointInfoPtr = std::shared_ptr<TCPEndpointInfo>;
     using UDPEndpointInfoPtr = std::shared_ptr<UDPEndpointInfo>;
+    using UnixEndpointInfoPtr = std::shared_ptr<UnixEndpointInfo>;
     using WSEndpointInfoPtr = std::shared_ptr<WSEndpointInfo>;
 
     /**
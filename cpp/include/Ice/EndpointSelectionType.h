@@ -19,7 +19,13 @@ namespace Ice
         /**
          * <code>Ordered</code> forces the Ice run time to use the endpoints in the order they appeared in the proxy.
          */
-        Ordered
+        Ordered,
+        /**
+         * <code>Latency</code> causes the endpoints to be arranged from the fastest to the slowest, based on the
+         * latency of the previous connection establishments and invocations. The endpoints which weren't used for a
+         * while are tried first, to measure their latency again.
+         */
+        Latency
     };
 }
 
@@ -31,7 +31,8 @@ namespace Ice
          * @param requestCount The number of requests remaining in the InputStream. This value is always 1 for
          * non-batched requests. For batch requests, it is the number of requests remaining in the InputStream.
          * @remarks This constructor reads the request header from inputStream. When it completes, the input stream is
-         * positioned at the beginning of encapsulation carried by the request.
+         * positioned at the beginning of encapsulation carried by the request. The strings and the context entries of
+         * the current object reuse the memory of the previous request dispatched by the calling thread, if any.
          */
         IncomingRequest(
             int32_t requestId,
@@ -40,6 +41,12 @@ namespace Ice
             InputStream& inputStream,
             std::int32_t requestCount);
 
+        /**
+         * Destroys this IncomingRequest object. The memory of the current object is kept for the next request
+         * dispatched by the calling thread.
+         */
+        ~IncomingRequest();
+
         IncomingRequest(const IncomingRequest&) = delete;
         IncomingRequest(IncomingRequest&&) noexcept = delete;
         IncomingRequest& operator=(const IncomingRequest&) = delete;
@@ -81,6 +88,7 @@ namespace Ice
         Current _current;
         std::int32_t _requestSize;
         std::int32_t _requestCount;
+        bool _recycled{false};
     };
 }
 
@@ -526,20 +526,11 @@ namespace IceInternal
 
         template<class MetricsType> void registerMap(const std::string& map, IceMX::Updater* updater)
         {
-            bool updated;
-            MetricsMapFactoryPtr factory;
-            {
-                std::lock_guard lock(_mutex);
-                factory = std::make_shared<MetricsMapFactoryT<MetricsType>>(updater);
-                _factories[map] = factory;
-                updated = addOrUpdateMap(map, factory);
-            }
-            if (updated)
-            {
-                factory->update();
-            }
+            registerMap(map, std::make_shared<MetricsMapFactoryT<MetricsType>>(updater));
         }
 
+        void registerMap(const std::string&, const MetricsMapFactoryPtr&);
+
         template<class MemberMetricsType, class MetricsType>
         void registerSubMap(const std::string& map, const std::string& subMap, IceMX::MetricsMap MetricsType::* member)
         {
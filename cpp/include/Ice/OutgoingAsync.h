@@ -16,7 +16,11 @@
 #include "RequestHandlerF.h"
 
 #include <cassert>
+#include <chrono>
+#include <cstddef>
 #include <exception>
+#include <memory>
+#include <optional>
 #include <string_view>
 
 #if defined(__clang__)
@@ -233,10 +237,41 @@ namespace IceInternal
         const Ice::EncodingVersion _encoding;
         std::function<void(const Ice::UserException&)> _userException;
         bool _synchronous;
+
+        // The time at which the request was sent over a connection, with the Latency endpoint selection type.
+        std::optional<std::chrono::steady_clock::time_point> _invokeRemoteTime;
     };
 
     using OutgoingAsyncPtr = std::shared_ptr<OutgoingAsync>;
 
+    // Allocates and releases the memory of the outgoing asyncs created by makePromiseOutgoing, makeLambdaOutgoing and
+    // makeCoroutineOutgoing. With Ice.BufferPool, this memory is recycled by the buffer pool, like the memory of the
+    // streams of the outgoing asyncs.
+    ICE_API void* allocateOutgoingAsync(std::size_t size);
+    ICE_API void releaseOutgoingAsync(void* p, std::size_t size) noexcept;
+
+    template<typename T> class OutgoingAsyncAllocator
+    {
+    public:
+        using value_type = T;
+
+        OutgoingAsyncAllocator() noexcept = default;
+
+        template<typename U> OutgoingAsyncAllocator(const OutgoingAsyncAllocator<U>&) noexcept {}
+
+        [[nodiscard]] T* allocate(std::size_t n)
+        {
+            static_assert(alignof(T) <= alignof(std::max_align_t));
+            return static_cast<T*>(allocateOutgoingAsync(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept { releaseOutgoingAsync(p, n * sizeof(T)); }
+
+        template<typename U> bool operator==(const OutgoingAsyncAllocator<U>&) const noexcept { return true; }
+
+        template<typename U> bool operator!=(const OutgoingAsyncAllocator<U>&) const noexcept { return false; }
+    };
+
     class ICE_API LambdaInvoke : public virtual OutgoingAsyncCompletionCallback
     {
     public:
@@ -286,7 +321,8 @@ namespace IceInternal
 
         void handleInvokeResponse(bool, OutgoingAsyncBase*) const final { assert(false); }
 
-        std::promise<R> _promise;
+        // The shared state of the promise is allocated like the outgoing async.
+        std::promise<R> _promise{std::allocator_arg, OutgoingAsyncAllocator<std::byte>()};
         std::function<void(bool)> _response;
     };
 
@@ -358,15 +394,17 @@ namespace IceInternal
             std::function<void(std::exception_ptr)> ex,
             std::function<void(bool)> sent)
             : OutgoingAsyncT<R>(std::move(proxy), false),
-              LambdaInvoke(std::move(ex), std::move(sent))
+              LambdaInvoke(std::move(ex), std::move(sent)),
+              _responseCallback(std::move(response))
         {
-            _response = [this, response = std::move(response)](bool ok)
+            // Only captures this, so that _response doesn't allocate.
+            _response = [this](bool ok)
             {
                 if (!ok)
                 {
                     this->throwUserException();
                 }
-                else if (response)
+                else if (_responseCallback)
                 {
                     assert(this->_read);
                     this->_is.startEncapsulation();
@@ -374,7 +412,7 @@ namespace IceInternal
                     this->_is.endEncapsulation();
                     try
                     {
-                        response(std::move(v));
+                        _responseCallback(std::move(v));
                     }
                     catch (...)
                     {
@@ -383,6 +421,9 @@ namespace IceInternal
                 }
             };
         }
+
+    private:
+        std::function<void(R)> _responseCallback;
     };
 
     template<> class LambdaOutgoing<void> : public OutgoingAsyncT<void>, public LambdaInvoke
@@ -394,15 +435,17 @@ namespace IceInternal
             std::function<void(std::exception_ptr)> ex,
             std::function<void(bool)> sent)
             : OutgoingAsyncT<void>(std::move(proxy), false),
-              LambdaInvoke(std::move(ex), std::move(sent))
+              LambdaInvoke(std::move(ex), std::move(sent)),
+              _responseCallback(std::move(response))
         {
-            _response = [this, response = std::move(response)](bool ok)
+            // Only captures this, so that _response doesn't allocate.
+            _response = [this](bool ok)
             {
                 if (!ok)
                 {
                     this->throwUserException();
                 }
-                else if (response)
+                else if (_responseCallback)
                 {
                     if (!this->_is.b.empty())
                     {
@@ -410,7 +453,7 @@ namespace IceInternal
                     }
                     try
                     {
-                        response();
+                        _responseCallback();
                     }
                     catch (...)
                     {
@@ -419,6 +462,9 @@ namespace IceInternal
                 }
             };
         }
+
+    private:
+        std::function<void()> _responseCallback;
     };
 
     template<typename R> class PromiseOutgoing : public OutgoingAsyncT<R>, public PromiseInvoke<R>
@@ -482,10 +528,93 @@ namespace IceInternal
         }
     };
 
+#ifdef ICE_HAS_COROUTINES
+    // The outgoing async of the invocations awaited by coroutines. The response is unmarshaled while the outgoing
+    // async is locked, like with the promise-based API, and the awaiting coroutine is resumed by handleInvokeXxx,
+    // outside the lock, from the thread that completes the invocation.
+    template<typename R> class CoroutineOutgoing final : public OutgoingAsyncT<R>, public CoroutineCompletion<R>
+    {
+    public:
+        CoroutineOutgoing(Ice::ObjectPrx proxy) : OutgoingAsyncT<R>(std::move(proxy), false) {}
+
+    protected:
+        bool handleSent(bool done, bool) noexcept final
+        {
+            // Oneway invocations of operations without results complete once sent.
+            if constexpr (std::is_void_v<R>)
+            {
+                if (done)
+                {
+                    this->_result.emplace();
+                }
+                return done;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        bool handleException(std::exception_ptr ex) noexcept final
+        {
+            this->_exception = ex;
+            return true;
+        }
+
+        bool handleResponse(bool ok) final
+        {
+            if constexpr (std::is_void_v<R>)
+            {
+                if (this->_is.b.empty())
+                {
+                    // No response to read with oneway and batch oneway proxies.
+                    this->_result.emplace();
+                    return true;
+                }
+            }
+
+            if (!ok)
+            {
+                this->throwUserException();
+            }
+
+            if constexpr (std::is_void_v<R>)
+            {
+                this->_is.skipEmptyEncapsulation();
+                this->_result.emplace();
+            }
+            else
+            {
+                assert(this->_read);
+                this->_is.startEncapsulation();
+                this->_result = this->_read(&this->_is);
+                this->_is.endEncapsulation();
+            }
+            return true;
+        }
+
+        void handleInvokeSent(bool, OutgoingAsyncBase*) const final { this->complete(); }
+
+        void handleInvokeException(std::exception_ptr, OutgoingAsyncBase*) const final { this->complete(); }
+
+        void handleInvokeResponse(bool, OutgoingAsyncBase*) const final { this->complete(); }
+    };
+
+    template<typename R, typename Obj, typename Fn, typename... Args>
+    [[nodiscard]] inline Ice::InvocationAwaitable<R> makeCoroutineOutgoing(Obj obj, Fn fn, Args&&... args)
+    {
+        auto outAsync =
+            std::allocate_shared<CoroutineOutgoing<R>>(OutgoingAsyncAllocator<CoroutineOutgoing<R>>(), *obj);
+        (obj->*fn)(outAsync, std::forward<Args>(args)...);
+        return Ice::InvocationAwaitable<R>{std::move(outAsync)};
+    }
+#endif
+
     template<typename R, typename Obj, typename Fn, typename... Args>
     [[nodiscard]] inline std::future<R> makePromiseOutgoing(bool sync, Obj obj, Fn fn, Args&&... args)
     {
-        auto outAsync = std::make_shared<PromiseOutgoing<R>>(*obj, sync);
+        auto outAsync =
+            std::allocate_shared<PromiseOutgoing<R>>(OutgoingAsyncAllocator<PromiseOutgoing<R>>(), *obj, sync);
         (obj->*fn)(outAsync, std::forward<Args>(args)...);
         return outAsync->getFuture();
     }
@@ -493,7 +622,12 @@ namespace IceInternal
     template<typename R, typename Re, typename E, typename S, typename Obj, typename Fn, typename... Args>
     [[nodiscard]] inline std::function<void()> makeLambdaOutgoing(Re r, E e, S s, Obj obj, Fn fn, Args&&... args)
     {
-        auto outAsync = std::make_shared<LambdaOutgoing<R>>(*obj, std::move(r), std::move(e), std::move(s));
+        auto outAsync = std::allocate_shared<LambdaOutgoing<R>>(
+            OutgoingAsyncAllocator<LambdaOutgoing<R>>(),
+            *obj,
+            std::move(r),
+            std::move(e),
+            std::move(s));
         (obj->*fn)(outAsync, std::forward<Args>(args)...);
         return [outAsync]() { outAsync->cancel(); };
     }
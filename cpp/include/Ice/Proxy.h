@@ -5,6 +5,7 @@
 
 #include "BatchRequestQueueF.h"
 #include "CommunicatorF.h"
+#include "Coroutine.h"
 #include "Current.h"
 #include "EndpointF.h"
 #include "EndpointSelectionType.h"
@@ -70,6 +71,20 @@ namespace Ice
             return fromReference(asPrx()._adapterId(std::move(id)));
         }
 
+        /**
+         * Obtains a proxy that is identical to this proxy, except for the batch auto-flush interval. A batch that is
+         * not empty is flushed at the latest after this interval, which overrides Ice.BatchAutoFlushInterval for the
+         * requests queued with this proxy.
+         * @param interval The new batch auto-flush interval. A zero interval disables time-based auto-flush.
+         * @return A proxy with the new batch auto-flush interval.
+         */
+        template<class Rep, class Period>
+        [[nodiscard]] Prx ice_batchAutoFlushInterval(const std::chrono::duration<Rep, Period>& interval) const
+        {
+            return fromReference(
+                asPrx()._batchAutoFlushInterval(std::chrono::duration_cast<std::chrono::microseconds>(interval)));
+        }
+
         /**
          * Obtains a proxy that is identical to this proxy, but uses batch datagram invocations.
          * @return A proxy that uses batch datagram invocations.
@@ -107,6 +122,18 @@ namespace Ice
          */
         [[nodiscard]] Prx ice_connectionCached(bool b) const { return fromReference(asPrx()._connectionCached(b)); }
 
+        /**
+         * Obtains a proxy that is identical to this proxy, except for the size of its connection pool. A proxy that
+         * caches connections with a pool size greater than 1 establishes this number of connections, and sends each
+         * invocation over the connection with the fewest outstanding requests.
+         * @param size The connection pool size, which must be at least 1.
+         * @return A proxy with the specified connection pool size.
+         */
+        [[nodiscard]] Prx ice_connectionPoolSize(int size) const
+        {
+            return fromReference(asPrx()._connectionPoolSize(size));
+        }
+
         /**
          * Obtains a proxy that is identical to this proxy, except for its connection ID.
          * @param id The connection ID for the new proxy. An empty string removes the
@@ -684,7 +711,13 @@ namespace Ice
         [[nodiscard]] bool ice_isConnectionCached() const noexcept;
 
         /**
-         * Obtains the endpoint selection policy for this proxy (randomly or ordered).
+         * Obtains the size of the connection pool of this proxy.
+         * @return The connection pool size.
+         */
+        [[nodiscard]] int ice_getConnectionPoolSize() const noexcept;
+
+        /**
+         * Obtains the endpoint selection policy for this proxy (randomly, ordered or by latency).
          * @return The endpoint selection policy.
          */
         [[nodiscard]] Ice::EndpointSelectionType ice_getEndpointSelection() const noexcept;
@@ -733,6 +766,12 @@ namespace Ice
          */
         [[nodiscard]] std::chrono::milliseconds ice_getInvocationTimeout() const noexcept;
 
+        /**
+         * Obtains the batch auto-flush interval of this proxy.
+         * @return The batch auto-flush interval, zero if batches are not flushed after an interval.
+         */
+        [[nodiscard]] std::chrono::microseconds ice_getBatchAutoFlushInterval() const noexcept;
+
         /**
          * Determines whether this proxy uses twoway invocations.
          * @return True if this proxy uses twoway invocations, false otherwise.
@@ -832,12 +871,14 @@ namespace Ice
 
         // Gets a reference with the specified setting; returns _reference if the setting is already set.
         [[nodiscard]] IceInternal::ReferencePtr _adapterId(std::string) const;
+        [[nodiscard]] IceInternal::ReferencePtr _batchAutoFlushInterval(std::chrono::microseconds) const;
         [[nodiscard]] IceInternal::ReferencePtr _batchDatagram() const;
         [[nodiscard]] IceInternal::ReferencePtr _batchOneway() const;
         [[nodiscard]] IceInternal::ReferencePtr _collocationOptimized(bool) const;
         [[nodiscard]] IceInternal::ReferencePtr _compress(bool) const;
         [[nodiscard]] IceInternal::ReferencePtr _connectionCached(bool) const;
         [[nodiscard]] IceInternal::ReferencePtr _connectionId(std::string) const;
+        [[nodiscard]] IceInternal::ReferencePtr _connectionPoolSize(int) const;
         [[nodiscard]] IceInternal::ReferencePtr _context(Context) const;
         [[nodiscard]] IceInternal::ReferencePtr _datagram() const;
         [[nodiscard]] IceInternal::ReferencePtr _encodingVersion(EncodingVersion) const;
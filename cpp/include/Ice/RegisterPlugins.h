@@ -40,6 +40,17 @@ namespace Ice
      * plug-in property is set to 1.
      */
     ICE_PLUGIN_REGISTER_DECLSPEC_IMPORT void registerIceWS(bool loadOnInitialize = true);
+
+#    if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+    /**
+     * When using static libraries, calling this function ensures the Unix domain socket and shared-memory
+     * transports are linked with the application.
+     * @param loadOnInitialize If true, the plug-in is loaded (created) during communicator initialization.
+     * If false, the plug-in is only loaded during communicator initialization if its corresponding
+     * plug-in property is set to 1.
+     */
+    ICE_PLUGIN_REGISTER_DECLSPEC_IMPORT void registerIceUnix(bool loadOnInitialize = true);
+#    endif
 #endif
 
 #ifndef ICE_DISCOVERY_API_EXPORTS
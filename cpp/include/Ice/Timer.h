@@ -10,6 +10,7 @@
 #include <condition_variable>
 #include <functional>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <set>
@@ -51,13 +52,21 @@ namespace IceInternal
 #    pragma clang diagnostic pop
 #endif
 
+    class TimingWheel;
+
     // The timer class is used to schedule tasks for one-time execution or repeated execution. Tasks are executed by a
     // dedicated timer thread sequentially.
     class ICE_API Timer
     {
     public:
         Timer();
-        virtual ~Timer() = default;
+
+        // Creates a timer which stores its tasks in a hierarchical timing wheel with the given tick instead of an
+        // ordered set. Scheduling and cancelling a task is O(1) but tasks run up to one tick late. A zero tick
+        // selects the ordered set.
+        explicit Timer(std::chrono::nanoseconds wheelTick);
+
+        virtual ~Timer();
 
         // Destroy the timer and join the timer execution thread. Must not be called from a timer task.
         void destroy();
@@ -91,17 +100,7 @@ namespace IceInternal
                 throw std::invalid_argument("delay too large, resulting in overflow");
             }
 
-            bool inserted = _tasks.insert(make_pair(task, time)).second;
-            if (!inserted)
-            {
-                throw std::invalid_argument("task is already scheduled");
-            }
-            _tokens.insert({time, std::nullopt, task});
-
-            if (_wakeUpTime == std::chrono::steady_clock::time_point() || time < _wakeUpTime)
-            {
-                _condition.notify_one();
-            }
+            insertNoSync(task, time, std::nullopt);
         }
 
         // Reschedule a task for execution after a given delay. This function also succeeds if the task was not
@@ -128,14 +127,7 @@ namespace IceInternal
             }
 
             cancelNoSync(task);
-
-            _tasks.insert(make_pair(task, time));
-            _tokens.insert({time, std::nullopt, task});
-
-            if (_wakeUpTime == std::chrono::steady_clock::time_point() || time < _wakeUpTime)
-            {
-                _condition.notify_one();
-            }
+            insertNoSync(task, time, std::nullopt);
         }
 
         // Schedule a task for repeated execution with the given delay between each execution.
@@ -160,17 +152,7 @@ namespace IceInternal
                 throw std::invalid_argument("delay too large, resulting in overflow");
             }
 
-            bool inserted = _tasks.insert(make_pair(task, time)).second;
-            if (!inserted)
-            {
-                throw std::invalid_argument("task is already scheduled");
-            }
-            _tokens.insert({time, std::chrono::duration_cast<std::chrono::nanoseconds>(delay), task});
-
-            if (_wakeUpTime == std::chrono::steady_clock::time_point() || time < _wakeUpTime)
-            {
-                _condition.notify_one();
-            }
+            insertNoSync(task, time, std::chrono::duration_cast<std::chrono::nanoseconds>(delay));
         }
 
         //
@@ -208,12 +190,19 @@ namespace IceInternal
         };
 
         void run();
+        void insertNoSync(
+            const TimerTaskPtr& task,
+            std::chrono::steady_clock::time_point time,
+            std::optional<std::chrono::nanoseconds> delay);
+        [[nodiscard]] bool emptyNoSync() const;
+        bool popNoSync(Token& token, std::chrono::steady_clock::time_point now);
         bool cancelNoSync(const TimerTaskPtr& task);
 
         std::mutex _mutex;
         std::condition_variable _condition;
         std::set<Token> _tokens;
         std::map<TimerTaskPtr, std::chrono::steady_clock::time_point> _tasks;
+        std::unique_ptr<TimingWheel> _wheel; // Replaces _tokens and _tasks when set.
         bool _destroyed{false};
         std::chrono::steady_clock::time_point _wakeUpTime;
         std::thread _worker;
@@ -23,6 +23,11 @@ namespace IceInternal
         virtual NativeInfoPtr getNativeInfo() = 0;
         virtual void close() = 0;
         virtual EndpointIPtr listen() = 0;
+
+        // Enables SO_REUSEPORT on the listening socket, to be called before listen(). This allows several acceptors
+        // to listen on the same address and port, with the kernel load-balancing the incoming connections between
+        // them. Returns false if not supported by the acceptor or the platform.
+        virtual bool setReusePort() { return false; }
 #if defined(ICE_USE_IOCP)
         virtual void startAccept() = 0;
         virtual void finishAccept() = 0;
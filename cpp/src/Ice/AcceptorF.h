@@ -12,6 +12,9 @@ namespace IceInternal
 
     class TcpAcceptor;
     using TcpAcceptorPtr = std::shared_ptr<TcpAcceptor>;
+
+    class UnixAcceptor;
+    using UnixAcceptorPtr = std::shared_ptr<UnixAcceptor>;
 }
 
 #endif
@@ -1,8 +1,10 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "BatchRequestQueue.h"
+#include "Ice/LocalExceptions.h"
 #include "Ice/Properties.h"
 #include "Ice/Proxy.h"
+#include "Ice/Timer.h"
 #include "Instance.h"
 #include "Reference.h"
 
@@ -39,12 +41,45 @@ namespace
         const string_view _operation;
         const int _size;
     };
+
+    // Flushes the batch when the auto-flush interval of its first request expires.
+    class FlushTimerTask final : public IceInternal::TimerTask
+    {
+    public:
+        FlushTimerTask(BatchRequestQueuePtr queue, Ice::ObjectPrx proxy, chrono::steady_clock::time_point deadline)
+            : _queue(std::move(queue)),
+              _proxy(std::move(proxy)),
+              _deadline(deadline)
+        {
+        }
+
+        void runTimerTask() final
+        {
+            if (_queue->flushTimeout(_deadline))
+            {
+                try
+                {
+                    _proxy->ice_flushBatchRequestsAsync(nullptr); // auto-flush, don't wait for response
+                }
+                catch (const Ice::LocalException&)
+                {
+                    // Ignore, the communicator is being destroyed.
+                }
+            }
+        }
+
+    private:
+        const BatchRequestQueuePtr _queue;
+        const Ice::ObjectPrx _proxy;
+        const chrono::steady_clock::time_point _deadline;
+    };
 }
 
 BatchRequest::~BatchRequest() = default; // avoid weak vtable
 
 BatchRequestQueue::BatchRequestQueue(const InstancePtr& instance, bool datagram)
-    : _interceptor(instance->initializationData().batchRequestInterceptor),
+    : _instance(instance),
+      _interceptor(instance->initializationData().batchRequestInterceptor),
       _batchStream(instance.get(), Ice::currentProtocolEncoding)
 {
     _batchStream.writeBlob(requestBatchHdr, sizeof(requestBatchHdr));
@@ -117,6 +152,10 @@ BatchRequestQueue::finishBatchRequest(OutputStream* os, const Ice::ObjectPrx& pr
         _batchStream.resize(_batchMarker);
         _batchStreamInUse = false;
         _batchStreamCanFlush = false;
+        if (_batchRequestNum > 0)
+        {
+            scheduleFlushNoSync(proxy);
+        }
         _conditionVariable.notify_all();
     }
     catch (const std::exception&)
@@ -164,6 +203,7 @@ BatchRequestQueue::swap(OutputStream* os, bool& compress) noexcept
     int requestNum = _batchRequestNum;
     _batchStream.swap(*os);
     compress = _batchCompress;
+    _flushDeadline = nullopt; // Pending flush timer tasks are now stale.
 
     //
     // Reset the batch.
@@ -205,3 +245,43 @@ BatchRequestQueue::enqueueBatchRequest(const Ice::ObjectPrx& proxy)
     _batchMarker = _batchStream.b.size();
     ++_batchRequestNum;
 }
+
+bool
+BatchRequestQueue::flushTimeout(chrono::steady_clock::time_point deadline)
+{
+    lock_guard lock(_mutex);
+    if (_flushDeadline != deadline)
+    {
+        return false; // The batch was flushed or a flush was scheduled with an earlier deadline.
+    }
+    _flushDeadline = nullopt;
+    return _batchRequestNum > 0;
+}
+
+void
+BatchRequestQueue::scheduleFlushNoSync(const Ice::ObjectPrx& proxy)
+{
+    // The batch is flushed at the latest when the auto-flush interval of one of its requests expires. The interval is
+    // per proxy, a request queued with a shorter interval can bring the deadline forward.
+    chrono::microseconds interval = proxy->_getReference()->getBatchAutoFlushInterval();
+    if (interval <= chrono::microseconds::zero())
+    {
+        return;
+    }
+
+    auto deadline = chrono::steady_clock::now() + interval;
+    if (_flushDeadline && *_flushDeadline <= deadline)
+    {
+        return;
+    }
+
+    try
+    {
+        _instance->timer()->schedule(make_shared<FlushTimerTask>(shared_from_this(), proxy, deadline), interval);
+        _flushDeadline = deadline;
+    }
+    catch (const Ice::CommunicatorDestroyedException&)
+    {
+        // The batch is discarded with the communicator.
+    }
+}
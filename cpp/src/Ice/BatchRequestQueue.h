@@ -8,13 +8,15 @@
 #include "Ice/InstanceF.h"
 #include "Ice/OutputStream.h"
 
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <mutex>
+#include <optional>
 
 namespace IceInternal
 {
-    class BatchRequestQueue
+    class BatchRequestQueue : public std::enable_shared_from_this<BatchRequestQueue>
     {
     public:
         BatchRequestQueue(const InstancePtr&, bool);
@@ -30,7 +32,13 @@ namespace IceInternal
 
         void enqueueBatchRequest(const Ice::ObjectPrx&);
 
+        // Called by the flush timer task, returns true if the batch must be flushed.
+        bool flushTimeout(std::chrono::steady_clock::time_point);
+
     private:
+        void scheduleFlushNoSync(const Ice::ObjectPrx&);
+
+        const InstancePtr _instance;
         std::function<void(const Ice::BatchRequest&, int, int)> _interceptor;
         Ice::OutputStream _batchStream;
         bool _batchStreamInUse{false};
@@ -40,6 +48,7 @@ namespace IceInternal
         size_t _batchMarker;
         std::exception_ptr _exception;
         size_t _maxSize;
+        std::optional<std::chrono::steady_clock::time_point> _flushDeadline;
 
         std::mutex _mutex;
         std::condition_variable _conditionVariable;
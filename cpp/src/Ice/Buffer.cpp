@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "Ice/Buffer.h"
+#include "BufferPool.h"
 
 #include <cstdlib>
 #include <cstring>
@@ -108,9 +109,9 @@ IceInternal::Buffer::Container::operator=(Container&& other) noexcept
 
 IceInternal::Buffer::Container::~Container()
 {
-    if (_buf && _owned)
+    if (_owned)
     {
-        ::free(_buf);
+        releaseBuffer(_buf, _capacity);
     }
 }
 
@@ -127,9 +128,9 @@ IceInternal::Buffer::Container::swap(Container& other) noexcept
 void
 IceInternal::Buffer::Container::clear()
 {
-    if (_buf && _owned)
+    if (_owned)
     {
-        ::free(_buf);
+        releaseBuffer(_buf, _capacity);
     }
 
     _buf = nullptr;
@@ -157,17 +158,28 @@ IceInternal::Buffer::Container::reserve(size_type n)
         return;
     }
 
+    // If the buffer pool is enabled, the capacity is rounded up to its size class.
+    _capacity = bufferCapacity(_capacity);
+    if (_owned && _capacity == c)
+    {
+        return; // Shrinking within the same size class.
+    }
+
     pointer p;
-    if (_owned)
+    if (_owned && !isPooledBufferCapacity(c) && !isPooledBufferCapacity(_capacity))
     {
         p = reinterpret_cast<pointer>(::realloc(_buf, _capacity));
     }
     else
     {
-        p = reinterpret_cast<pointer>(::malloc(_capacity));
+        p = allocateBuffer(_capacity);
         if (p)
         {
             ::memcpy(p, _buf, _size);
+            if (_owned)
+            {
+                releaseBuffer(_buf, c);
+            }
             _owned = true;
         }
     }
@@ -0,0 +1,346 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "BufferPool.h"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <list>
+#include <mutex>
+
+using namespace std;
+using namespace IceInternal;
+
+namespace
+{
+    // The size classes are the powers of 2 from 256 bytes to 64 KB. The smallest size class matches the minimum
+    // capacity of Buffer::Container (240 bytes).
+    const size_t minSizeClass = 256;
+    const size_t sizeClassCount = 9;
+    const size_t maxSizeClass = minSizeClass << (sizeClassCount - 1);
+
+    // The maximum number of blocks of a size class cached by each thread. When the thread cache of a size class is
+    // full, half of its blocks are moved to the shared cache. When it's empty, it's refilled with up to half as many
+    // blocks from the shared cache. If the shared cache is empty too, the size class is marked as starving: the next
+    // thread which releases a block of this size class hands over half of its thread cache to the shared cache.
+    const size_t threadCacheSize = 32;
+
+    // The maximum number of blocks of a size class cached by the shared cache, the blocks in excess are freed.
+    const size_t sharedCacheSize = 1024;
+
+    size_t sizeClassIndex(size_t capacity) noexcept
+    {
+        assert(capacity <= maxSizeClass);
+        size_t index = 0;
+        for (size_t size = minSizeClass; size < capacity; size <<= 1)
+        {
+            ++index;
+        }
+        return index;
+    }
+
+    // A counter only updated by its owner thread, but read by the threads collecting the pool statistics.
+    class Counter
+    {
+    public:
+        void add(int64_t n) noexcept { _value.store(_value.load(memory_order_relaxed) + n, memory_order_relaxed); }
+
+        [[nodiscard]] int64_t get() const noexcept { return _value.load(memory_order_relaxed); }
+
+    private:
+        atomic<int64_t> _value{0};
+    };
+
+    struct ThreadStats
+    {
+        array<Counter, sizeClassCount> allocations;
+        array<Counter, sizeClassCount> hits;
+        array<Counter, sizeClassCount> cached;
+    };
+
+    struct SharedPool
+    {
+        SharedPool()
+        {
+            for (auto& p : blocks)
+            {
+                p.reserve(sharedCacheSize);
+            }
+        }
+
+        mutex sync;
+        array<vector<byte*>, sizeClassCount> blocks;
+        array<atomic<bool>, sizeClassCount> starving{};
+
+        // The statistics of the live thread caches, and the statistics of the thread caches which are gone.
+        list<const ThreadStats*> threadStats;
+        array<int64_t, sizeClassCount> retiredAllocations{};
+        array<int64_t, sizeClassCount> retiredHits{};
+    };
+
+    atomic<int> enableCount{0};
+
+    // Incremented each time the pool is disabled: the thread caches filled before are drained by their thread on its
+    // next allocation or release.
+    atomic<uint64_t> generation{0};
+
+    SharedPool& sharedPool()
+    {
+        // Never deleted: the thread caches of the threads still running at exit use it when these threads terminate.
+        static auto* pool = new SharedPool;
+        return *pool;
+    }
+
+    bool isEnabled() noexcept { return enableCount.load(memory_order_relaxed) > 0; }
+
+    // Set when the thread cache of this thread is destroyed: buffers released by the destructors of thread-local
+    // objects destroyed after it are freed.
+    thread_local bool threadCacheDestroyed = false;
+
+    class ThreadCache;
+
+    // The thread cache of this thread, nullptr if it's not created yet or if it's destroyed.
+    thread_local ThreadCache* currentThreadCache = nullptr;
+
+    class ThreadCache
+    {
+    public:
+        ThreadCache() : _generation(generation.load(memory_order_relaxed))
+        {
+            SharedPool& pool = sharedPool();
+            lock_guard lock(pool.sync);
+            pool.threadStats.push_back(&_stats);
+        }
+
+        ~ThreadCache()
+        {
+            SharedPool& pool = sharedPool();
+            lock_guard lock(pool.sync);
+            for (size_t index = 0; index < sizeClassCount; ++index)
+            {
+                releaseToShared(pool, index, _count[index]);
+                pool.retiredAllocations[index] += _stats.allocations[index].get();
+                pool.retiredHits[index] += _stats.hits[index].get();
+            }
+            pool.threadStats.remove(&_stats);
+            threadCacheDestroyed = true;
+            currentThreadCache = nullptr;
+        }
+
+        ThreadCache(const ThreadCache&) = delete;
+        ThreadCache& operator=(const ThreadCache&) = delete;
+
+        byte* allocate(size_t index) noexcept
+        {
+            _stats.allocations[index].add(1);
+            if (_count[index] == 0)
+            {
+                // Refill from the shared cache.
+                SharedPool& pool = sharedPool();
+                lock_guard lock(pool.sync);
+                vector<byte*>& shared = pool.blocks[index];
+                while (!shared.empty() && _count[index] < threadCacheSize / 2)
+                {
+                    _blocks[index][_count[index]++] = shared.back();
+                    shared.pop_back();
+                }
+                _stats.cached[index].add(static_cast<int64_t>(_count[index]));
+                if (_count[index] == 0)
+                {
+                    pool.starving[index].store(true, memory_order_relaxed);
+                    return static_cast<byte*>(::malloc(minSizeClass << index));
+                }
+            }
+            _stats.hits[index].add(1);
+            _stats.cached[index].add(-1);
+            return _blocks[index][--_count[index]];
+        }
+
+        void release(size_t index, byte* block) noexcept
+        {
+            SharedPool& pool = sharedPool();
+            if (_count[index] == threadCacheSize)
+            {
+                lock_guard lock(pool.sync);
+                releaseToShared(pool, index, threadCacheSize / 2);
+            }
+            _blocks[index][_count[index]++] = block;
+            _stats.cached[index].add(1);
+
+            // Another thread found its cache and the shared cache empty: the blocks it allocates are released by
+            // other threads, such as this one. Handing over the blocks now, rather than once this thread cache is
+            // full, stops the allocating thread from allocating new blocks with malloc.
+            if (pool.starving[index].load(memory_order_relaxed))
+            {
+                lock_guard lock(pool.sync);
+                pool.starving[index].store(false, memory_order_relaxed);
+                releaseToShared(pool, index, (_count[index] + 1) / 2);
+            }
+        }
+
+        // Frees the cached blocks if the pool was disabled since this thread cache was filled.
+        void drainIfDisabled() noexcept
+        {
+            uint64_t current = generation.load(memory_order_relaxed);
+            if (_generation != current)
+            {
+                _generation = current;
+                SharedPool& pool = sharedPool();
+                lock_guard lock(pool.sync);
+                for (size_t index = 0; index < sizeClassCount; ++index)
+                {
+                    releaseToShared(pool, index, _count[index]);
+                }
+            }
+        }
+
+    private:
+        // Moves the last n blocks of a size class to the shared cache, called with the shared pool mutex locked.
+        void releaseToShared(SharedPool& pool, size_t index, size_t n) noexcept
+        {
+            vector<byte*>& shared = pool.blocks[index];
+            for (size_t i = 0; i < n; ++i)
+            {
+                byte* block = _blocks[index][--_count[index]];
+                if (shared.size() < sharedCacheSize && isEnabled())
+                {
+                    shared.push_back(block); // Doesn't allocate, see SharedPool.
+                }
+                else
+                {
+                    ::free(block);
+                }
+            }
+            _stats.cached[index].add(-static_cast<int64_t>(n));
+        }
+
+        array<array<byte*, threadCacheSize>, sizeClassCount> _blocks;
+        array<size_t, sizeClassCount> _count{};
+        uint64_t _generation;
+        ThreadStats _stats;
+    };
+
+    ThreadCache* threadCache()
+    {
+        if (threadCacheDestroyed)
+        {
+            return nullptr;
+        }
+        thread_local ThreadCache cache;
+        currentThreadCache = &cache;
+        cache.drainIfDisabled();
+        return &cache;
+    }
+
+    // Called by the allocations and releases which don't use the pool: once the pool is disabled, the blocks cached
+    // by the thread cache of this thread are freed.
+    void drainThreadCache() noexcept
+    {
+        if (currentThreadCache)
+        {
+            currentThreadCache->drainIfDisabled();
+        }
+    }
+}
+
+void
+IceInternal::enableBufferPool()
+{
+    ++enableCount;
+}
+
+void
+IceInternal::disableBufferPool()
+{
+    if (--enableCount == 0)
+    {
+        ++generation;
+
+        SharedPool& pool = sharedPool();
+        lock_guard lock(pool.sync);
+        for (auto& blocks : pool.blocks)
+        {
+            for (byte* block : blocks)
+            {
+                ::free(block);
+            }
+            blocks.clear();
+        }
+    }
+}
+
+size_t
+IceInternal::bufferCapacity(size_t capacity) noexcept
+{
+    if (capacity > maxSizeClass || !isEnabled())
+    {
+        return capacity;
+    }
+    return minSizeClass << sizeClassIndex(capacity);
+}
+
+bool
+IceInternal::isPooledBufferCapacity(size_t capacity) noexcept
+{
+    return capacity >= minSizeClass && capacity <= maxSizeClass && (capacity & (capacity - 1)) == 0 && isEnabled();
+}
+
+byte*
+IceInternal::allocateBuffer(size_t capacity) noexcept
+{
+    if (isPooledBufferCapacity(capacity))
+    {
+        if (ThreadCache* cache = threadCache())
+        {
+            return cache->allocate(sizeClassIndex(capacity));
+        }
+    }
+    else
+    {
+        drainThreadCache();
+    }
+    return static_cast<byte*>(::malloc(capacity));
+}
+
+void
+IceInternal::releaseBuffer(byte* buffer, size_t capacity) noexcept
+{
+    if (buffer)
+    {
+        ThreadCache* cache = isPooledBufferCapacity(capacity) ? threadCache() : nullptr;
+        if (cache)
+        {
+            cache->release(sizeClassIndex(capacity), buffer);
+        }
+        else
+        {
+            drainThreadCache();
+            ::free(buffer);
+        }
+    }
+}
+
+vector<BufferPoolStats>
+IceInternal::getBufferPoolStats()
+{
+    vector<BufferPoolStats> stats;
+    SharedPool& pool = sharedPool();
+    lock_guard lock(pool.sync);
+    for (size_t index = 0; index < sizeClassCount; ++index)
+    {
+        BufferPoolStats s{
+            minSizeClass << index,
+            pool.retiredAllocations[index],
+            pool.retiredHits[index],
+            static_cast<int64_t>(pool.blocks[index].size())};
+        for (const ThreadStats* threadStats : pool.threadStats)
+        {
+            s.allocations += threadStats->allocations[index].get();
+            s.hits += threadStats->hits[index].get();
+            s.cached += threadStats->cached[index].get();
+        }
+        stats.push_back(s);
+    }
+    return stats;
+}
@@ -0,0 +1,87 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_BUFFER_POOL_H
+#define ICE_BUFFER_POOL_H
+
+#include "Ice/Config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace IceInternal
+{
+    //
+    // The process-wide pool of the memory blocks of Buffer::Container. The pool is enabled while at least one
+    // communicator with Ice.BufferPool > 0 is alive. When it's enabled, the capacity of a buffer smaller or equal to
+    // the largest size class is rounded up to its size class, and the blocks of released buffers are kept in a cache
+    // of the releasing thread (and in a shared cache once the thread cache is full) to be reused by the next
+    // allocations of the same size class.
+    //
+    // The pool is process-wide, not per communicator: once a communicator enables it, the buffers of all the
+    // communicators of the process use it, including those of communicators which don't set Ice.BufferPool. Likewise,
+    // the BufferPool metrics of each communicator report the statistics of the whole process.
+    //
+    // The pooled blocks are allocated with malloc: a buffer allocated before the pool is enabled can be released to
+    // the pool, and a block allocated by the pool can be released with free or realloc-ed once it's disabled.
+    //
+    // An allocation misses the caches, and allocates a new block with malloc, only when both the cache of its thread
+    // and the shared cache are empty. Blocks allocated by a thread and released by another one are handed over to the
+    // shared cache by the releasing thread on its first release following such a miss. Each miss adds a block to the
+    // pool: once the pool holds as many blocks of a size class as the application uses at the same time, plus the
+    // blocks kept by the thread caches (up to 32 per thread), allocating this size class no longer misses.
+    //
+    // When the pool is disabled, the shared cache is freed right away and each thread cache is freed by its thread on
+    // its next allocation or release, or when the thread terminates.
+    //
+
+    /// Enables the buffer pool. Each call must be matched by a call to disableBufferPool.
+    void enableBufferPool();
+
+    /// Disables the buffer pool once each call to enableBufferPool is matched by a call to this function. The blocks
+    /// of the shared cache are freed, the blocks of the thread caches are freed by their threads.
+    void disableBufferPool();
+
+    /// Gets the capacity to allocate for a buffer.
+    /// @param capacity The requested capacity.
+    /// @return The size class of @p capacity if the pool is enabled and @p capacity fits a size class, @p capacity
+    /// otherwise.
+    [[nodiscard]] std::size_t bufferCapacity(std::size_t capacity) noexcept;
+
+    /// Checks if a block of the given capacity is cached by the pool when released.
+    /// @param capacity The capacity of the block.
+    /// @return true if the pool is enabled and @p capacity is a size class, false otherwise.
+    [[nodiscard]] bool isPooledBufferCapacity(std::size_t capacity) noexcept;
+
+    /// Allocates a block.
+    /// @param capacity The capacity of the block, as returned by bufferCapacity.
+    /// @return The block, or nullptr if the allocation failed.
+    [[nodiscard]] std::byte* allocateBuffer(std::size_t capacity) noexcept;
+
+    /// Releases a block. The block is cached if its capacity is a size class of the enabled pool, freed otherwise.
+    /// @param buffer The block, it can be nullptr.
+    /// @param capacity The capacity of the block.
+    void releaseBuffer(std::byte* buffer, std::size_t capacity) noexcept;
+
+    /// The statistics of a size class of the buffer pool.
+    struct BufferPoolStats
+    {
+        /// The size of the blocks of this size class.
+        std::size_t size;
+
+        /// The number of blocks of this size class allocated since the pool was created.
+        std::int64_t allocations;
+
+        /// The number of allocations served by a cached block.
+        std::int64_t hits;
+
+        /// The number of blocks currently cached.
+        std::int64_t cached;
+    };
+
+    /// Gets the statistics of the buffer pool.
+    /// @return The statistics of each size class, from the smallest to the largest.
+    std::vector<BufferPoolStats> getBufferPoolStats();
+}
+
+#endif
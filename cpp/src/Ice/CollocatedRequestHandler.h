@@ -42,6 +42,8 @@ namespace IceInternal
 
         void dispatchAll(Ice::InputStream&, std::int32_t, std::int32_t);
 
+        [[nodiscard]] const std::shared_ptr<Ice::ObjectAdapterI>& adapter() const noexcept { return _adapter; }
+
     private:
         void handleException(std::int32_t, std::exception_ptr);
 
@@ -0,0 +1,416 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Compressor.h"
+#include "Ice/LocalExceptions.h"
+
+#include "DisableWarnings.h"
+
+#include <bzlib.h>
+
+#if defined(ICE_HAS_LZ4)
+#    include <lz4.h>
+#endif
+
+#if defined(ICE_HAS_ZSTD)
+#    include <zstd.h>
+#endif
+
+#include <string>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+    string getBZ2Error(int bzError)
+    {
+        if (bzError == BZ_RUN_OK)
+        {
+            return ": BZ_RUN_OK";
+        }
+        else if (bzError == BZ_FLUSH_OK)
+        {
+            return ": BZ_FLUSH_OK";
+        }
+        else if (bzError == BZ_FINISH_OK)
+        {
+            return ": BZ_FINISH_OK";
+        }
+        else if (bzError == BZ_STREAM_END)
+        {
+            return ": BZ_STREAM_END";
+        }
+        else if (bzError == BZ_CONFIG_ERROR)
+        {
+            return ": BZ_CONFIG_ERROR";
+        }
+        else if (bzError == BZ_SEQUENCE_ERROR)
+        {
+            return ": BZ_SEQUENCE_ERROR";
+        }
+        else if (bzError == BZ_PARAM_ERROR)
+        {
+            return ": BZ_PARAM_ERROR";
+        }
+        else if (bzError == BZ_MEM_ERROR)
+        {
+            return ": BZ_MEM_ERROR";
+        }
+        else if (bzError == BZ_DATA_ERROR)
+        {
+            return ": BZ_DATA_ERROR";
+        }
+        else if (bzError == BZ_DATA_ERROR_MAGIC)
+        {
+            return ": BZ_DATA_ERROR_MAGIC";
+        }
+        else if (bzError == BZ_IO_ERROR)
+        {
+            return ": BZ_IO_ERROR";
+        }
+        else if (bzError == BZ_UNEXPECTED_EOF)
+        {
+            return ": BZ_UNEXPECTED_EOF";
+        }
+        else if (bzError == BZ_OUTBUFF_FULL)
+        {
+            return ": BZ_OUTBUFF_FULL";
+        }
+        else
+        {
+            return "";
+        }
+    }
+
+    class BZip2Compressor final : public Compressor
+    {
+    public:
+        BZip2Compressor(int level) : _level(level) {}
+
+        [[nodiscard]] uint8_t codec() const noexcept final { return bzip2Codec; }
+
+        [[nodiscard]] size_t compressBound(size_t size) const noexcept final
+        {
+            return static_cast<size_t>(static_cast<double>(size) * 1.01 + 600);
+        }
+
+        size_t compress(const byte* source, size_t sourceSize, byte* dest, size_t destCapacity) final
+        {
+            auto destLen = static_cast<unsigned int>(destCapacity);
+            int bzError = BZ2_bzBuffToBuffCompress(
+                reinterpret_cast<char*>(dest),
+                &destLen,
+                const_cast<char*>(reinterpret_cast<const char*>(source)),
+                static_cast<unsigned int>(sourceSize),
+                _level,
+                0,
+                0);
+            if (bzError != BZ_OK)
+            {
+                throw ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    "cannot compress message - BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError)};
+            }
+            return destLen;
+        }
+
+        void decompress(const byte* source, size_t sourceSize, byte* dest, size_t destSize) final
+        {
+            auto destLen = static_cast<unsigned int>(destSize);
+            int bzError = BZ2_bzBuffToBuffDecompress(
+                reinterpret_cast<char*>(dest),
+                &destLen,
+                const_cast<char*>(reinterpret_cast<const char*>(source)),
+                static_cast<unsigned int>(sourceSize),
+                0,
+                0);
+            if (bzError != BZ_OK)
+            {
+                throw ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    "cannot decompress message - BZ2_bzBuffToBuffDecompress failed" + getBZ2Error(bzError)};
+            }
+        }
+
+    private:
+        const int _level;
+    };
+
+#if defined(ICE_HAS_LZ4)
+    class LZ4Compressor final : public Compressor
+    {
+    public:
+        [[nodiscard]] uint8_t codec() const noexcept final { return lz4Codec; }
+
+        [[nodiscard]] size_t compressBound(size_t size) const noexcept final
+        {
+            return static_cast<size_t>(LZ4_compressBound(static_cast<int>(size)));
+        }
+
+        size_t compress(const byte* source, size_t sourceSize, byte* dest, size_t destCapacity) final
+        {
+            // LZ4 has no compression levels, it's optimized for speed.
+            int size = LZ4_compress_default(
+                reinterpret_cast<const char*>(source),
+                reinterpret_cast<char*>(dest),
+                static_cast<int>(sourceSize),
+                static_cast<int>(destCapacity));
+            if (size <= 0)
+            {
+                throw ProtocolException{__FILE__, __LINE__, "cannot compress message - LZ4_compress_default failed"};
+            }
+            return static_cast<size_t>(size);
+        }
+
+        void decompress(const byte* source, size_t sourceSize, byte* dest, size_t destSize) final
+        {
+            int size = LZ4_decompress_safe(
+                reinterpret_cast<const char*>(source),
+                reinterpret_cast<char*>(dest),
+                static_cast<int>(sourceSize),
+                static_cast<int>(destSize));
+            if (size < 0 || static_cast<size_t>(size) != destSize)
+            {
+                throw ProtocolException{__FILE__, __LINE__, "cannot decompress message - LZ4_decompress_safe failed"};
+            }
+        }
+    };
+#endif
+
+#if defined(ICE_HAS_ZSTD)
+    class ZstdCompressor final : public Compressor
+    {
+    public:
+        ZstdCompressor(int level) : _level(level) {}
+
+        [[nodiscard]] uint8_t codec() const noexcept final { return zstdCodec; }
+
+        [[nodiscard]] size_t compressBound(size_t size) const noexcept final { return ZSTD_compressBound(size); }
+
+        size_t compress(const byte* source, size_t sourceSize, byte* dest, size_t destCapacity) final
+        {
+            size_t size = ZSTD_compress(dest, destCapacity, source, sourceSize, _level);
+            if (ZSTD_isError(size))
+            {
+                throw ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    string{"cannot compress message - ZSTD_compress failed: "} + ZSTD_getErrorName(size)};
+            }
+            return size;
+        }
+
+        void decompress(const byte* source, size_t sourceSize, byte* dest, size_t destSize) final
+        {
+            size_t size = ZSTD_decompress(dest, destSize, source, sourceSize);
+            if (ZSTD_isError(size))
+            {
+                throw ProtocolException{
+                    __FILE__,
+                    __LINE__,
+                    string{"cannot decompress message - ZSTD_decompress failed: "} + ZSTD_getErrorName(size)};
+            }
+            else if (size != destSize)
+            {
+                throw ProtocolException{__FILE__, __LINE__, "cannot decompress message - unexpected size"};
+            }
+        }
+
+    private:
+        const int _level;
+    };
+
+    //
+    // Compresses all the messages sent over a connection as a single Zstd frame, which is flushed at the end of each
+    // message. Small messages which repeat the same operation names, identities and contexts compress much better with
+    // the history of the previous messages (and the dictionary) than as independent frames.
+    //
+    class ZstdStreamCompressor final : public Compressor
+    {
+    public:
+        ZstdStreamCompressor(int level, const vector<byte>& dictionary)
+            : _cctx(ZSTD_createCCtx()),
+              _dctx(ZSTD_createDCtx())
+        {
+            if (!_cctx || !_dctx)
+            {
+                ZSTD_freeCCtx(_cctx);
+                ZSTD_freeDCtx(_dctx);
+                throw bad_alloc();
+            }
+
+            ZSTD_CCtx_setParameter(_cctx, ZSTD_c_compressionLevel, level);
+            ZSTD_CCtx_setParameter(_cctx, ZSTD_c_windowLog, windowLog);
+            ZSTD_DCtx_setParameter(_dctx, ZSTD_d_windowLogMax, windowLog);
+            if (!dictionary.empty())
+            {
+                ZSTD_CCtx_loadDictionary(_cctx, dictionary.data(), dictionary.size());
+                ZSTD_DCtx_loadDictionary(_dctx, dictionary.data(), dictionary.size());
+            }
+        }
+
+        ZstdStreamCompressor(const ZstdStreamCompressor&) = delete;
+        ZstdStreamCompressor& operator=(const ZstdStreamCompressor&) = delete;
+
+        ~ZstdStreamCompressor() final
+        {
+            ZSTD_freeCCtx(_cctx);
+            ZSTD_freeDCtx(_dctx);
+        }
+
+        [[nodiscard]] uint8_t codec() const noexcept final { return zstdStreamCodec; }
+
+        [[nodiscard]] size_t compressBound(size_t size) const noexcept final
+        {
+            // Leave room for the frame header written with the first message.
+            return ZSTD_compressBound(size) + 32;
+        }
+
+        size_t compress(const byte* source, size_t sourceSize, byte* dest, size_t destCapacity) final
+        {
+            ZSTD_inBuffer in{source, sourceSize, 0};
+            ZSTD_outBuffer out{dest, destCapacity, 0};
+            size_t remaining = 0;
+            do
+            {
+                remaining = ZSTD_compressStream2(_cctx, &out, &in, ZSTD_e_flush);
+                if (ZSTD_isError(remaining))
+                {
+                    throw ProtocolException{
+                        __FILE__,
+                        __LINE__,
+                        string{"cannot compress message - ZSTD_compressStream2 failed: "} +
+                            ZSTD_getErrorName(remaining)};
+                }
+                else if (remaining > 0 && out.pos == out.size)
+                {
+                    throw ProtocolException{__FILE__, __LINE__, "cannot compress message - output buffer too small"};
+                }
+            } while (remaining > 0);
+            return out.pos;
+        }
+
+        void decompress(const byte* source, size_t sourceSize, byte* dest, size_t destSize) final
+        {
+            ZSTD_inBuffer in{source, sourceSize, 0};
+            ZSTD_outBuffer out{dest, destSize, 0};
+            while (in.pos < in.size || out.pos < out.size)
+            {
+                size_t inPos = in.pos;
+                size_t outPos = out.pos;
+                size_t ret = ZSTD_decompressStream(_dctx, &out, &in);
+                if (ZSTD_isError(ret))
+                {
+                    throw ProtocolException{
+                        __FILE__,
+                        __LINE__,
+                        string{"cannot decompress message - ZSTD_decompressStream failed: "} + ZSTD_getErrorName(ret)};
+                }
+                else if (in.pos == inPos && out.pos == outPos)
+                {
+                    // The compressed data is truncated or it decompresses to more than the expected size.
+                    throw ProtocolException{__FILE__, __LINE__, "cannot decompress message - unexpected size"};
+                }
+            }
+        }
+
+    private:
+        // Bounds the history kept by each side of each connection to 128KB.
+        static constexpr int windowLog = 17;
+
+        ZSTD_CCtx* _cctx;
+        ZSTD_DCtx* _dctx;
+    };
+#endif
+}
+
+IceInternal::Compressor::~Compressor() = default;
+
+CompressorPtr
+IceInternal::createCompressor(uint8_t codec, int level, [[maybe_unused]] const vector<byte>& dictionary)
+{
+    switch (codec)
+    {
+        case bzip2Codec:
+        {
+            return make_unique<BZip2Compressor>(level);
+        }
+#if defined(ICE_HAS_LZ4)
+        case lz4Codec:
+        {
+            return make_unique<LZ4Compressor>();
+        }
+#endif
+#if defined(ICE_HAS_ZSTD)
+        case zstdCodec:
+        {
+            return make_unique<ZstdCompressor>(level);
+        }
+        case zstdStreamCodec:
+        {
+            return make_unique<ZstdStreamCompressor>(level, dictionary);
+        }
+#endif
+        default:
+        {
+            return nullptr;
+        }
+    }
+}
+
+uint8_t
+IceInternal::supportedCodecs() noexcept
+{
+    uint8_t codecs = codecBit(bzip2Codec);
+#if defined(ICE_HAS_LZ4)
+    codecs |= codecBit(lz4Codec);
+#endif
+#if defined(ICE_HAS_ZSTD)
+    codecs |= codecBit(zstdCodec);
+    codecs |= codecBit(zstdStreamCodec);
+#endif
+    return codecs;
+}
+
+uint8_t
+IceInternal::codecFromName(string_view name) noexcept
+{
+    if (name == "bzip2")
+    {
+        return bzip2Codec;
+    }
+    else if (name == "lz4")
+    {
+        return lz4Codec;
+    }
+    else if (name == "zstd")
+    {
+        return zstdCodec;
+    }
+    else if (name == "zstd-stream")
+    {
+        return zstdStreamCodec;
+    }
+    return 0;
+}
+
+string_view
+IceInternal::codecName(uint8_t codec) noexcept
+{
+    switch (codec)
+    {
+        case bzip2Codec:
+            return "bzip2";
+        case lz4Codec:
+            return "lz4";
+        case zstdCodec:
+            return "zstd";
+        case zstdStreamCodec:
+            return "zstd-stream";
+        default:
+            return "";
+    }
+}
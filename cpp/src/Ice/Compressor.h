@@ -0,0 +1,109 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_COMPRESSOR_H
+#define ICE_COMPRESSOR_H
+
+#include "Ice/Config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace IceInternal
+{
+    //
+    // The compression codecs. The codec of a compressed message is its compression status in the message header
+    // (0 and 1 denote uncompressed messages).
+    //
+    const std::uint8_t bzip2Codec = 2;
+    const std::uint8_t lz4Codec = 3;
+    const std::uint8_t zstdCodec = 4;
+    const std::uint8_t zstdStreamCodec = 5;
+
+    // The number of codecs.
+    const std::size_t codecCount = zstdStreamCodec - bzip2Codec + 1;
+
+    //
+    // The server advertises the codecs it supports with the compression status of the ValidateConnection message:
+    // the codecAdvertisement bit is set and the bit (codec - bzip2Codec) is set for each supported codec. Older
+    // servers always send 0 and only support bzip2.
+    //
+    const std::uint8_t codecAdvertisement = 0x80;
+
+    /// Returns the advertisement bit of the given codec.
+    /// @param codec The codec.
+    /// @return The bit of the codec in a ValidateConnection compression status.
+    constexpr std::uint8_t codecBit(std::uint8_t codec) noexcept
+    {
+        return static_cast<std::uint8_t>(1 << (codec - bzip2Codec));
+    }
+
+    /// Checks if a codec keeps state across messages.
+    /// @param codec The codec.
+    /// @return true if the messages compressed with this codec must be compressed and decompressed in order.
+    constexpr bool isStatefulCodec(std::uint8_t codec) noexcept { return codec == zstdStreamCodec; }
+
+    /// Compresses and decompresses the body of Ice protocol messages. A compressor can keep state from one message to
+    /// the next (zstd-stream): the messages must then be decompressed by a single peer compressor, in the order they
+    /// were compressed.
+    class Compressor
+    {
+    public:
+        virtual ~Compressor();
+
+        /// Gets the codec of this compressor.
+        /// @return The codec, used as the compression status of the messages compressed by this compressor.
+        [[nodiscard]] virtual std::uint8_t codec() const noexcept = 0;
+
+        /// Gets the maximum compressed size of the given number of bytes.
+        /// @param size The uncompressed size.
+        /// @return The size of the buffer to provide to compress.
+        [[nodiscard]] virtual std::size_t compressBound(std::size_t size) const noexcept = 0;
+
+        /// Compresses a buffer.
+        /// @param source The bytes to compress.
+        /// @param sourceSize The number of bytes to compress.
+        /// @param dest The buffer that receives the compressed bytes.
+        /// @param destCapacity The size of @p dest, at least compressBound(sourceSize).
+        /// @return The number of compressed bytes.
+        /// @throws Ice::ProtocolException Thrown if the compression fails.
+        virtual std::size_t
+        compress(const std::byte* source, std::size_t sourceSize, std::byte* dest, std::size_t destCapacity) = 0;
+
+        /// Decompresses a buffer.
+        /// @param source The compressed bytes.
+        /// @param sourceSize The number of compressed bytes.
+        /// @param dest The buffer that receives the decompressed bytes.
+        /// @param destSize The uncompressed size, as sent by the peer.
+        /// @throws Ice::ProtocolException Thrown if the decompression fails or doesn't yield @p destSize bytes.
+        virtual void
+        decompress(const std::byte* source, std::size_t sourceSize, std::byte* dest, std::size_t destSize) = 0;
+    };
+    using CompressorPtr = std::unique_ptr<Compressor>;
+
+    /// Creates a compressor.
+    /// @param codec The codec.
+    /// @param level The compression level, between 1 and 9 (see Ice.Compression.Level).
+    /// @param dictionary The dictionary used by the codecs which keep state across messages, empty if none (see
+    /// Ice.Compression.Dictionary).
+    /// @return The new compressor, or nullptr if the codec is not supported by this build.
+    CompressorPtr createCompressor(std::uint8_t codec, int level, const std::vector<std::byte>& dictionary);
+
+    /// Gets the codecs supported by this build.
+    /// @return The codec bits (see codecBit) of the supported codecs.
+    std::uint8_t supportedCodecs() noexcept;
+
+    /// Gets the codec with the given name.
+    /// @param name The codec name: bzip2, lz4, zstd or zstd-stream.
+    /// @return The codec, or 0 if the name is not a known codec name.
+    std::uint8_t codecFromName(std::string_view name) noexcept;
+
+    /// Gets the name of a codec.
+    /// @param codec The codec.
+    /// @return The codec name, or an empty string if the codec is unknown.
+    std::string_view codecName(std::uint8_t codec) noexcept;
+}
+
+#endif
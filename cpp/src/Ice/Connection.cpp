@@ -10,6 +10,7 @@ Ice::ConnectionInfo::~ConnectionInfo() = default;
 Ice::IPConnectionInfo::~IPConnectionInfo() = default;
 Ice::TCPConnectionInfo::~TCPConnectionInfo() = default;
 Ice::UDPConnectionInfo::~UDPConnectionInfo() = default;
+Ice::UnixConnectionInfo::~UnixConnectionInfo() = default;
 Ice::WSConnectionInfo::~WSConnectionInfo() = default;
 Ice::IAPConnectionInfo::~IAPConnectionInfo() = default;
 
@@ -7,6 +7,7 @@
 #include "Connector.h"
 #include "DefaultsAndOverrides.h"
 #include "EndpointI.h"
+#include "EndpointLatencyTable.h"
 #include "Ice/Communicator.h"
 #include "Ice/LocalExceptions.h"
 #include "Ice/LoggerUtil.h"
@@ -37,30 +38,35 @@ using namespace IceInternal;
 
 namespace
 {
-    template<typename Map> void remove(Map& m, const typename Map::key_type& k, const typename Map::mapped_type& v)
+    template<typename Table, typename Key> void insert(Table& table, const Key& key, const ConnectionIPtr& connection)
     {
-        auto pr = m.equal_range(k);
+        table.insert({key->hash(), {key, connection}});
+    }
+
+    template<typename Table, typename Key> void remove(Table& table, const Key& key, const ConnectionIPtr& connection)
+    {
+        auto pr = table.equal_range(key->hash());
         assert(pr.first != pr.second);
         for (auto q = pr.first; q != pr.second; ++q)
         {
-            if (q->second.get() == v.get())
+            if (q->second.connection.get() == connection.get())
             {
-                m.erase(q);
+                table.erase(q);
                 return;
             }
         }
         assert(false); // Nothing was removed which is an error.
     }
 
-    template<typename Map, typename Predicate>
-    typename Map::mapped_type find(const Map& m, const typename Map::key_type& k, Predicate predicate)
+    template<typename Table, typename Key, typename Predicate>
+    ConnectionIPtr find(const Table& table, const Key& key, Predicate predicate)
     {
-        auto pr = m.equal_range(k);
+        auto pr = table.equal_range(key->hash());
         for (auto q = pr.first; q != pr.second; ++q)
         {
-            if (predicate(q->second))
+            if (targetEqualTo(q->second.key, key) && predicate(q->second.connection))
             {
-                return q->second;
+                return q->second.connection;
             }
         }
         return nullptr;
@@ -111,11 +117,14 @@ IceInternal::OutgoingConnectionFactory::destroy()
         return;
     }
 
-    for (const auto& [_, connection] : _connections)
+    for (const auto& [_, entry] : _connections)
+    {
+        entry.connection->destroy(ConnectionI::CommunicatorDestroyed);
+    }
     {
-        connection->destroy(ConnectionI::CommunicatorDestroyed);
+        lock_guard connectionsLock(_connectionsMutex);
+        _destroyed = true;
     }
-    _destroyed = true;
     _communicator = nullptr;
 
     _conditionVariable.notify_all();
@@ -125,16 +134,16 @@ void
 IceInternal::OutgoingConnectionFactory::updateConnectionObservers()
 {
     lock_guard lock(_mutex);
-    for (const auto& [_, connection] : _connections)
+    for (const auto& [_, entry] : _connections)
     {
-        connection->updateObserver();
+        entry.connection->updateObserver();
     }
 }
 
 void
 IceInternal::OutgoingConnectionFactory::waitUntilFinished()
 {
-    multimap<ConnectorPtr, ConnectionIPtr, Ice::TargetCompare<ConnectorPtr, std::less>> connections;
+    ConnectionTable<ConnectorPtr> connections;
 
     {
         unique_lock lock(_mutex);
@@ -153,13 +162,14 @@ IceInternal::OutgoingConnectionFactory::waitUntilFinished()
         connections = _connections;
     }
 
-    for (const auto& p : connections)
+    for (const auto& [_, entry] : connections)
     {
-        p.second->waitUntilFinished();
+        entry.connection->waitUntilFinished();
     }
 
     {
         lock_guard lock(_mutex);
+        lock_guard connectionsLock(_connectionsMutex);
         _connections.clear();
         _connectionsByEndpoint.clear();
     }
@@ -181,7 +191,7 @@ IceInternal::OutgoingConnectionFactory::createAsync(
     try
     {
         bool compress;
-        Ice::ConnectionIPtr connection = findConnection(endpoints, compress);
+        Ice::ConnectionIPtr connection = findConnection(endpoints, selType, compress);
         if (connection)
         {
             response(std::move(connection), compress);
@@ -239,11 +249,11 @@ IceInternal::OutgoingConnectionFactory::setRouterInfo(const RouterInfoPtr& route
         //
         endpoint = endpoint->compress(false)->timeout(-1);
 
-        for (const auto& [_, connection] : _connections)
+        for (const auto& [_, entry] : _connections)
         {
-            if (connection->endpoint() == endpoint)
+            if (entry.connection->endpoint() == endpoint)
             {
-                connection->setAdapter(adapter);
+                entry.connection->setAdapter(adapter);
             }
         }
     }
@@ -259,11 +269,11 @@ IceInternal::OutgoingConnectionFactory::removeAdapter(const ObjectAdapterPtr& ad
         return;
     }
 
-    for (const auto& [_, connection] : _connections)
+    for (const auto& [_, entry] : _connections)
     {
-        if (connection->getAdapter() == adapter)
+        if (entry.connection->getAdapter() == adapter)
         {
-            connection->setAdapter(nullptr);
+            entry.connection->setAdapter(nullptr);
         }
     }
 }
@@ -277,11 +287,11 @@ IceInternal::OutgoingConnectionFactory::flushAsyncBatchRequests(
 
     {
         lock_guard lock(_mutex);
-        for (const auto& [_, connection] : _connections)
+        for (const auto& [_, entry] : _connections)
         {
-            if (connection->isActiveOrHolding())
+            if (entry.connection->isActiveOrHolding())
             {
-                c.push_back(connection);
+                c.push_back(entry.connection);
             }
         }
     }
@@ -305,6 +315,7 @@ IceInternal::OutgoingConnectionFactory::removeConnection(const ConnectionIPtr& c
     lock_guard lock(_mutex);
     if (!_destroyed)
     {
+        lock_guard connectionsLock(_connectionsMutex);
         remove(_connections, connection->connector(), connection);
         remove(_connectionsByEndpoint, connection->endpoint(), connection);
         remove(_connectionsByEndpoint, connection->endpoint()->compress(true), connection);
@@ -316,7 +327,9 @@ IceInternal::OutgoingConnectionFactory::OutgoingConnectionFactory(
     const InstancePtr& instance)
     : _communicator(std::move(communicator)),
       _instance(instance),
-      _connectionOptions(instance->clientConnectionOptions())
+      _connectionOptions(instance->clientConnectionOptions()),
+      _connectAttemptDelay(
+          max(instance->initializationData().properties->getIcePropertyAsInt("Ice.ConnectAttemptDelay"), 0))
 {
 }
 
@@ -345,9 +358,12 @@ IceInternal::OutgoingConnectionFactory::setDefaultObjectAdapter(
 }
 
 ConnectionIPtr
-IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr>& endpoints, bool& compress)
+IceInternal::OutgoingConnectionFactory::findConnection(
+    const vector<EndpointIPtr>& endpoints,
+    Ice::EndpointSelectionType selType,
+    bool& compress)
 {
-    lock_guard lock(_mutex);
+    shared_lock lock(_connectionsMutex);
     if (_destroyed)
     {
         throw CommunicatorDestroyedException(__FILE__, __LINE__);
@@ -375,19 +391,29 @@ IceInternal::OutgoingConnectionFactory::findConnection(const vector<EndpointIPtr
             }
             return connection;
         }
+
+        if (selType == Ice::EndpointSelectionType::Latency)
+        {
+            // Only a connection to the fastest endpoint is used: a connection to a slower endpoint doesn't prevent the
+            // establishment of a connection to the fastest endpoint.
+            break;
+        }
     }
     return nullptr;
 }
 
 ConnectionIPtr
-IceInternal::OutgoingConnectionFactory::findConnection(const vector<ConnectorInfo>& connectors, bool& compress)
+IceInternal::OutgoingConnectionFactory::findConnection(
+    const vector<ConnectorInfo>& connectors,
+    const ConnectCallbackPtr& cb,
+    bool& compress)
 {
     // This must be called with the mutex locked.
 
     DefaultsAndOverridesPtr defaultsAndOverrides = _instance->defaultsAndOverrides();
     for (const auto& p : connectors)
     {
-        if (_pending.find(p.connector) != _pending.end())
+        if (_pending.find(p.connector) != _pending.end() || !cb->canReuseConnection(p))
         {
             continue;
         }
@@ -457,7 +483,7 @@ IceInternal::OutgoingConnectionFactory::getConnection(
         }
 
         // Search for an existing connections matching one of the given endpoints.
-        Ice::ConnectionIPtr connection = findConnection(connectors, compress);
+        Ice::ConnectionIPtr connection = findConnection(connectors, cb, compress);
         if (connection)
         {
             return connection;
@@ -531,10 +557,10 @@ IceInternal::OutgoingConnectionFactory::createConnection(const TransceiverPtr& t
         throw;
     }
 
-    _connections.insert(pair<const ConnectorPtr, ConnectionIPtr>(ci.connector, connection));
-    _connectionsByEndpoint.insert(pair<const EndpointIPtr, ConnectionIPtr>(connection->endpoint(), connection));
-    _connectionsByEndpoint.insert(
-        pair<const EndpointIPtr, ConnectionIPtr>(connection->endpoint()->compress(true), connection));
+    lock_guard connectionsLock(_connectionsMutex);
+    insert(_connections, ci.connector, connection);
+    insert(_connectionsByEndpoint, connection->endpoint(), connection);
+    insert(_connectionsByEndpoint, connection->endpoint()->compress(true), connection);
     return connection;
 }
 
@@ -808,22 +834,66 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::ConnectCallback(
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartCompleted(const ConnectionIPtr& connection)
 {
-    if (_observer)
+    optional<ConnectAttempt> attempt;
+    vector<ConnectAttempt> attempts;
     {
-        _observer->detach();
+        lock_guard lock(_mutex);
+        auto p = find_if(
+            _attempts.begin(),
+            _attempts.end(),
+            [&connection](const ConnectAttempt& a) { return a.connection == connection; });
+        if (p == _attempts.end())
+        {
+            return; // Another attempt completed first, this connection is aborted.
+        }
+
+        attempt = std::move(*p);
+        _attempts.erase(p);
+        _done = true;
+        attempts.swap(_attempts);
+    }
+
+    abortAttempts(attempts);
+
+    if (attempt->observer)
+    {
+        attempt->observer->detach();
+    }
+
+    if (_selType == Ice::EndpointSelectionType::Latency)
+    {
+        connection->endpointLatency()->connectionEstablished(chrono::steady_clock::now() - attempt->start);
     }
 
     connection->activate();
-    _factory->finishGetConnection(_connectors, *_iter, connection, shared_from_this());
+    _factory->finishGetConnection(_connectors, attempt->connector, connection, shared_from_this());
 }
 
 void
 IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailed(
-    const ConnectionIPtr& /*connection*/,
+    const ConnectionIPtr& connection,
     exception_ptr ex)
 {
-    assert(_iter != _connectors.end());
-    if (connectionStartFailedImpl(ex))
+    Ice::Instrumentation::ObserverPtr observer;
+    {
+        lock_guard lock(_mutex);
+        auto p = find_if(
+            _attempts.begin(),
+            _attempts.end(),
+            [&connection](const ConnectAttempt& a) { return a.connection == connection; });
+        if (p == _attempts.end())
+        {
+            return; // The connection establishment is already completed, this connection was aborted.
+        }
+        observer = std::move(p->observer);
+        if (_selType == Ice::EndpointSelectionType::Latency)
+        {
+            connection->endpointLatency()->connectionFailed();
+        }
+        _attempts.erase(p);
+    }
+
+    if (connectionStartFailedImpl(observer, ex))
     {
         nextConnector();
     }
@@ -958,27 +1028,64 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
 {
     while (true)
     {
+        vector<ConnectorInfo>::const_iterator connector;
+        {
+            lock_guard lock(_mutex);
+            if (_done || _iter == _connectors.end())
+            {
+                return;
+            }
+            connector = _iter++;
+        }
+
+        Ice::Instrumentation::ObserverPtr observer;
+        const auto start = chrono::steady_clock::now();
         try
         {
             const CommunicatorObserverPtr& obsv = _factory->_instance->initializationData().observer;
             if (obsv)
             {
-                _observer = obsv->getConnectionEstablishmentObserver(_iter->endpoint, _iter->connector->toString());
-                if (_observer)
+                observer =
+                    obsv->getConnectionEstablishmentObserver(connector->endpoint, connector->connector->toString());
+                if (observer)
                 {
-                    _observer->attach();
+                    observer->attach();
                 }
             }
 
-            assert(_iter != _connectors.end());
-
             if (_instance->traceLevels()->network >= 2)
             {
                 Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
-                out << "trying to establish " << _iter->endpoint->protocol() << " connection to "
-                    << _iter->connector->toString();
+                out << "trying to establish " << connector->endpoint->protocol() << " connection to "
+                    << connector->connector->toString();
             }
-            Ice::ConnectionIPtr connection = _factory->createConnection(_iter->connector->connect(), *_iter);
+            Ice::ConnectionIPtr connection = _factory->createConnection(connector->connector->connect(), *connector);
+
+            bool done;
+            {
+                lock_guard lock(_mutex);
+                done = _done;
+                if (!done)
+                {
+                    _attempts.push_back({*connector, connection, observer, start});
+                }
+            }
+
+            if (done)
+            {
+                // Another attempt completed while this connection was created. It's aborted, and startAsync reports
+                // the failure to connectionStartFailed which ignores it.
+                if (observer)
+                {
+                    observer->detach();
+                }
+                connection->abort();
+            }
+            else
+            {
+                scheduleNextConnector();
+            }
+
             auto self = shared_from_this();
             connection->startAsync(
                 [self](const ConnectionIPtr& conn) { self->connectionStartCompleted(conn); },
@@ -989,12 +1096,17 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::nextConnector()
             if (_instance->traceLevels()->network >= 2)
             {
                 Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
-                out << "failed to establish " << _iter->endpoint->protocol() << " connection to "
-                    << _iter->connector->toString() << "\n"
+                out << "failed to establish " << connector->endpoint->protocol() << " connection to "
+                    << connector->connector->toString() << "\n"
                     << ex;
             }
 
-            if (connectionStartFailedImpl(current_exception()))
+            if (_selType == Ice::EndpointSelectionType::Latency)
+            {
+                _instance->endpointLatencyTable()->connectionFailed(connector->endpoint);
+            }
+
+            if (connectionStartFailedImpl(observer, current_exception()))
             {
                 continue; // More connectors to try, continue.
             }
@@ -1032,6 +1144,13 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::hasConnector(const Conn
     return find(_connectors.begin(), _connectors.end(), ci) != _connectors.end();
 }
 
+bool
+IceInternal::OutgoingConnectionFactory::ConnectCallback::canReuseConnection(const ConnectorInfo& ci) const
+{
+    // With the Latency endpoint selection type, only a connection to the fastest endpoint is reused.
+    return _selType != Ice::EndpointSelectionType::Latency || ci.endpoint == _endpoints.front();
+}
+
 bool
 IceInternal::OutgoingConnectionFactory::ConnectCallback::removeConnectors(const vector<ConnectorInfo>& connectors)
 {
@@ -1053,8 +1172,61 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::removeFromPending()
     _factory->removeFromPending(shared_from_this(), _connectors);
 }
 
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::scheduleNextConnector()
+{
+    if (_factory->_connectAttemptDelay == chrono::milliseconds::zero())
+    {
+        return; // The next connector is only tried once the current attempt fails.
+    }
+
+    auto self = shared_from_this();
+    auto task = make_shared<InlineTimerTask>([self] { self->nextConnector(); });
+    TimerTaskPtr previous;
+    {
+        lock_guard lock(_mutex);
+        if (_done || _iter == _connectors.end())
+        {
+            return;
+        }
+        previous = std::exchange(_nextConnectorTask, task);
+    }
+
+    // The delay restarts with each new attempt, including the attempts started because the previous one failed. The
+    // task isn't canceled once the connection establishment is done, nextConnector returns immediately.
+    try
+    {
+        TimerPtr timer = _instance->timer();
+        if (previous)
+        {
+            timer->cancel(previous);
+        }
+        timer->schedule(task, _factory->_connectAttemptDelay);
+    }
+    catch (const CommunicatorDestroyedException&)
+    {
+        // The connection establishments in progress are interrupted by the destruction of the communicator.
+    }
+}
+
+void
+IceInternal::OutgoingConnectionFactory::ConnectCallback::abortAttempts(const vector<ConnectAttempt>& attempts)
+{
+    // The failure of the aborted connections is ignored by connectionStartFailed, they're no longer attempts.
+    for (const auto& attempt : attempts)
+    {
+        if (attempt.observer)
+        {
+            attempt.observer->detach();
+        }
+        attempt.connection->abort();
+    }
+}
+
 bool
-IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedImpl(std::exception_ptr ex)
+IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedImpl(
+    const Ice::Instrumentation::ObserverPtr& observer,
+    std::exception_ptr ex)
 {
     bool communicatorDestroyed = false;
     try
@@ -1069,27 +1241,42 @@ IceInternal::OutgoingConnectionFactory::ConnectCallback::connectionStartFailedIm
     {
     }
 
-    if (_observer)
+    if (observer)
     {
-        _observer->failed(getExceptionId(ex));
-        _observer->detach();
+        observer->failed(getExceptionId(ex));
+        observer->detach();
     }
 
-    _factory->handleConnectionException(ex, _hasMore || _iter != _connectors.end() - 1);
-
-    if (communicatorDestroyed) // No need to continue.
-    {
-        _factory->finishGetConnection(_connectors, ex, shared_from_this());
-    }
-    else if (++_iter != _connectors.end()) // Try the next connector.
+    bool next;
+    bool finish = false;
+    vector<ConnectAttempt> attempts;
     {
-        return true;
+        lock_guard lock(_mutex);
+        if (_done)
+        {
+            return false;
+        }
+
+        next = _iter != _connectors.end();
+        if (communicatorDestroyed || (!next && _attempts.empty())) // No need to continue or nothing left to try.
+        {
+            _done = true;
+            finish = true;
+            attempts.swap(_attempts);
+        }
     }
-    else
+
+    _factory->handleConnectionException(ex, _hasMore || !finish);
+
+    if (finish)
     {
+        abortAttempts(attempts);
         _factory->finishGetConnection(_connectors, ex, shared_from_this());
+        return false;
     }
-    return false;
+
+    // Try the next connector now, or wait for the attempts in progress.
+    return next;
 }
 
 void
@@ -1195,6 +1382,13 @@ IceInternal::IncomingConnectionFactory::endpoint() const
     return _endpoint;
 }
 
+bool
+IceInternal::IncomingConnectionFactory::reusePort() const
+{
+    lock_guard lock(_mutex);
+    return _reusePort;
+}
+
 list<ConnectionIPtr>
 IceInternal::IncomingConnectionFactory::connections() const
 {
@@ -1361,7 +1555,12 @@ IceInternal::IncomingConnectionFactory::message(ThreadPoolCurrent& current)
             if (_instance->traceLevels()->network >= 2)
             {
                 Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
-                out << "trying to accept " << _endpoint->protocol() << " connection\n" << transceiver->toString();
+                out << "trying to accept " << _endpoint->protocol() << " connection";
+                if (_reusePort)
+                {
+                    out << " (acceptor " << _acceptorId << ")";
+                }
+                out << "\n" << transceiver->toString();
             }
         }
         catch (const SocketException& ex)
@@ -1551,7 +1750,8 @@ IceInternal::IncomingConnectionFactory::connectionStartFailed(const Ice::Connect
 IceInternal::IncomingConnectionFactory::IncomingConnectionFactory(
     const InstancePtr& instance,
     const EndpointIPtr& endpoint,
-    const shared_ptr<ObjectAdapterI>& adapter)
+    const shared_ptr<ObjectAdapterI>& adapter,
+    int acceptorId)
     : _instance(instance),
       _connectionOptions(instance->serverConnectionOptions(adapter->getName())),
       _maxConnections(
@@ -1559,6 +1759,8 @@ IceInternal::IncomingConnectionFactory::IncomingConnectionFactory(
               ? 0
               : instance->initializationData().properties->getPropertyAsInt(adapter->getName() + ".MaxConnections")),
       _endpoint(endpoint),
+      _reusePort(acceptorId >= 0),
+      _acceptorId(acceptorId),
       _adapter(adapter),
       _warn(_instance->initializationData().properties->getIcePropertyAsInt("Ice.Warn.Connections") > 0)
 {
@@ -1773,6 +1975,10 @@ IceInternal::IncomingConnectionFactory::createAcceptor()
         assert(!_acceptorStarted);
         _acceptor = _endpoint->acceptor(_adapter->getName(), _adapter->serverAuthenticationOptions());
         assert(_acceptor);
+        if (_reusePort)
+        {
+            _reusePort = _acceptor->setReusePort(); // False if not supported by the transport or the platform.
+        }
         if (_instance->traceLevels()->network >= 2)
         {
             Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
@@ -1783,7 +1989,12 @@ IceInternal::IncomingConnectionFactory::createAcceptor()
         if (_instance->traceLevels()->network >= 1)
         {
             Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
-            out << "listening for " << _endpoint->protocol() << " connections\n" << _acceptor->toDetailedString();
+            out << "listening for " << _endpoint->protocol() << " connections";
+            if (_reusePort)
+            {
+                out << " with SO_REUSEPORT (acceptor " << _acceptorId << ")";
+            }
+            out << "\n" << _acceptor->toDetailedString();
         }
 
         _adapter->getThreadPool()->initialize(shared_from_this());
@@ -16,13 +16,17 @@
 #include "Ice/InstanceF.h"
 #include "Ice/Instrumentation.h"
 #include "Ice/ObjectAdapterF.h"
+#include "Ice/Timer.h"
 #include "RouterInfoF.h"
 #include "TransceiverF.h"
 
+#include <chrono>
 #include <condition_variable>
 #include <list>
 #include <mutex>
 #include <set>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace Ice
 {
@@ -106,11 +110,22 @@ namespace IceInternal
             void setException(std::exception_ptr);
 
             bool hasConnector(const ConnectorInfo&);
+            [[nodiscard]] bool canReuseConnection(const ConnectorInfo&) const;
             bool removeConnectors(const std::vector<ConnectorInfo>&);
             void removeFromPending();
 
         private:
-            bool connectionStartFailedImpl(std::exception_ptr);
+            struct ConnectAttempt
+            {
+                ConnectorInfo connector;
+                Ice::ConnectionIPtr connection;
+                Ice::Instrumentation::ObserverPtr observer;
+                std::chrono::steady_clock::time_point start;
+            };
+
+            bool connectionStartFailedImpl(const Ice::Instrumentation::ObserverPtr&, std::exception_ptr);
+            void scheduleNextConnector();
+            void abortAttempts(const std::vector<ConnectAttempt>&);
 
             const InstancePtr _instance;
             const OutgoingConnectionFactoryPtr _factory;
@@ -119,15 +134,21 @@ namespace IceInternal
             const std::function<void(Ice::ConnectionIPtr, bool)> _createConnectionResponse;
             const std::function<void(std::exception_ptr)> _createConnectionException;
             const Ice::EndpointSelectionType _selType;
-            Ice::Instrumentation::ObserverPtr _observer;
             std::vector<EndpointIPtr>::const_iterator _endpointsIter;
             std::vector<ConnectorInfo> _connectors;
-            std::vector<ConnectorInfo>::const_iterator _iter;
+
+            // Once the connectors are obtained, the members below are protected by _mutex: with a connect attempt
+            // delay, the connection establishments to several connectors run in parallel.
+            std::vector<ConnectorInfo>::const_iterator _iter; // The next connector to try.
+            std::vector<ConnectAttempt> _attempts;           // The connection establishments in progress.
+            TimerTaskPtr _nextConnectorTask;                  // Starts the next attempt after the delay.
+            bool _done{false};                                // Set once a connection is established or all failed.
+            std::mutex _mutex;
         };
         using ConnectCallbackPtr = std::shared_ptr<ConnectCallback>;
         friend class ConnectCallback;
 
-        Ice::ConnectionIPtr findConnection(const std::vector<EndpointIPtr>&, bool&);
+        Ice::ConnectionIPtr findConnection(const std::vector<EndpointIPtr>&, Ice::EndpointSelectionType, bool&);
         void incPendingConnectCount();
         void decPendingConnectCount();
         Ice::ConnectionIPtr getConnection(const std::vector<ConnectorInfo>&, const ConnectCallbackPtr&, bool&);
@@ -141,7 +162,7 @@ namespace IceInternal
         bool addToPending(const ConnectCallbackPtr&, const std::vector<ConnectorInfo>&);
         void removeFromPending(const ConnectCallbackPtr&, const std::vector<ConnectorInfo>&);
 
-        Ice::ConnectionIPtr findConnection(const std::vector<ConnectorInfo>&, bool&);
+        Ice::ConnectionIPtr findConnection(const std::vector<ConnectorInfo>&, const ConnectCallbackPtr&, bool&);
         Ice::ConnectionIPtr createConnection(const TransceiverPtr&, const ConnectorInfo&);
 
         void handleException(std::exception_ptr, bool);
@@ -151,15 +172,32 @@ namespace IceInternal
         const InstancePtr _instance;
         const Ice::ConnectionOptions _connectionOptions;
 
+        // When not zero, the next connector is tried if no connection is established after this delay, while the
+        // previous attempts continue (RFC 8305 connection attempt delay).
+        const std::chrono::milliseconds _connectAttemptDelay;
+
         bool _destroyed{false};
 
         using ConnectCallbackSet = std::set<ConnectCallbackPtr>;
 
-        std::multimap<ConnectorPtr, Ice::ConnectionIPtr, Ice::TargetCompare<ConnectorPtr, std::less>> _connections;
+        // The connections are indexed by the hash of their connector and of their endpoint, computed once when the
+        // connection is inserted. A lookup computes the hash of the searched connector or endpoint and only compares
+        // it with the entries of its bucket which have the same hash.
+        template<typename T> struct ConnectionEntry
+        {
+            T key;
+            Ice::ConnectionIPtr connection;
+        };
+        template<typename T> using ConnectionTable = std::unordered_multimap<std::size_t, ConnectionEntry<T>>;
+
+        ConnectionTable<ConnectorPtr> _connections;
         std::map<ConnectorPtr, ConnectCallbackSet, Ice::TargetCompare<ConnectorPtr, std::less>> _pending;
+        ConnectionTable<EndpointIPtr> _connectionsByEndpoint;
 
-        std::multimap<EndpointIPtr, Ice::ConnectionIPtr, Ice::TargetCompare<EndpointIPtr, std::less>>
-            _connectionsByEndpoint;
+        // The connection tables and _destroyed are modified with both _mutex and _connectionsMutex locked. They can be
+        // read with either of them locked: findConnection(endpoints), called for each proxy without a cached request
+        // handler, only takes a shared lock on _connectionsMutex so concurrent lookups don't contend.
+        mutable std::shared_mutex _connectionsMutex;
         int _pendingConnectCount{0};
         Ice::ObjectAdapterIPtr _defaultObjectAdapter;
         mutable std::mutex _mutex;
@@ -169,7 +207,11 @@ namespace IceInternal
     class IncomingConnectionFactory final : public EventHandler
     {
     public:
-        IncomingConnectionFactory(const InstancePtr&, const EndpointIPtr&, const std::shared_ptr<Ice::ObjectAdapterI>&);
+        IncomingConnectionFactory(
+            const InstancePtr&,
+            const EndpointIPtr&,
+            const std::shared_ptr<Ice::ObjectAdapterI>&,
+            int acceptorId = -1);
         void activate();
         void hold();
         void destroy();
@@ -183,6 +225,7 @@ namespace IceInternal
         void waitUntilFinished();
 
         [[nodiscard]] EndpointIPtr endpoint() const;
+        [[nodiscard]] bool reusePort() const;
         [[nodiscard]] std::list<Ice::ConnectionIPtr> connections() const;
         void removeConnection(const Ice::ConnectionIPtr&) noexcept;
 
@@ -242,6 +285,9 @@ namespace IceInternal
 
         bool _acceptorStarted{false};
         bool _acceptorStopped{false};
+        bool _reusePort; // True if the acceptor listens with SO_REUSEPORT.
+        // The index of the acceptor among the acceptors sharing the endpoint with SO_REUSEPORT, -1 if not shared.
+        const int _acceptorId;
 
         std::shared_ptr<Ice::ObjectAdapterI> _adapter;
         const bool _warn;
@@ -3,6 +3,7 @@
 #include "ConnectionI.h"
 #include "BatchRequestQueue.h"
 #include "CheckIdentity.h"
+#include "Compressor.h"
 #include "Endian.h"
 #include "EndpointI.h"
 #include "Ice/IncomingRequest.h"
@@ -15,6 +16,7 @@
 #include "ObjectAdapterI.h"   // For getThreadPool()
 #include "ReferenceFactory.h" // For createProxy().
 #include "RequestHandler.h"   // For RetryException
+#include "RequestId.h"
 #include "ThreadPool.h"
 #include "TraceLevels.h"
 #include "TraceUtil.h"
@@ -26,10 +28,6 @@
 #include <iomanip>
 #include <stdexcept>
 
-#ifdef ICE_HAS_BZIP2
-#    include <bzlib.h>
-#endif
-
 using namespace std;
 using namespace Ice;
 using namespace Ice::Instrumentation;
@@ -115,6 +113,10 @@ namespace
         ConnectionState::ConnectionStateClosed,     // StateFinished
     };
 
+    // The maximum number of queued messages and bytes coalesced in a single transport write.
+    const size_t maxGatherMessages = 64;
+    const size_t maxGatherSize = 256 * 1024;
+
     string createBadMagicMessage(const byte m[])
     {
         ostringstream os;
@@ -280,7 +282,7 @@ Ice::ConnectionI::OutgoingMessage::adopt(OutputStream* str)
     }
     else if (!str)
     {
-        if (outAsync)
+        if (outAsync && !compressed)
         {
             return; // Adopting request stream is not necessary.
         }
@@ -306,9 +308,13 @@ Ice::ConnectionI::OutgoingMessage::canceled(bool adoptStream)
     {
         adopt(nullptr); // Adopt the request stream
     }
-    else
+    else if (adopted)
     {
-        assert(!adopted);
+        // The message was compressed by compressMessage.
+        assert(compressed);
+        delete stream;
+        stream = nullptr;
+        adopted = false;
     }
 }
 
@@ -571,6 +577,13 @@ Ice::ConnectionI::isActiveOrHolding() const
     return _state > StateNotValidated && _state < StateClosing;
 }
 
+size_t
+Ice::ConnectionI::getOutstandingRequestCount() const
+{
+    std::lock_guard lock(_mutex);
+    return _asyncRequests.size() + _sendStreams.size();
+}
+
 bool
 Ice::ConnectionI::isFinished() const
 {
@@ -659,42 +672,18 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
 {
     OutputStream* os = out->getOs();
 
-    std::lock_guard lock(_mutex);
     //
-    // If the exception is closed before we even have a chance
-    // to send our request, we always try to send the request
-    // again.
+    // Fill in the request ID or the batch request count and compress the message before locking the mutex: the
+    // compression of large requests doesn't block the other threads sending or receiving messages with this
+    // connection.
     //
-    if (_exception)
-    {
-        throw RetryException(_exception);
-    }
-    assert(_state > StateNotValidated);
-    assert(_state < StateClosing);
-
-    //
-    // Ensure the message isn't bigger than what we can send with the
-    // transport.
-    //
-    _transceiver->checkSendSize(*os);
-
-    //
-    // Notify the request that it's cancelable with this connection.
-    // This will throw if the request is canceled.
-    //
-    out->cancelable(shared_from_this());
     int32_t requestId = 0;
     if (response)
     {
         //
         // Create a new unique request ID.
         //
-        requestId = _nextRequestId++;
-        if (requestId <= 0)
-        {
-            _nextRequestId = 1;
-            requestId = _nextRequestId++;
-        }
+        requestId = nextRequestId(_nextRequestId);
 
         //
         // Fill in the request ID.
@@ -722,6 +711,54 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
         }
     }
 
+    OutputStream compressed{currentProtocolEncoding};
+    bool isCompressed = false;
+#ifdef ICE_HAS_BZIP2
+    if (compress)
+    {
+        try
+        {
+            isCompressed = compressMessage(*os, compressed);
+        }
+        catch (const LocalException&)
+        {
+            std::lock_guard lock(_mutex);
+            if (_exception)
+            {
+                throw RetryException(_exception);
+            }
+            setState(StateClosed, current_exception());
+            assert(_exception);
+            rethrow_exception(_exception);
+        }
+    }
+#endif
+
+    std::lock_guard lock(_mutex);
+    //
+    // If the exception is closed before we even have a chance
+    // to send our request, we always try to send the request
+    // again.
+    //
+    if (_exception)
+    {
+        throw RetryException(_exception);
+    }
+    assert(_state > StateNotValidated);
+    assert(_state < StateClosing);
+
+    //
+    // Ensure the message isn't bigger than what we can send with the
+    // transport.
+    //
+    _transceiver->checkSendSize(*os);
+
+    //
+    // Notify the request that it's cancelable with this connection.
+    // This will throw if the request is canceled.
+    //
+    out->cancelable(shared_from_this());
+
     out->attachRemoteObserver(initConnectionInfo(), _endpoint, requestId);
 
     // We're just about to send a request, so we are not inactive anymore.
@@ -730,7 +767,8 @@ Ice::ConnectionI::sendAsyncRequest(const OutgoingAsyncBasePtr& out, bool compres
     AsyncStatus status = AsyncStatusQueued;
     try
     {
-        OutgoingMessage message(out, os, compress, requestId);
+        OutgoingMessage message(out, isCompressed ? &compressed : os, compress, requestId);
+        message.compressed = isCompressed;
         status = sendMessage(message);
     }
     catch (const LocalException&)
@@ -867,6 +905,9 @@ Ice::ConnectionI::asyncRequestCanceled(const OutgoingAsyncBasePtr& outAsync, exc
                 }
                 else
                 {
+                    // Only the message being sent can be partially written: the messages coalesced with it which
+                    // are written are dequeued by sendNextMessages and the others are reset by writeSendStreams.
+                    assert(!o->stream || !o->stream->i);
                     o->canceled(false);
                     _sendStreams.erase(o);
                 }
@@ -986,6 +1027,12 @@ Ice::ConnectionI::endpoint() const
     return _endpoint; // No mutex protection necessary, _endpoint is immutable.
 }
 
+const EndpointLatencyPtr&
+Ice::ConnectionI::endpointLatency() const noexcept
+{
+    return _endpointLatency; // No mutex protection necessary, _endpointLatency is immutable.
+}
+
 ConnectorPtr
 Ice::ConnectionI::connector() const
 {
@@ -1406,6 +1453,12 @@ Ice::ConnectionI::message(ThreadPoolCurrent& current)
                     }
                 }
 
+                if (!_zeroCopyMessages.empty())
+                {
+                    // The completions of the zero-copy sends are collected by the transceiver reads and writes.
+                    releaseZeroCopyMessages();
+                }
+
                 // If the connection is not closed yet, we update the thread pool selector to wait for readiness of
                 // read, write or both operations.
                 if (_state < StateClosed)
@@ -1735,6 +1788,7 @@ Ice::ConnectionI::finish(bool close)
 
         _sendStreams.clear();
     }
+    _zeroCopyMessages.clear();
 
     for (const auto& asyncRequest : _asyncRequests)
     {
@@ -1929,6 +1983,37 @@ Ice::ConnectionI::ConnectionI(
     {
         compressionLevel = 9;
     }
+
+    int32_t compressionThreshold = properties->getIcePropertyAsInt("Ice.Compression.Threshold");
+    const_cast<size_t&>(_compressionThreshold) = static_cast<size_t>(max(compressionThreshold, 0));
+
+    uint8_t& preferredCodec = const_cast<uint8_t&>(_preferredCodec);
+    preferredCodec = _endpoint->compressionCodec();
+    if (!preferredCodec)
+    {
+        string codec = properties->getIceProperty("Ice.Compression.Codec");
+        preferredCodec = codecFromName(codec);
+        if (!preferredCodec)
+        {
+            if (_warn)
+            {
+                Warning out(_logger);
+                out << "unknown compression codec '" << codec << "' in Ice.Compression.Codec, using bzip2";
+            }
+            preferredCodec = bzip2Codec;
+        }
+    }
+
+#ifdef ICE_HAS_BZIP2
+    // Create the compressors used without the mutex locked upfront, see compressMessage and dispatchCompressedRequest.
+    for (uint8_t codec = bzip2Codec; codec < bzip2Codec + codecCount; ++codec)
+    {
+        if (!isStatefulCodec(codec) && (supportedCodecs() & codecBit(codec)))
+        {
+            _compressors[static_cast<size_t>(codec - bzip2Codec)] = createCompressor(codec, _compressionLevel, {});
+        }
+    }
+#endif
 }
 
 Ice::ConnectionIPtr
@@ -1942,6 +2027,28 @@ Ice::ConnectionI::create(
     std::function<void(const ConnectionIPtr&)> removeFromFactory,
     const ConnectionOptions& options)
 {
+    if (!endpoint->datagram())
+    {
+        // Read-ahead is enabled on the connection's own transceiver, before it's decorated. The transceivers of the
+        // transports which don't support it (SSL, WS, ...) ignore this setting.
+        int32_t readAheadSize = instance->initializationData().properties->getIcePropertyAsInt("Ice.TCP.ReadAheadSize");
+        if (readAheadSize > 0)
+        {
+            transceiver->setReadAheadSize(static_cast<size_t>(readAheadSize));
+        }
+    }
+
+    // Likewise for zero-copy sends, which are only supported by TCP transceivers on Linux.
+    bool zeroCopy = false;
+    if (!endpoint->datagram())
+    {
+        int32_t threshold = instance->initializationData().properties->getIcePropertyAsInt("Ice.TCP.ZeroCopyThreshold");
+        if (threshold > 0)
+        {
+            zeroCopy = transceiver->setZeroCopyThreshold(static_cast<size_t>(threshold));
+        }
+    }
+
     shared_ptr<IdleTimeoutTransceiverDecorator> decoratedTransceiver;
     if (options.idleTimeout > chrono::milliseconds::zero() && !endpoint->datagram())
     {
@@ -1959,6 +2066,13 @@ Ice::ConnectionI::create(
         std::move(removeFromFactory),
         options));
 
+    connection->_zeroCopy = zeroCopy;
+
+    if (connector)
+    {
+        connection->_endpointLatency = instance->endpointLatencyTable()->getEndpointLatency(endpoint);
+    }
+
     if (connection->_inactivityTimeout > chrono::seconds::zero())
     {
         connection->_inactivityTimerTask = make_shared<InactivityTimerTask>(connection);
@@ -2460,6 +2574,16 @@ Ice::ConnectionI::sendResponse(OutgoingResponse response, uint8_t compress)
     bool finished = false;
     try
     {
+        // Compress the response before locking the mutex, see compressMessage.
+        OutputStream compressed{currentProtocolEncoding};
+        bool isCompressed = false;
+#ifdef ICE_HAS_BZIP2
+        if (isTwoWay && compress > 0)
+        {
+            isCompressed = compressMessage(response.outputStream(), compressed);
+        }
+#endif
+
         std::unique_lock lock(_mutex);
         assert(_state > StateNotValidated);
 
@@ -2495,7 +2619,8 @@ Ice::ConnectionI::sendResponse(OutgoingResponse response, uint8_t compress)
 
             if (isTwoWay)
             {
-                OutgoingMessage message(&response.outputStream(), compress > 0);
+                OutgoingMessage message(isCompressed ? &compressed : &response.outputStream(), compress > 0);
+                message.compressed = isCompressed;
                 sendMessage(message);
             }
 
@@ -2560,8 +2685,14 @@ Ice::ConnectionI::validate(SocketOperation operation)
                 _writeStream.write(currentProtocol);
                 _writeStream.write(currentProtocolEncoding);
                 _writeStream.write(validateConnectionMsg);
-                _writeStream.write(
-                    static_cast<uint8_t>(0));   // Compression status (always zero for validate connection).
+                // The compression status advertises the compression codecs supported by this server (older
+                // clients ignore it). If the endpoint specifies a codec, we only advertise this codec and bzip2.
+                uint8_t codecs = supportedCodecs();
+                if (uint8_t codec = _endpoint->compressionCodec(); codec && (codecs & codecBit(codec)))
+                {
+                    codecs = codecBit(bzip2Codec) | codecBit(codec);
+                }
+                _writeStream.write(static_cast<uint8_t>(codecAdvertisement | codecs)); // Compression status.
                 _writeStream.write(headerSize); // Message size.
                 _writeStream.i = _writeStream.b.begin();
                 traceSend(_writeStream, _instance, this, _logger, _traceLevels);
@@ -2654,7 +2785,14 @@ Ice::ConnectionI::validate(SocketOperation operation)
                         " over a connection that is not yet validated"};
             }
             uint8_t compress;
-            _readStream.read(compress); // Ignore compression status for validate connection.
+            _readStream.read(compress);
+
+            // Select the compression codec among the codecs advertised by the server. Older servers don't advertise
+            // codecs and only support bzip2.
+            if ((compress & codecAdvertisement) && (compress & supportedCodecs() & codecBit(_preferredCodec)))
+            {
+                _compressionCodec = _preferredCodec;
+            }
             int32_t size;
             _readStream.read(size);
             if (size != headerSize)
@@ -2721,6 +2859,7 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
 
     try
     {
+        SocketOperation pendingOp = SocketOperationNone;
         while (true)
         {
             //
@@ -2731,6 +2870,7 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
             if (message->stream)
             {
                 _writeStream.swap(*message->stream);
+                retainZeroCopyMessage(*message);
                 if (message->sent())
                 {
                     callbacks.push_back(*message);
@@ -2757,59 +2897,14 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
             }
 
             //
-            // Otherwise, prepare the next message.
+            // Otherwise, prepare the next message. It might already be prepared (and even partially or fully
+            // written) if it was coalesced with the previous message by writeSendStreams.
             //
             message = &_sendStreams.front();
-            assert(!message->stream->i);
-#ifdef ICE_HAS_BZIP2
-            if (message->compress && message->stream->b.size() >= 100) // Only compress messages > 100 bytes.
-            {
-                //
-                // Message compressed. Request compressed response, if any.
-                //
-                message->stream->b[9] = byte{2};
-
-                //
-                // Do compression.
-                //
-                OutputStream stream{currentProtocolEncoding};
-                doCompress(*message->stream, stream);
-
-                traceSend(*message->stream, _instance, this, _logger, _traceLevels);
-
-                message->adopt(&stream); // Adopt the compressed stream.
-                message->stream->i = message->stream->b.begin();
-            }
-            else
+            if (!message->stream->i)
             {
-#endif
-                if (message->compress)
-                {
-                    //
-                    // Message not compressed. Request compressed response, if any.
-                    //
-                    message->stream->b[9] = byte{1};
-                }
-
-                //
-                // No compression, just fill in the message size.
-                //
-                auto sz = static_cast<int32_t>(message->stream->b.size());
-                const byte* p = reinterpret_cast<const byte*>(&sz);
-                if constexpr (endian::native == endian::big)
-                {
-                    reverse_copy(p, p + sizeof(int32_t), message->stream->b.begin() + 10);
-                }
-                else
-                {
-                    copy(p, p + sizeof(int32_t), message->stream->b.begin() + 10);
-                }
-                message->stream->i = message->stream->b.begin();
-                traceSend(*message->stream, _instance, this, _logger, _traceLevels);
-
-#ifdef ICE_HAS_BZIP2
+                prepareMessage(*message, true);
             }
-#endif
 
             //
             // Send the message.
@@ -2822,11 +2917,17 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
             assert(_writeStream.i);
             if (_writeStream.i != _writeStream.b.end())
             {
-                SocketOperation op = write(_writeStream);
-                if (op)
+                // If a previous coalesced write couldn't write everything, there's no point in trying again: wait
+                // for the transport to be ready for writing.
+                SocketOperation op = pendingOp ? pendingOp : writeSendStreams();
+                if (op && _writeStream.i != _writeStream.b.end())
                 {
                     return op;
                 }
+
+                // The message is sent but one of the messages coalesced with it might not be fully sent yet. Loop to
+                // dequeue the messages which are sent and return the pending operation once we reach it.
+                pendingOp = op;
             }
             if (_observer)
             {
@@ -2854,6 +2955,157 @@ Ice::ConnectionI::sendNextMessages(vector<OutgoingMessage>& callbacks)
     return SocketOperationNone;
 }
 
+void
+Ice::ConnectionI::prepareMessage(OutgoingMessage& message, bool trace)
+{
+    assert(!message.stream->i);
+    if (message.compressed)
+    {
+        message.stream->i = message.stream->b.begin();
+        return;
+    }
+
+#ifdef ICE_HAS_BZIP2
+    if (message.compress && message.stream->b.size() >= _compressionThreshold)
+    {
+        //
+        // Message compressed. Request compressed response, if any.
+        //
+        message.stream->b[9] = byte{_compressionCodec.load()};
+
+        //
+        // Do compression.
+        //
+        OutputStream stream{currentProtocolEncoding};
+        doCompress(*message.stream, stream);
+
+        traceSend(*message.stream, _instance, this, _logger, _traceLevels);
+
+        message.adopt(&stream); // Adopt the compressed stream.
+        message.stream->i = message.stream->b.begin();
+        return;
+    }
+#endif
+
+    if (message.compress)
+    {
+        //
+        // Message not compressed. Request compressed response, if any.
+        //
+        message.stream->b[9] = byte{1};
+    }
+
+    //
+    // No compression, just fill in the message size.
+    //
+    auto sz = static_cast<int32_t>(message.stream->b.size());
+    const byte* p = reinterpret_cast<const byte*>(&sz);
+    if constexpr (endian::native == endian::big)
+    {
+        reverse_copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+    }
+    else
+    {
+        copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+    }
+    message.stream->i = message.stream->b.begin();
+    if (trace)
+    {
+        traceSend(*message.stream, _instance, this, _logger, _traceLevels);
+    }
+}
+
+SocketOperation
+Ice::ConnectionI::writeSendStreams()
+{
+#if !defined(ICE_USE_IOCP)
+    if (_sendStreams.size() > 1 && !_endpoint->datagram())
+    {
+        //
+        // Coalesce the messages queued after the message being sent (_writeStream) to write them with a single
+        // transport call. Only messages which don't require compression or which are already compressed are
+        // coalesced: preparing a message for compression makes it adopt the compressed stream, and a message that is
+        // not being sent must not own a different stream than the one of its outgoing request (it can still be
+        // canceled and retried).
+        //
+        // The messages from firstPrepared are prepared by this call. They're traced once some of their bytes are
+        // written, the messages which aren't written at all are reset to be prepared again when they're sent.
+        //
+        _gatherBuffers.clear();
+        _gatherBuffers.push_back(&_writeStream);
+        auto gatheredSize = static_cast<size_t>(_writeStream.b.end() - _writeStream.i);
+        size_t firstPrepared = 0;
+        for (auto p = _sendStreams.begin() + 1; p != _sendStreams.end(); ++p)
+        {
+            if (_gatherBuffers.size() >= maxGatherMessages || gatheredSize >= maxGatherSize)
+            {
+                break;
+            }
+
+            if (!p->stream->i)
+            {
+#ifdef ICE_HAS_BZIP2
+                if (!p->compressed && p->compress && p->stream->b.size() >= _compressionThreshold)
+                {
+                    break;
+                }
+#endif
+                prepareMessage(*p, false);
+                if (!firstPrepared)
+                {
+                    firstPrepared = _gatherBuffers.size();
+                }
+            }
+            _gatherBuffers.push_back(p->stream);
+            gatheredSize += static_cast<size_t>(p->stream->b.end() - p->stream->i);
+        }
+
+        if (_gatherBuffers.size() > 1)
+        {
+            // The write stream bytes are reported to the observer by the caller with finishWrite, we report the bytes
+            // of the coalesced messages here.
+            size_t coalescedSize = gatheredSize - static_cast<size_t>(_writeStream.b.end() - _writeStream.i);
+            SocketOperation op = _transceiver->writev(_gatherBuffers);
+
+            size_t remaining = 0;
+            for (auto p = _gatherBuffers.begin(); p != _gatherBuffers.end(); ++p)
+            {
+                remaining += static_cast<size_t>((*p)->b.end() - (*p)->i);
+            }
+            size_t coalescedRemaining = remaining - static_cast<size_t>(_writeStream.b.end() - _writeStream.i);
+
+            for (size_t j = firstPrepared ? firstPrepared : _gatherBuffers.size(); j < _gatherBuffers.size(); ++j)
+            {
+                OutgoingMessage& message = _sendStreams[j];
+                if (message.stream->i == message.stream->b.begin())
+                {
+                    message.stream->i = nullptr;
+                }
+                else if (!message.compressed)
+                {
+                    traceSend(*message.stream, _instance, this, _logger, _traceLevels);
+                }
+            }
+
+            if (_instance->traceLevels()->network >= 3 && remaining != gatheredSize)
+            {
+                Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+                out << "sent " << (gatheredSize - remaining) << " of " << gatheredSize << " bytes via "
+                    << _endpoint->protocol() << " (" << _gatherBuffers.size() << " messages)\n"
+                    << toString();
+            }
+
+            if (_observer && coalescedRemaining != coalescedSize)
+            {
+                _observer->sentBytes(static_cast<int>(coalescedSize - coalescedRemaining));
+            }
+            return op;
+        }
+    }
+#endif
+    return write(_writeStream);
+}
+
 AsyncStatus
 Ice::ConnectionI::sendMessage(OutgoingMessage& message)
 {
@@ -2875,12 +3127,12 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     message.stream->i = message.stream->b.begin();
     SocketOperation op;
 #ifdef ICE_HAS_BZIP2
-    if (message.compress && message.stream->b.size() >= 100) // Only compress messages larger than 100 bytes.
+    if (!message.compressed && message.compress && message.stream->b.size() >= _compressionThreshold)
     {
         //
         // Message compressed. Request compressed response, if any.
         //
-        message.stream->b[9] = byte{2};
+        message.stream->b[9] = byte{_compressionCodec.load()};
 
         //
         // Do compression.
@@ -2903,6 +3155,13 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
                 _observer.finishWrite(stream);
             }
 
+            if (_zeroCopy)
+            {
+                // The compressed stream is a local variable, the message must own it to retain it.
+                message.adopt(&stream);
+                retainZeroCopyMessage(message);
+            }
+
             AsyncStatus status = AsyncStatusSent;
             if (message.sent())
             {
@@ -2917,30 +3176,33 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     else
     {
 #endif
-        if (message.compress)
+        if (!message.compressed)
         {
+            if (message.compress)
+            {
+                //
+                // Message not compressed. Request compressed response, if any.
+                //
+                message.stream->b[9] = byte{1};
+            }
+
             //
-            // Message not compressed. Request compressed response, if any.
+            // No compression, just fill in the message size.
             //
-            message.stream->b[9] = byte{1};
-        }
+            auto sz = static_cast<int32_t>(message.stream->b.size());
+            const byte* p = reinterpret_cast<const byte*>(&sz);
+            if constexpr (endian::native == endian::big)
+            {
+                reverse_copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+            }
+            else
+            {
+                copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+            }
+            message.stream->i = message.stream->b.begin();
 
-        //
-        // No compression, just fill in the message size.
-        //
-        auto sz = static_cast<int32_t>(message.stream->b.size());
-        const byte* p = reinterpret_cast<const byte*>(&sz);
-        if constexpr (endian::native == endian::big)
-        {
-            reverse_copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
-        }
-        else
-        {
-            copy(p, p + sizeof(int32_t), message.stream->b.begin() + 10);
+            traceSend(*message.stream, _instance, this, _logger, _traceLevels);
         }
-        message.stream->i = message.stream->b.begin();
-
-        traceSend(*message.stream, _instance, this, _logger, _traceLevels);
 
         if (_observer)
         {
@@ -2953,6 +3215,7 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
             {
                 _observer.finishWrite(*message.stream);
             }
+            retainZeroCopyMessage(message);
             AsyncStatus status = AsyncStatusSent;
             if (message.sent())
             {
@@ -2977,66 +3240,75 @@ Ice::ConnectionI::sendMessage(OutgoingMessage& message)
     return AsyncStatusQueued;
 }
 
-#ifdef ICE_HAS_BZIP2
-static string
-getBZ2Error(int bzError)
+void
+Ice::ConnectionI::retainZeroCopyMessage(OutgoingMessage& message)
 {
-    if (bzError == BZ_RUN_OK)
-    {
-        return ": BZ_RUN_OK";
-    }
-    else if (bzError == BZ_FLUSH_OK)
+    if (!_zeroCopy)
     {
-        return ": BZ_FLUSH_OK";
-    }
-    else if (bzError == BZ_FINISH_OK)
-    {
-        return ": BZ_FINISH_OK";
-    }
-    else if (bzError == BZ_STREAM_END)
-    {
-        return ": BZ_STREAM_END";
-    }
-    else if (bzError == BZ_CONFIG_ERROR)
-    {
-        return ": BZ_CONFIG_ERROR";
-    }
-    else if (bzError == BZ_SEQUENCE_ERROR)
-    {
-        return ": BZ_SEQUENCE_ERROR";
-    }
-    else if (bzError == BZ_PARAM_ERROR)
-    {
-        return ": BZ_PARAM_ERROR";
-    }
-    else if (bzError == BZ_MEM_ERROR)
-    {
-        return ": BZ_MEM_ERROR";
+        return;
     }
-    else if (bzError == BZ_DATA_ERROR)
+
+    releaseZeroCopyMessages();
+
+    // If all the zero-copy sends are completed, the kernel no longer references the message buffer.
+    uint32_t sent = _transceiver->zeroCopySent();
+    if (sent == _transceiver->zeroCopyCompleted())
     {
-        return ": BZ_DATA_ERROR";
+        return;
     }
-    else if (bzError == BZ_DATA_ERROR_MAGIC)
+
+    ZeroCopyMessage retained{sent, message.outAsync, nullptr};
+    if (!message.adopted && (!message.outAsync || message.compressed))
     {
-        return ": BZ_DATA_ERROR_MAGIC";
+        message.adopt(nullptr); // Moves the stream buffer to a heap allocated stream, it doesn't copy it.
     }
-    else if (bzError == BZ_IO_ERROR)
+    if (message.adopted)
     {
-        return ": BZ_IO_ERROR";
+        // Take ownership of the stream, sent() no longer deletes it.
+        retained.stream.reset(message.stream);
+        message.adopted = false;
     }
-    else if (bzError == BZ_UNEXPECTED_EOF)
+    // Otherwise, the retained outgoing request keeps its stream alive.
+    _zeroCopyMessages.push_back(std::move(retained));
+}
+
+void
+Ice::ConnectionI::releaseZeroCopyMessages()
+{
+    uint32_t completed = _transceiver->zeroCopyCompleted();
+    while (!_zeroCopyMessages.empty() &&
+           static_cast<int32_t>(completed - _zeroCopyMessages.front().sequence) >= 0)
     {
-        return ": BZ_UNEXPECTED_EOF";
+        _zeroCopyMessages.pop_front();
     }
-    else if (bzError == BZ_OUTBUFF_FULL)
+}
+
+#ifdef ICE_HAS_BZIP2
+Compressor&
+Ice::ConnectionI::compressor(uint8_t codec)
+{
+    assert(codec >= bzip2Codec);
+    if (codec - bzip2Codec >= static_cast<int>(_compressors.size()))
     {
-        return ": BZ_OUTBUFF_FULL";
+        throw ProtocolException{
+            __FILE__,
+            __LINE__,
+            "received Ice message with unknown compression status " + to_string(codec)};
     }
-    else
+
+    CompressorPtr& compressor = _compressors[static_cast<size_t>(codec - bzip2Codec)];
+    if (!compressor)
     {
-        return "";
+        compressor = createCompressor(codec, _compressionLevel, _instance->compressionDictionary());
+        if (!compressor)
+        {
+            throw FeatureNotSupportedException{
+                __FILE__,
+                __LINE__,
+                "cannot uncompress message compressed with " + string{codecName(codec)}};
+        }
     }
+    return *compressor;
 }
 
 void
@@ -3045,26 +3317,16 @@ Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compresse
     const byte* p;
 
     //
-    // Compress the message body, but not the header.
+    // Compress the message body, but not the header. The codec is the compression status of the header.
     //
-    auto uncompressedLen = static_cast<unsigned int>(uncompressed.b.size() - headerSize);
-    auto compressedLen = static_cast<unsigned int>(uncompressedLen * 1.01 + 600);
-    compressed.b.resize(headerSize + sizeof(int32_t) + compressedLen);
-    int bzError = BZ2_bzBuffToBuffCompress(
-        reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(int32_t),
-        &compressedLen,
-        reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
+    Compressor& codec = compressor(static_cast<uint8_t>(uncompressed.b[9]));
+    size_t uncompressedLen = uncompressed.b.size() - headerSize;
+    compressed.b.resize(headerSize + sizeof(int32_t) + codec.compressBound(uncompressedLen));
+    size_t compressedLen = codec.compress(
+        &uncompressed.b[0] + headerSize,
         uncompressedLen,
-        _compressionLevel,
-        0,
-        0);
-    if (bzError != BZ_OK)
-    {
-        throw ProtocolException{
-            __FILE__,
-            __LINE__,
-            "cannot compress message - BZ2_bzBuffToBuffCompress failed" + getBZ2Error(bzError)};
-    }
+        &compressed.b[0] + headerSize + sizeof(int32_t),
+        compressed.b.size() - headerSize - sizeof(int32_t));
     compressed.b.resize(headerSize + sizeof(int32_t) + compressedLen);
 
     //
@@ -3107,6 +3369,8 @@ Ice::ConnectionI::doCompress(OutputStream& uncompressed, OutputStream& compresse
 void
 Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompressed)
 {
+    Compressor& codec = compressor(static_cast<uint8_t>(compressed.b[9]));
+
     int32_t uncompressedSize;
     compressed.i = compressed.b.begin() + headerSize;
     compressed.read(uncompressedSize);
@@ -3124,24 +3388,60 @@ Ice::ConnectionI::doUncompress(InputStream& compressed, InputStream& uncompresse
     }
     uncompressed.resize(static_cast<size_t>(uncompressedSize));
 
-    auto uncompressedLen = static_cast<unsigned int>(uncompressedSize - headerSize);
-    auto compressedLen = static_cast<unsigned int>(compressed.b.size() - headerSize - sizeof(int32_t));
-    int bzError = BZ2_bzBuffToBuffDecompress(
-        reinterpret_cast<char*>(&uncompressed.b[0]) + headerSize,
-        &uncompressedLen,
-        reinterpret_cast<char*>(&compressed.b[0]) + headerSize + sizeof(int32_t),
-        compressedLen,
-        0,
-        0);
-    if (bzError != BZ_OK)
+    codec.decompress(
+        &compressed.b[0] + headerSize + sizeof(int32_t),
+        compressed.b.size() - headerSize - sizeof(int32_t),
+        &uncompressed.b[0] + headerSize,
+        static_cast<size_t>(uncompressedSize - headerSize));
+
+    copy(compressed.b.begin(), compressed.b.begin() + headerSize, uncompressed.b.begin());
+}
+
+bool
+Ice::ConnectionI::compressMessage(OutputStream& uncompressed, OutputStream& compressed)
+{
+    // Called without the mutex locked: only the compressors created by the constructor can be used here.
+    uint8_t codec = _compressionCodec;
+    if (uncompressed.b.size() < _compressionThreshold || isStatefulCodec(codec) ||
+        !_compressors[static_cast<size_t>(codec - bzip2Codec)])
     {
-        throw ProtocolException{
-            __FILE__,
-            __LINE__,
-            "cannot decompress message - BZ2_bzBuffToBuffDecompress failed" + getBZ2Error(bzError)};
+        return false;
     }
 
-    copy(compressed.b.begin(), compressed.b.begin() + headerSize, uncompressed.b.begin());
+    //
+    // Message compressed. Request compressed response, if any.
+    //
+    uncompressed.b[9] = byte{codec};
+    doCompress(uncompressed, compressed);
+    traceSend(uncompressed, _instance, this, _logger, _traceLevels);
+    return true;
+}
+
+void
+Ice::ConnectionI::dispatchCompressedRequest(
+    InputStream& stream,
+    uint8_t compress,
+    const ObjectAdapterIPtr& adapter)
+{
+    // Note: like dispatchAll, this operation must be called *without* the mutex locked.
+
+    int32_t requestId;
+    try
+    {
+        InputStream ustream{_instance.get(), currentProtocolEncoding};
+        doUncompress(stream, ustream);
+        stream.b.swap(ustream.b);
+        stream.i = stream.b.begin() + headerSize;
+
+        traceRecv(stream, this, _logger, _traceLevels);
+        stream.read(requestId);
+    }
+    catch (...)
+    {
+        dispatchException(current_exception(), 1); // Fatal invocation exception
+        return;
+    }
+    dispatchAll(stream, 1, requestId, compress, adapter);
 }
 #endif
 
@@ -3171,12 +3471,28 @@ Ice::ConnectionI::parseMessage(int32_t& upcallCount, function<bool(InputStream&)
         uint8_t compress;
         stream.read(compress);
 
-        if (compress == 2)
+        // A request compressed with a codec which doesn't keep state across messages is uncompressed by the upcall,
+        // without the mutex locked. Other messages are uncompressed here: the request ID of replies and the request
+        // count of batch requests are part of the compressed message body.
+        bool uncompressInUpcall = false;
+        if (compress >= bzip2Codec)
         {
 #ifdef ICE_HAS_BZIP2
-            InputStream ustream{_instance.get(), currentProtocolEncoding};
-            doUncompress(stream, ustream);
-            stream.b.swap(ustream.b);
+            uncompressInUpcall = messageType == requestMsg && _state < StateClosing && !isStatefulCodec(compress) &&
+                                 compress - bzip2Codec < static_cast<int>(_compressors.size()) &&
+                                 _compressors[static_cast<size_t>(compress - bzip2Codec)];
+            if (!uncompressInUpcall)
+            {
+                InputStream ustream{_instance.get(), currentProtocolEncoding};
+                doUncompress(stream, ustream);
+                stream.b.swap(ustream.b);
+            }
+
+            // The client compresses its messages with a codec we advertised, reply with the same codec.
+            if (!_connector)
+            {
+                _compressionCodec = compress;
+            }
 #else
             throw FeatureNotSupportedException(__FILE__, __LINE__, "Cannot uncompress compressed message");
 #endif
@@ -3225,6 +3541,21 @@ Ice::ConnectionI::parseMessage(int32_t& upcallCount, function<bool(InputStream&)
                         _logger,
                         _traceLevels);
                 }
+                else if (uncompressInUpcall)
+                {
+#ifdef ICE_HAS_BZIP2
+                    auto adapter = _adapter;
+                    upcall = [self = shared_from_this(), adapter, compress](InputStream& messageStream)
+                    {
+                        self->dispatchCompressedRequest(messageStream, compress, adapter);
+                        return false; // the upcall will be completed once the dispatch is done.
+                    };
+                    ++upcallCount;
+
+                    cancelInactivityTimerTask();
+                    ++_dispatchCount;
+#endif
+                }
                 else
                 {
                     traceRecv(stream, this, _logger, _traceLevels);
@@ -3,10 +3,12 @@
 #ifndef ICE_CONNECTION_I_H
 #define ICE_CONNECTION_I_H
 
+#include "Compressor.h"
 #include "ConnectionFactoryF.h"
 #include "ConnectionOptions.h"
 #include "ConnectorF.h"
 #include "EndpointIF.h"
+#include "EndpointLatencyTable.h"
 #include "EventHandler.h"
 #include "Ice/BatchRequestQueueF.h"
 #include "Ice/CommunicatorF.h"
@@ -25,10 +27,13 @@
 #include "TraceLevelsF.h"
 #include "TransceiverF.h"
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <list>
+#include <memory>
 #include <mutex>
 
 #ifndef ICE_HAS_BZIP2
@@ -81,7 +86,8 @@ namespace Ice
                 : stream(str),
                   compress(comp),
                   requestId(0),
-                  adopted(false)
+                  adopted(false),
+                  compressed(false)
 #if defined(ICE_USE_IOCP)
                   ,
                   isSent(false),
@@ -100,7 +106,8 @@ namespace Ice
                   outAsync(std::move(o)),
                   compress(comp),
                   requestId(rid),
-                  adopted(false)
+                  adopted(false),
+                  compressed(false)
 #if defined(ICE_USE_IOCP)
                   ,
                   isSent(false),
@@ -122,6 +129,7 @@ namespace Ice
             bool compress;
             int requestId;
             bool adopted;
+            bool compressed; // True if the stream was compressed (and traced) before being passed to sendMessage.
 #if defined(ICE_USE_IOCP)
             bool isSent;
             bool invokeSent;
@@ -148,6 +156,9 @@ namespace Ice
         [[nodiscard]] bool isActiveOrHolding() const;
         [[nodiscard]] bool isFinished() const;
 
+        // Returns the number of requests waiting for a reply plus the number of messages waiting to be sent.
+        [[nodiscard]] std::size_t getOutstandingRequestCount() const;
+
         void throwException() const final; // From Connection. Throws the connection exception if destroyed.
 
         void waitUntilHolding() const;
@@ -181,6 +192,7 @@ namespace Ice
 
         [[nodiscard]] IceInternal::EndpointIPtr endpoint() const;
         [[nodiscard]] IceInternal::ConnectorPtr connector() const;
+        [[nodiscard]] const IceInternal::EndpointLatencyPtr& endpointLatency() const noexcept;
 
         void setAdapter(const ObjectAdapterPtr&) final;                   // From Connection.
         [[nodiscard]] ObjectAdapterPtr getAdapter() const noexcept final; // From Connection.
@@ -295,15 +307,55 @@ namespace Ice
         /// pending message being sent (_sendStreams.First).
         IceInternal::SocketOperation sendNextMessages(std::vector<OutgoingMessage>& callbacks);
 
+        /// Fills in the header of the given queued message and compresses it if requested. Once prepared, the
+        /// message stream iterator is set to the beginning of the stream.
+        /// @param message The message to prepare.
+        /// @param trace Whether or not to trace the message. A message coalesced by writeSendStreams is only traced
+        /// once some of its bytes are written.
+        void prepareMessage(OutgoingMessage& message, bool trace);
+
+        /// Writes the message being sent (_writeStream) together with as many of the following queued messages as
+        /// the transport accepts in a single gather write. The coalesced messages are prepared if needed and their
+        /// stream iterators are advanced by the number of bytes written. The stream iterator of a message prepared by
+        /// this call is reset if none of its bytes are written: it's not part of the batch and can still be canceled.
+        /// @return The socket operation to wait for if _writeStream or one of the coalesced messages couldn't be
+        /// fully written.
+        IceInternal::SocketOperation writeSendStreams();
+
         /// Sends or queues the given message.
         ///
         /// @param message The message to send.
         /// @return The send status.
         IceInternal::AsyncStatus sendMessage(OutgoingMessage& message);
 
+        /// Keeps the buffer of a message sent with MSG_ZEROCOPY alive until the kernel no longer references it. This
+        /// must be called before the message's sent() function releases its stream.
+        /// @param message The message which was just sent.
+        void retainZeroCopyMessage(OutgoingMessage& message);
+
+        /// Releases the buffers of the zero-copy sends completed by the kernel.
+        void releaseZeroCopyMessages();
+
 #ifdef ICE_HAS_BZIP2
+        /// Gets the compressor of the given codec, creating it if necessary.
+        /// @param codec The codec of the compressor.
+        /// @return The compressor.
+        /// @throws Ice::FeatureNotSupportedException Thrown if the codec is not supported by this build.
+        IceInternal::Compressor& compressor(std::uint8_t codec);
+
         void doCompress(Ice::OutputStream&, Ice::OutputStream&);
         void doUncompress(Ice::InputStream&, Ice::InputStream&);
+
+        /// Compresses a message without the connection mutex locked, before it's passed to sendMessage. Only
+        /// messages compressed with a codec which doesn't keep state across messages can be compressed this way.
+        /// @param uncompressed The message to compress.
+        /// @param compressed The stream that receives the compressed message.
+        /// @return true if the message is compressed, false if sendMessage takes care of the message compression.
+        bool compressMessage(Ice::OutputStream& uncompressed, Ice::OutputStream& compressed);
+
+        /// Uncompresses a request received with a codec which doesn't keep state across messages and dispatches it.
+        /// Like dispatchAll, it must be called without the connection mutex locked.
+        void dispatchCompressedRequest(Ice::InputStream&, std::uint8_t, const ObjectAdapterIPtr&);
 #endif
 
         IceInternal::SocketOperation parseMessage(
@@ -335,6 +387,10 @@ namespace Ice
         const IceInternal::ConnectorPtr _connector;
         const IceInternal::EndpointIPtr _endpoint;
 
+        // The latency of the endpoint of an outgoing connection, null for an incoming connection. Set by create and
+        // immutable afterwards.
+        IceInternal::EndpointLatencyPtr _endpointLatency;
+
         mutable Ice::ConnectionInfoPtr _info;
 
         ObjectAdapterIPtr _adapter;
@@ -365,7 +421,28 @@ namespace Ice
 
         const int _compressionLevel{1};
 
-        std::int32_t _nextRequestId{1};
+        // Messages smaller than this size are not compressed, see Ice.Compression.Threshold.
+        const std::size_t _compressionThreshold{100};
+
+        // The codec this side would like to compress messages with: the codec of the endpoint if it specifies one,
+        // Ice.Compression.Codec otherwise.
+        const std::uint8_t _preferredCodec{IceInternal::bzip2Codec};
+
+        // The codec used to compress the messages sent over this connection. A client connection selects it when it
+        // receives the codecs supported by the server with the ValidateConnection message. A server connection uses
+        // the codec of the last compressed message it received from the client. It's bzip2 until then since all
+        // peers support bzip2.
+        // It's atomic since messages are compressed without the mutex locked.
+        std::atomic<std::uint8_t> _compressionCodec{IceInternal::bzip2Codec};
+
+        // The compressors, indexed by codec - bzip2Codec. The compressors which don't keep state across messages are
+        // created by the constructor and are used without the mutex locked. A compressor which keeps state across
+        // messages (zstd-stream) is created on first use and is only used with the mutex locked: it compresses the
+        // messages sent over this connection as one stream and decompresses the messages received as another stream.
+        std::array<IceInternal::CompressorPtr, IceInternal::codecCount> _compressors;
+
+        // The request ID is allocated before the request is compressed, without the mutex locked.
+        std::atomic<std::int32_t> _nextRequestId{1};
 
         std::map<std::int32_t, IceInternal::OutgoingAsyncBasePtr> _asyncRequests;
         std::map<std::int32_t, IceInternal::OutgoingAsyncBasePtr>::iterator _asyncRequestsHint;
@@ -389,6 +466,22 @@ namespace Ice
         // Contains the message which is being sent. The write stream buffer is empty if no message is being sent.
         Ice::OutputStream _writeStream;
 
+        // The buffers passed to the transceiver when coalescing queued messages, see writeSendStreams.
+        std::vector<IceInternal::Buffer*> _gatherBuffers;
+
+        // A message whose buffer might still be referenced by the kernel after a zero-copy send. The buffer is
+        // either owned by the stream or by the outgoing request.
+        struct ZeroCopyMessage
+        {
+            std::uint32_t sequence;
+            IceInternal::OutgoingAsyncBasePtr outAsync;
+            std::unique_ptr<Ice::OutputStream> stream;
+        };
+
+        // True if the transceiver sends large messages with MSG_ZEROCOPY, see Ice.TCP.ZeroCopyThreshold.
+        bool _zeroCopy{false};
+        std::deque<ZeroCopyMessage> _zeroCopyMessages;
+
         Observer _observer;
 
         // The upcall count keeps track of the number of dispatches, AMI (response) continuations, sent callbacks and
@@ -0,0 +1,72 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "ConnectionPoolRequestHandler.h"
+#include "ConnectionI.h"
+#include "Ice/OutgoingAsync.h"
+
+#include <limits>
+
+using namespace std;
+using namespace IceInternal;
+
+ConnectionPoolRequestHandler::ConnectionPoolRequestHandler(
+    const ReferencePtr& reference,
+    vector<RequestHandlerPtr> handlers)
+    : RequestHandler(reference),
+      _handlers(std::move(handlers))
+{
+    assert(!_handlers.empty());
+}
+
+AsyncStatus
+ConnectionPoolRequestHandler::sendAsyncRequest(const ProxyOutgoingAsyncBasePtr& out)
+{
+    return selectHandler()->sendAsyncRequest(out);
+}
+
+void
+ConnectionPoolRequestHandler::asyncRequestCanceled(const OutgoingAsyncBasePtr&, std::exception_ptr)
+{
+    // The request is canceled with the handler of the pool, or the connection, that it was sent with.
+    assert(false);
+}
+
+Ice::ConnectionIPtr
+ConnectionPoolRequestHandler::getConnection()
+{
+    return selectHandler()->getConnection();
+}
+
+const RequestHandlerPtr&
+ConnectionPoolRequestHandler::selectHandler()
+{
+    // The scan starts with a different handler for each request, so that requests are spread over the connections
+    // which have the same number of outstanding requests. A connection which is not established yet is considered idle,
+    // its handler queues the requests until the connection is established.
+    const size_t start = _next.fetch_add(1, memory_order_relaxed);
+    size_t selected = start % _handlers.size();
+    size_t fewest = numeric_limits<size_t>::max();
+    for (size_t i = 0; i < _handlers.size() && fewest > 0; ++i)
+    {
+        const size_t index = (start + i) % _handlers.size();
+        Ice::ConnectionIPtr connection;
+        try
+        {
+            connection = _handlers[index]->getConnection();
+        }
+        catch (...)
+        {
+            // The connection establishment failed, sending the request with this handler raises the failure and the
+            // invocation is retried with a new request handler.
+            continue;
+        }
+
+        const size_t count = connection ? connection->getOutstandingRequestCount() : 0;
+        if (count < fewest)
+        {
+            fewest = count;
+            selected = index;
+        }
+    }
+    return _handlers[selected];
+}
@@ -0,0 +1,35 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_CONNECTION_POOL_REQUEST_HANDLER_H
+#define ICE_CONNECTION_POOL_REQUEST_HANDLER_H
+
+#include "Ice/ReferenceF.h"
+#include "RequestHandler.h"
+
+#include <atomic>
+#include <vector>
+
+namespace IceInternal
+{
+    // A request handler for a reference with a connection pool. It holds a request handler for each connection of the
+    // pool and sends each request with the handler whose connection has the fewest outstanding requests.
+    class ConnectionPoolRequestHandler final : public RequestHandler
+    {
+    public:
+        ConnectionPoolRequestHandler(const ReferencePtr&, std::vector<RequestHandlerPtr>);
+
+        AsyncStatus sendAsyncRequest(const ProxyOutgoingAsyncBasePtr&) final;
+
+        void asyncRequestCanceled(const OutgoingAsyncBasePtr&, std::exception_ptr) final;
+
+        Ice::ConnectionIPtr getConnection() final;
+
+    private:
+        const RequestHandlerPtr& selectHandler();
+
+        const std::vector<RequestHandlerPtr> _handlers;
+        std::atomic<std::size_t> _next{0};
+    };
+}
+
+#endif
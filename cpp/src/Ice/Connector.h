@@ -6,6 +6,7 @@
 #include "ConnectorF.h"
 #include "TransceiverF.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -28,6 +29,9 @@ namespace IceInternal
 
         virtual bool operator==(const Connector&) const = 0;
         virtual bool operator<(const Connector&) const = 0;
+
+        // Returns a hash consistent with operator==, used to index the connections of the outgoing connection factory.
+        [[nodiscard]] virtual std::size_t hash() const noexcept = 0;
     };
 }
 
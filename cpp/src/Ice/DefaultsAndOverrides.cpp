@@ -46,6 +46,15 @@ IceInternal::DefaultsAndOverrides::DefaultsAndOverrides(const PropertiesPtr& pro
     const_cast<bool&>(defaultCollocationOptimization) =
         properties->getIcePropertyAsInt("Ice.Default.CollocationOptimized") > 0;
 
+    const_cast<int&>(defaultConnectionPoolSize) = properties->getIcePropertyAsInt("Ice.Default.ConnectionPoolSize");
+    if (defaultConnectionPoolSize < 1)
+    {
+        throw InitializationException{
+            __FILE__,
+            __LINE__,
+            "invalid value for Ice.Default.ConnectionPoolSize: " + to_string(defaultConnectionPoolSize)};
+    }
+
     value = properties->getIceProperty("Ice.Default.EndpointSelection");
     if (value == "Random")
     {
@@ -55,9 +64,16 @@ IceInternal::DefaultsAndOverrides::DefaultsAndOverrides(const PropertiesPtr& pro
     {
         defaultEndpointSelection = EndpointSelectionType::Ordered;
     }
+    else if (value == "Latency")
+    {
+        defaultEndpointSelection = EndpointSelectionType::Latency;
+    }
     else
     {
-        throw ParseException(__FILE__, __LINE__, "illegal value '" + value + "'; expected 'Random' or 'Ordered'");
+        throw ParseException(
+            __FILE__,
+            __LINE__,
+            "illegal value '" + value + "'; expected 'Random', 'Ordered' or 'Latency'");
     }
 
     const_cast<chrono::milliseconds&>(defaultInvocationTimeout) =
@@ -24,6 +24,7 @@ namespace IceInternal
         Address defaultSourceAddress;
         std::string defaultProtocol;
         bool defaultCollocationOptimization;
+        int defaultConnectionPoolSize;
         Ice::EndpointSelectionType defaultEndpointSelection;
         std::chrono::milliseconds defaultInvocationTimeout;
         std::chrono::seconds defaultLocatorCacheTimeout;
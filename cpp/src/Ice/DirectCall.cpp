@@ -0,0 +1,203 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/DirectCall.h"
+#include "CollocatedRequestHandler.h"
+#include "Ice/Demangle.h"
+#include "Ice/ImplicitContext.h"
+#include "Ice/LocalExceptions.h"
+#include "Ice/UserException.h"
+#include "Instance.h"
+#include "LoggerMiddleware.h"
+#include "ObjectAdapterFactory.h"
+#include "ObjectAdapterI.h"
+#include "Reference.h"
+#include "RequestHandlerCache.h"
+#include "ServantManager.h"
+
+#include <sstream>
+#include <typeinfo>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+    // The request ID of the current object of direct dispatches: like collocated twoway requests, direct dispatches
+    // have a non-zero request ID.
+    const int32_t directCallRequestId = 1;
+
+    shared_ptr<ObjectAdapterI> findCollocatedAdapter(const ObjectPrx& proxy)
+    {
+        const ReferencePtr& ref = proxy._getReference();
+        if (ref->getCacheConnection())
+        {
+            // The cached request handler of a collocated proxy is a collocated request handler.
+            auto handler = dynamic_pointer_cast<CollocatedRequestHandler>(
+                proxy._getRequestHandlerCache()->getRequestHandler());
+            return handler ? handler->adapter() : nullptr;
+        }
+        return dynamic_pointer_cast<ObjectAdapterI>(ref->getInstance()->objectAdapterFactory()->findObjectAdapter(ref));
+    }
+}
+
+IceInternal::DirectCall::DirectCall(
+    const ObjectPrx& proxy,
+    string_view operation,
+    OperationMode mode,
+    const Context& context) noexcept
+{
+    const ReferencePtr& ref = proxy._getReference();
+    const InstancePtr& instance = ref->getInstance();
+    if (!ref->isTwoway() || !ref->getCollocationOptimized() || ref->getInvocationTimeout() > 0ms ||
+        instance->initializationData().executor || instance->initializationData().observer)
+    {
+        return;
+    }
+
+    try
+    {
+        shared_ptr<ObjectAdapterI> adapter = findCollocatedAdapter(proxy);
+        if (!adapter)
+        {
+            return;
+        }
+
+        // The dispatch pipeline is the servant manager, possibly preceded by the logger middleware, when the object
+        // adapter has no other middleware.
+        const ObjectPtr& dispatchPipeline = adapter->dispatchPipeline();
+        auto loggerMiddleware = dynamic_pointer_cast<LoggerMiddleware>(dispatchPipeline);
+        auto servantManager =
+            dynamic_pointer_cast<ServantManager>(loggerMiddleware ? loggerMiddleware->next() : dispatchPipeline);
+        if (!servantManager)
+        {
+            return;
+        }
+
+        // Prevents the object adapter from completing its deactivation during the dispatch. Throws if the object
+        // adapter is destroyed: the invocation is then sent through the regular request handler.
+        adapter->incDirectCount();
+        _adapter = std::move(adapter);
+
+        ObjectPtr servant = servantManager->findServant(ref->getIdentity(), ref->getFacet());
+        if (!servant)
+        {
+            return; // The servant locators and the missing servants are handled by the regular dispatch.
+        }
+
+        _current.adapter = _adapter;
+        _current.id = ref->getIdentity();
+        _current.facet = ref->getFacet();
+        _current.operation = operation;
+        _current.mode = mode;
+        _current.requestId = directCallRequestId;
+        _current.encoding = ref->getEncoding();
+
+        if (&context != &noExplicitContext)
+        {
+            _current.ctx = context;
+        }
+        else
+        {
+            const ImplicitContextPtr& implicitContext = instance->getImplicitContext();
+            const Context& prxContext = ref->getContext()->getValue();
+            if (implicitContext)
+            {
+                implicitContext->combine(prxContext, _current.ctx);
+            }
+            else
+            {
+                _current.ctx = prxContext;
+            }
+        }
+
+        _loggerMiddleware = std::move(loggerMiddleware);
+        _servant = std::move(servant);
+    }
+    catch (...)
+    {
+        // Ignored, the invocation is sent through the regular request handler and fails there if the failure
+        // persists.
+    }
+}
+
+IceInternal::DirectCall::~DirectCall()
+{
+    if (_adapter)
+    {
+        _adapter->decDirectCount();
+    }
+}
+
+void
+IceInternal::DirectCall::rethrow(exception_ptr ex) const
+{
+    if (_loggerMiddleware)
+    {
+        _loggerMiddleware->warning(ex, _current);
+    }
+
+    // Mirrors makeOutgoingResponse and the unmarshaling of the response by the invocation.
+    try
+    {
+        rethrow_exception(ex);
+    }
+    catch (const RequestFailedException& e)
+    {
+        Identity id = e.id();
+        string facet = e.facet();
+        string operation = e.operation();
+        if (id.name.empty())
+        {
+            id = _current.id;
+            facet = _current.facet;
+        }
+        if (operation.empty())
+        {
+            operation = _current.operation;
+        }
+
+        if (dynamic_cast<const ObjectNotExistException*>(&e))
+        {
+            throw ObjectNotExistException{__FILE__, __LINE__, std::move(id), std::move(facet), std::move(operation)};
+        }
+        else if (dynamic_cast<const FacetNotExistException*>(&e))
+        {
+            throw FacetNotExistException{__FILE__, __LINE__, std::move(id), std::move(facet), std::move(operation)};
+        }
+        else
+        {
+            throw OperationNotExistException{
+                __FILE__,
+                __LINE__,
+                std::move(id),
+                std::move(facet),
+                std::move(operation)};
+        }
+    }
+    catch (const UserException& e)
+    {
+        // A user exception not declared by the operation.
+        throw UnknownUserException::fromTypeId(__FILE__, __LINE__, e.ice_id());
+    }
+    catch (const UnknownException&)
+    {
+        throw;
+    }
+    catch (const LocalException& e)
+    {
+        ostringstream os;
+        os << "dispatch failed with " << e.ice_id() << ": " << e.what();
+        throw UnknownLocalException{__FILE__, __LINE__, os.str()};
+    }
+    catch (const std::exception& e)
+    {
+        ostringstream os;
+        os << "dispatch failed with " << demangle(typeid(e).name()) << ": " << e.what();
+        throw UnknownException{__FILE__, __LINE__, os.str()};
+    }
+    catch (...)
+    {
+        throw UnknownException{__FILE__, __LINE__, "dispatch failed with unknown: c++ exception"};
+    }
+}
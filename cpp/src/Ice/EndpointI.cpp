@@ -32,10 +32,17 @@ Ice::EndpointInfo::secure() const noexcept
 Ice::IPEndpointInfo::~IPEndpointInfo() = default;
 Ice::TCPEndpointInfo::~TCPEndpointInfo() = default;
 Ice::UDPEndpointInfo::~UDPEndpointInfo() = default;
+Ice::UnixEndpointInfo::~UnixEndpointInfo() = default;
 Ice::WSEndpointInfo::~WSEndpointInfo() = default;
 Ice::IAPEndpointInfo::~IAPEndpointInfo() = default;
 Ice::OpaqueEndpointInfo::~OpaqueEndpointInfo() = default;
 
+uint8_t
+IceInternal::EndpointI::compressionCodec() const
+{
+    return 0;
+}
+
 void
 IceInternal::EndpointI::streamWrite(Ice::OutputStream* s) const
 {
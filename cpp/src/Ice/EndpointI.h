@@ -76,6 +76,12 @@ namespace IceInternal
         //
         [[nodiscard]] virtual EndpointIPtr compress(bool) const = 0;
 
+        //
+        // Return the compression codec configured for this endpoint (see
+        // Compressor.h), or 0 if the endpoint doesn't specify a codec.
+        //
+        [[nodiscard]] virtual std::uint8_t compressionCodec() const;
+
         //
         // Return true if the endpoint is datagram-based.
         //
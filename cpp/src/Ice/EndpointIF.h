@@ -8,13 +8,17 @@
 namespace IceInternal
 {
     class EndpointI;
+    class ShmEndpoint;
     class TcpEndpointI;
     class UdpEndpointI;
+    class UnixEndpointI;
     class WSEndpoint;
 
     using EndpointIPtr = std::shared_ptr<EndpointI>;
+    using ShmEndpointPtr = std::shared_ptr<ShmEndpoint>;
     using TcpEndpointIPtr = std::shared_ptr<TcpEndpointI>;
     using UdpEndpointIPtr = std::shared_ptr<UdpEndpointI>;
+    using UnixEndpointIPtr = std::shared_ptr<UnixEndpointI>;
     using WSEndpointPtr = std::shared_ptr<WSEndpoint>;
 }
 
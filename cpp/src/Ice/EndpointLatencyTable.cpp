@@ -0,0 +1,189 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "EndpointLatencyTable.h"
+#include "EndpointI.h"
+
+#include <algorithm>
+#include <tuple>
+
+using namespace std;
+using namespace IceInternal;
+
+namespace
+{
+    // The weight of a new sample, the same as the weight of the round-trip time samples of TCP (RFC 6298).
+    constexpr double smoothingFactor = 0.125;
+
+    void addSample(optional<double>& average, chrono::nanoseconds sample)
+    {
+        const double value = chrono::duration<double, micro>(sample).count();
+        average = average ? *average + smoothingFactor * (value - *average) : value;
+    }
+
+    // The connections are shared by the proxies whose endpoints only differ by these settings.
+    EndpointIPtr normalize(const EndpointIPtr& endpoint)
+    {
+        return endpoint->timeout(-1)->compress(false)->connectionId("");
+    }
+
+    // The maximum number of entries of the table, when no connection refers to them.
+    constexpr size_t maxEntries = 1024;
+}
+
+void
+EndpointLatency::connectionEstablished(chrono::nanoseconds duration)
+{
+    lock_guard lock(_mutex);
+    addSample(_connectionLatency, duration);
+    _failures = 0;
+    _updated = chrono::steady_clock::now();
+}
+
+void
+EndpointLatency::connectionFailed()
+{
+    lock_guard lock(_mutex);
+    ++_failures;
+    _updated = chrono::steady_clock::now();
+}
+
+void
+EndpointLatency::invocationCompleted(chrono::nanoseconds duration)
+{
+    lock_guard lock(_mutex);
+    addSample(_invocationLatency, duration);
+    _failures = 0;
+    _updated = chrono::steady_clock::now();
+}
+
+EndpointLatencyTable::EndpointLatencyTable(chrono::seconds explorationInterval)
+    : _explorationInterval(explorationInterval)
+{
+}
+
+EndpointLatencyPtr
+EndpointLatencyTable::getEndpointLatency(const EndpointIPtr& endpoint)
+{
+    EndpointIPtr key = normalize(endpoint);
+    lock_guard lock(_mutex);
+    auto p = _entries.find(key);
+    if (p != _entries.end())
+    {
+        return p->second;
+    }
+
+    const auto now = chrono::steady_clock::now();
+    if (_entries.size() >= maxEntries || now - _lastEviction >= _explorationInterval)
+    {
+        evict(now);
+    }
+    auto latency = make_shared<EndpointLatency>();
+    _entries.emplace(std::move(key), latency);
+    return latency;
+}
+
+void
+EndpointLatencyTable::connectionFailed(const EndpointIPtr& endpoint)
+{
+    getEndpointLatency(endpoint)->connectionFailed();
+}
+
+void
+EndpointLatencyTable::sort(vector<EndpointIPtr>& endpoints)
+{
+    // Each endpoint gets a rank, 0 for the endpoints to explore, 1 for the endpoints with a latency and 2 for the
+    // endpoints which failed. The invocation latency is preferred to the connection latency when it's known. The
+    // index keeps the order of the endpoints with the same rank and latency.
+    vector<tuple<int, double, size_t>> keys;
+    keys.reserve(endpoints.size());
+    {
+        lock_guard lock(_mutex);
+        const auto now = chrono::steady_clock::now();
+        for (size_t i = 0; i < endpoints.size(); ++i)
+        {
+            auto p = _entries.find(normalize(endpoints[i]));
+            if (p == _entries.end())
+            {
+                keys.emplace_back(0, 0.0, i);
+                continue;
+            }
+
+            EndpointLatency& entry = *p->second;
+            lock_guard entryLock(entry._mutex);
+            if (entry._failures > 0)
+            {
+                // A failed endpoint is only explored again after the backoff.
+                keys.emplace_back(now - entry._updated > failureBackoff(entry._failures) ? 0 : 2, 0.0, i);
+            }
+            else if (!entry._invocationLatency && !entry._connectionLatency)
+            {
+                keys.emplace_back(0, 0.0, i); // No sample yet.
+            }
+            else if (now - entry._updated > _explorationInterval)
+            {
+                keys.emplace_back(0, 0.0, i);
+            }
+            else
+            {
+                keys.emplace_back(
+                    1,
+                    entry._invocationLatency ? *entry._invocationLatency : *entry._connectionLatency,
+                    i);
+            }
+        }
+    }
+    std::sort(keys.begin(), keys.end());
+
+    vector<EndpointIPtr> sorted;
+    sorted.reserve(endpoints.size());
+    for (const auto& key : keys)
+    {
+        sorted.push_back(std::move(endpoints[get<2>(key)]));
+    }
+    endpoints.swap(sorted);
+}
+
+void
+EndpointLatencyTable::evict(chrono::steady_clock::time_point now)
+{
+    // Must be called with the mutex locked. The entries of the connections are kept, the connections still update
+    // them. The other entries can't be updated concurrently, they are only returned with the mutex locked. A failed
+    // entry is kept one more backoff after it's explored again, to double the next backoff if the endpoint fails
+    // again.
+    _lastEviction = now;
+    auto oldest = _entries.end();
+    for (auto p = _entries.begin(); p != _entries.end();)
+    {
+        if (p->second.use_count() > 1)
+        {
+            ++p;
+            continue;
+        }
+
+        const EndpointLatency& entry = *p->second;
+        const auto age = now - entry._updated;
+        if (age > (entry._failures > 0 ? 2 * failureBackoff(entry._failures) : _explorationInterval))
+        {
+            p = _entries.erase(p);
+        }
+        else
+        {
+            if (oldest == _entries.end() || entry._updated < oldest->second->_updated)
+            {
+                oldest = p;
+            }
+            ++p;
+        }
+    }
+
+    if (_entries.size() >= maxEntries && oldest != _entries.end())
+    {
+        _entries.erase(oldest);
+    }
+}
+
+chrono::steady_clock::duration
+EndpointLatencyTable::failureBackoff(int failures) const noexcept
+{
+    return _explorationInterval * (1 << min(failures, 6));
+}
@@ -0,0 +1,72 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_ENDPOINT_LATENCY_TABLE_H
+#define ICE_ENDPOINT_LATENCY_TABLE_H
+
+#include "EndpointIF.h"
+#include "Ice/Comparable.h"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace IceInternal
+{
+    // The latency of an endpoint. Each outgoing connection keeps the latency of its endpoint, to record the latency
+    // of its invocations without looking up the endpoint latency table.
+    class EndpointLatency final
+    {
+    public:
+        void connectionEstablished(std::chrono::nanoseconds);
+        void connectionFailed();
+        void invocationCompleted(std::chrono::nanoseconds);
+
+    private:
+        friend class EndpointLatencyTable;
+
+        std::optional<double> _connectionLatency; // In microseconds.
+        std::optional<double> _invocationLatency; // In microseconds.
+        int _failures{0};                         // The number of consecutive connection establishment failures.
+        std::chrono::steady_clock::time_point _updated;
+        std::mutex _mutex;
+    };
+    using EndpointLatencyPtr = std::shared_ptr<EndpointLatency>;
+
+    // Records the latency of the endpoints of the proxies which use the Latency endpoint selection type. It keeps, for
+    // each endpoint, an exponentially weighted moving average (EWMA) of the duration of the connection establishments,
+    // which is close to the round-trip time, and of the latency of the invocations. These are the durations observed
+    // by the connection establishment and remote invocation observers.
+    class EndpointLatencyTable final
+    {
+    public:
+        EndpointLatencyTable(std::chrono::seconds);
+
+        // Returns the latency of the given endpoint, which is added to the table if it's not already there.
+        EndpointLatencyPtr getEndpointLatency(const EndpointIPtr&);
+
+        void connectionFailed(const EndpointIPtr&);
+
+        // Sorts the endpoints from the fastest to the slowest. The endpoints without a sample for more than the
+        // exploration interval come first, to measure their latency again. The endpoints whose last connection
+        // establishment failed come last, until they are explored again after a backoff which doubles with each
+        // consecutive failure, from twice to 64 times the exploration interval.
+        void sort(std::vector<EndpointIPtr>&);
+
+    private:
+        // Removes the entries which no connection refers to and which no longer affect the order of the endpoints.
+        void evict(std::chrono::steady_clock::time_point);
+
+        [[nodiscard]] std::chrono::steady_clock::duration failureBackoff(int) const noexcept;
+
+        const std::chrono::seconds _explorationInterval;
+        std::map<EndpointIPtr, EndpointLatencyPtr, Ice::TargetCompare<EndpointIPtr, std::less>> _entries;
+        std::chrono::steady_clock::time_point _lastEviction;
+        std::mutex _mutex;
+    };
+    using EndpointLatencyTablePtr = std::shared_ptr<EndpointLatencyTable>;
+}
+
+#endif
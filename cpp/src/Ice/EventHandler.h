@@ -8,6 +8,7 @@
 #include "Network.h"
 #include "ThreadPoolF.h"
 
+#include <atomic>
 #include <memory>
 
 namespace IceInternal
@@ -59,6 +60,11 @@ namespace IceInternal
         SocketOperation _ready{SocketOperationNone};
         SocketOperation _registered{SocketOperationNone};
 
+        // The reactor thread pool the handler is pinned to when its thread pool is configured with reactors. It's set
+        // once on initialize, before the handler is registered with the reactor, and read without the thread pool
+        // mutex by the calls which follow, possibly from other threads.
+        std::atomic<ThreadPool*> _reactor{nullptr};
+
         friend class ThreadPool;
         friend class ThreadPoolCurrent;
         friend class Selector;
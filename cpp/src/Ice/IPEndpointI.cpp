@@ -4,9 +4,12 @@
 #include "HashUtil.h"
 #include "Ice/InputStream.h"
 #include "Ice/LocalExceptions.h"
+#include "Ice/LoggerUtil.h"
+#include "Ice/Properties.h"
 #include "Instance.h"
 #include "NetworkProxy.h"
 #include "ProtocolInstance.h"
+#include "TraceLevels.h"
 
 using namespace std;
 using namespace Ice;
@@ -432,7 +435,12 @@ IceInternal::IPEndpointI::IPEndpointI(ProtocolInstancePtr instance, InputStream*
 IceInternal::EndpointHostResolver::EndpointHostResolver(const InstancePtr& instance)
     : _instance(instance),
       _protocol(instance->protocolSupport()),
-      _preferIPv6(instance->preferIPv6())
+      _preferIPv6(instance->preferIPv6()),
+      _cacheTTL(max(instance->initializationData().properties->getIcePropertyAsInt("Ice.HostResolver.CacheTTL"), 0)),
+      _negativeCacheTTL(
+          max(instance->initializationData().properties->getIcePropertyAsInt("Ice.HostResolver.NegativeCacheTTL"), 0)),
+      _observers(static_cast<size_t>(
+          max(instance->initializationData().properties->getIcePropertyAsInt("Ice.HostResolver.Size"), 1)))
 {
     updateObserver();
 }
@@ -447,8 +455,8 @@ IceInternal::EndpointHostResolver::resolve(
     function<void(exception_ptr)> exception)
 {
     //
-    // Try to get the addresses without DNS lookup. If this doesn't work, we queue a resolve
-    // entry and the thread will take care of getting the endpoint addresses.
+    // Try to get the addresses without DNS lookup. If this doesn't work, we look for the addresses in the cache and
+    // otherwise queue a lookup, a resolver thread will take care of getting the endpoint addresses.
     //
     NetworkProxyPtr networkProxy = _instance->networkProxy();
     if (!networkProxy)
@@ -469,29 +477,55 @@ IceInternal::EndpointHostResolver::resolve(
         }
     }
 
-    lock_guard lock(_mutex);
-    assert(!_destroyed);
+    ResolveRequest request{port, selType, endpoint, std::move(response), std::move(exception)};
+    vector<Address> addresses;
+    exception_ptr failure;
+    {
+        lock_guard lock(_mutex);
+        assert(!_destroyed);
+        if (networkProxy || !findCached(host, addresses, failure))
+        {
+            enqueue(host, std::move(request));
+            return;
+        }
+    }
 
-    ResolveEntry entry;
-    entry.host = host;
-    entry.port = port;
-    entry.selType = selType;
-    entry.endpoint = endpoint;
-    entry.response = std::move(response);
-    entry.exception = std::move(exception);
+    if (failure)
+    {
+        request.exception(failure);
+    }
+    else
+    {
+        finished(request, addresses, _protocol, nullptr);
+    }
+}
 
-    const CommunicatorObserverPtr& observer = _instance->initializationData().observer;
-    if (observer)
+void
+IceInternal::EndpointHostResolver::preResolve(const string& host)
+{
+    if (_cacheTTL == chrono::seconds::zero() || _instance->networkProxy())
     {
-        entry.observer = observer->getEndpointLookupObserver(endpoint);
-        if (entry.observer)
+        return; // The result of the lookup wouldn't be cached.
+    }
+
+    try
+    {
+        if (!getAddresses(host, 0, _protocol, Ice::EndpointSelectionType::Ordered, _preferIPv6, false).empty())
         {
-            entry.observer->attach();
+            return; // No DNS lookup required.
         }
     }
+    catch (const Ice::LocalException&)
+    {
+        return;
+    }
 
-    _queue.push_back(entry);
-    _conditionVariable.notify_one();
+    lock_guard lock(_mutex);
+    assert(!_destroyed);
+    if (_cache.find(host) == _cache.end())
+    {
+        enqueue(host, nullopt);
+    }
 }
 
 void
@@ -500,15 +534,16 @@ IceInternal::EndpointHostResolver::destroy()
     lock_guard lock(_mutex);
     assert(!_destroyed);
     _destroyed = true;
-    _conditionVariable.notify_one();
+    _conditionVariable.notify_all();
 }
 
 void
-IceInternal::EndpointHostResolver::run()
+IceInternal::EndpointHostResolver::run(size_t index)
 {
     while (true)
     {
-        ResolveEntry r;
+        string host;
+        ObserverPtr observer;
         ThreadObserverPtr threadObserver;
         {
             unique_lock lock(_mutex);
@@ -519,9 +554,10 @@ IceInternal::EndpointHostResolver::run()
                 break;
             }
 
-            r = _queue.front();
+            host = std::move(_queue.front());
             _queue.pop_front();
-            threadObserver = _observer.get();
+            observer = _lookups[host].observer;
+            threadObserver = _observers[index].get();
         }
 
         if (threadObserver)
@@ -529,10 +565,13 @@ IceInternal::EndpointHostResolver::run()
             threadObserver->stateChanged(ThreadState::ThreadStateIdle, ThreadState::ThreadStateInUseForOther);
         }
 
+        // The addresses are resolved with port 0, the port of each request is set when its connectors are created.
+        NetworkProxyPtr networkProxy = _instance->networkProxy();
+        ProtocolSupport protocol = _protocol;
+        vector<Address> addresses;
+        exception_ptr failure;
         try
         {
-            NetworkProxyPtr networkProxy = _instance->networkProxy();
-            ProtocolSupport protocol = _protocol;
             if (networkProxy)
             {
                 networkProxy = networkProxy->resolveHost(_protocol);
@@ -541,51 +580,104 @@ IceInternal::EndpointHostResolver::run()
                     protocol = networkProxy->getProtocolSupport();
                 }
             }
-
-            vector<Address> addresses = getAddresses(r.host, r.port, protocol, r.selType, _preferIPv6, true);
-            if (r.observer)
+            addresses = getAddresses(host, 0, protocol, Ice::EndpointSelectionType::Ordered, _preferIPv6, true);
+        }
+        catch (const Ice::LocalException& ex)
+        {
+            failure = current_exception();
+            if (observer)
             {
-                r.observer->detach();
-                r.observer = nullptr;
+                observer->failed(ex.ice_id());
             }
+        }
+
+        if (observer)
+        {
+            observer->detach();
+        }
+
+        vector<ResolveRequest> requests;
+        {
+            lock_guard lock(_mutex);
+            auto p = _lookups.find(host);
+            assert(p != _lookups.end());
+            requests = std::move(p->second.requests);
+            _lookups.erase(p);
+
+            // The lookups through a network proxy aren't cached, the addresses of the proxy are resolved with the
+            // addresses of the host.
+            if (!_instance->networkProxy())
+            {
+                const auto now = chrono::steady_clock::now();
+                for (auto q = _cache.begin(); q != _cache.end();)
+                {
+                    q = q->second.expiration <= now ? _cache.erase(q) : ++q;
+                }
 
-            r.response(r.endpoint->connectors(addresses, networkProxy));
+                const chrono::seconds ttl = failure ? _negativeCacheTTL : _cacheTTL;
+                if (ttl > chrono::seconds::zero())
+                {
+                    _cache[host] = CacheEntry{addresses, failure, now + ttl};
+                }
+            }
 
-            if (threadObserver)
+            ++_lookupCount;
+            if (failure)
             {
-                threadObserver->stateChanged(ThreadState::ThreadStateInUseForOther, ThreadState::ThreadStateIdle);
+                ++_failureCount;
             }
+            traceLookup(host, addresses, failure);
         }
-        catch (const Ice::LocalException& ex)
+
+        for (auto& request : requests)
         {
-            if (threadObserver)
+            if (failure)
             {
-                threadObserver->stateChanged(ThreadState::ThreadStateInUseForOther, ThreadState::ThreadStateIdle);
+                request.exception(failure);
             }
-            if (r.observer)
+            else
             {
-                r.observer->failed(ex.ice_id());
-                r.observer->detach();
+                finished(request, addresses, protocol, networkProxy);
             }
-            r.exception(current_exception());
+        }
+
+        if (threadObserver)
+        {
+            threadObserver->stateChanged(ThreadState::ThreadStateInUseForOther, ThreadState::ThreadStateIdle);
         }
     }
 
-    for (const auto& p : _queue)
+    // The first thread to terminate fails the lookups which are still queued.
+    vector<ResolveEntry> entries;
+    {
+        lock_guard lock(_mutex);
+        for (const auto& host : _queue)
+        {
+            auto p = _lookups.find(host);
+            assert(p != _lookups.end());
+            entries.push_back(std::move(p->second));
+            _lookups.erase(p);
+        }
+        _queue.clear();
+    }
+
+    for (const auto& entry : entries)
     {
         Ice::CommunicatorDestroyedException ex(__FILE__, __LINE__);
-        if (p.observer)
+        if (entry.observer)
         {
-            p.observer->failed(ex.ice_id());
-            p.observer->detach();
+            entry.observer->failed(ex.ice_id());
+            entry.observer->detach();
+        }
+        for (const auto& request : entry.requests)
+        {
+            request.exception(make_exception_ptr(ex));
         }
-        p.exception(make_exception_ptr(ex));
     }
-    _queue.clear();
 
-    if (_observer)
+    if (_observers[index])
     {
-        _observer.detach();
+        _observers[index].detach();
     }
 }
 
@@ -596,8 +688,127 @@ IceInternal::EndpointHostResolver::updateObserver()
     const CommunicatorObserverPtr& observer = _instance->initializationData().observer;
     if (observer)
     {
-        _observer.attach(
-            observer
-                ->getThreadObserver("Communicator", "Ice.HostResolver", ThreadState::ThreadStateIdle, _observer.get()));
+        for (size_t i = 0; i < _observers.size(); ++i)
+        {
+            const string name = _observers.size() == 1 ? "Ice.HostResolver" : "Ice.HostResolver-" + to_string(i);
+            _observers[i].attach(
+                observer->getThreadObserver("Communicator", name, ThreadState::ThreadStateIdle, _observers[i].get()));
+        }
+    }
+}
+
+bool
+IceInternal::EndpointHostResolver::findCached(const string& host, vector<Address>& addresses, exception_ptr& failure)
+{
+    auto p = _cache.find(host);
+    if (p == _cache.end())
+    {
+        return false;
+    }
+
+    if (p->second.expiration <= chrono::steady_clock::now())
+    {
+        _cache.erase(p);
+        return false;
+    }
+
+    addresses = p->second.addresses;
+    failure = p->second.exception;
+    if (failure)
+    {
+        ++_negativeCacheHitCount;
+    }
+    else
+    {
+        ++_cacheHitCount;
+    }
+    return true;
+}
+
+void
+IceInternal::EndpointHostResolver::enqueue(const string& host, optional<ResolveRequest> request)
+{
+    auto p = _lookups.find(host);
+    if (p != _lookups.end())
+    {
+        // A lookup is already queued or running for this host, the request waits for its result.
+        if (request)
+        {
+            p->second.requests.push_back(std::move(*request));
+            ++_coalescedCount;
+        }
+        return;
+    }
+
+    ResolveEntry& entry = _lookups[host];
+    if (request)
+    {
+        const CommunicatorObserverPtr& observer = _instance->initializationData().observer;
+        if (observer)
+        {
+            entry.observer = observer->getEndpointLookupObserver(request->endpoint);
+            if (entry.observer)
+            {
+                entry.observer->attach();
+            }
+        }
+        entry.requests.push_back(std::move(*request));
+    }
+
+    _queue.push_back(host);
+    _conditionVariable.notify_one();
+}
+
+void
+IceInternal::EndpointHostResolver::finished(
+    ResolveRequest& request,
+    const vector<Address>& addresses,
+    ProtocolSupport protocol,
+    const NetworkProxyPtr& networkProxy)
+{
+    vector<Address> addrs = addresses;
+    for (auto& addr : addrs)
+    {
+        setPort(addr, request.port);
+    }
+    sortAddresses(addrs, protocol, request.selType, _preferIPv6);
+
+    vector<ConnectorPtr> connectors;
+    try
+    {
+        connectors = request.endpoint->connectors(addrs, networkProxy);
+    }
+    catch (const Ice::LocalException&)
+    {
+        request.exception(current_exception());
+        return;
+    }
+    request.response(std::move(connectors));
+}
+
+void
+IceInternal::EndpointHostResolver::traceLookup(
+    const string& host,
+    const vector<Address>& addresses,
+    const exception_ptr& failure)
+{
+    if (_instance->traceLevels()->network >= 2)
+    {
+        Trace out(_instance->initializationData().logger, _instance->traceLevels()->networkCat);
+        if (failure)
+        {
+            out << "failed to resolve host `" << host << "'";
+        }
+        else
+        {
+            out << "resolved host `" << host << "' to ";
+            for (auto p = addresses.begin(); p != addresses.end(); ++p)
+            {
+                out << (p == addresses.begin() ? "" : ", ") << inetAddrToString(*p);
+            }
+        }
+        out << "\nhost resolver: " << _lookupCount << " lookups, " << _failureCount << " failures, " << _cacheHitCount
+            << " cache hits, " << _negativeCacheHitCount << " negative cache hits, " << _coalescedCount
+            << " coalesced requests";
     }
 }
@@ -10,9 +10,12 @@
 #include "Network.h"
 #include "ProtocolInstanceF.h"
 
+#include <chrono>
 #include <condition_variable>
 #include <deque>
+#include <map>
 #include <mutex>
+#include <optional>
 
 namespace IceInternal
 {
@@ -67,6 +70,10 @@ namespace IceInternal
         const std::string _connectionId;
     };
 
+    // Resolves the host names of IP endpoints with a pool of Ice.HostResolver.Size threads. The requests for a host
+    // name which is already being resolved wait for the result of this lookup. Without network proxy, the addresses
+    // of a host name are cached for Ice.HostResolver.CacheTTL seconds and the lookup failures for
+    // Ice.HostResolver.NegativeCacheTTL seconds.
     class ICE_API EndpointHostResolver final
     {
     public:
@@ -79,31 +86,66 @@ namespace IceInternal
             const IPEndpointIPtr&,
             std::function<void(std::vector<ConnectorPtr>)>,
             std::function<void(std::exception_ptr)>);
+
+        // Resolves the host name in the background to fill the cache.
+        void preResolve(const std::string&);
+
         void destroy();
 
-        void run();
+        void run(std::size_t);
         void updateObserver();
 
+        [[nodiscard]] std::size_t size() const { return _observers.size(); }
+
     private:
-        struct ResolveEntry
+        struct ResolveRequest
         {
-            std::string host;
             int port;
             Ice::EndpointSelectionType selType;
             IPEndpointIPtr endpoint;
             std::function<void(std::vector<ConnectorPtr>)> response;
             std::function<void(std::exception_ptr)> exception;
+        };
+
+        // A lookup queued or running, with the requests waiting for its result.
+        struct ResolveEntry
+        {
+            std::vector<ResolveRequest> requests;
             Ice::Instrumentation::ObserverPtr observer;
         };
 
+        struct CacheEntry
+        {
+            std::vector<Address> addresses; // With port 0, empty if the lookup failed.
+            std::exception_ptr exception;
+            std::chrono::steady_clock::time_point expiration;
+        };
+
+        bool findCached(const std::string&, std::vector<Address>&, std::exception_ptr&);
+        void enqueue(const std::string&, std::optional<ResolveRequest>);
+        void finished(ResolveRequest&, const std::vector<Address>&, ProtocolSupport, const NetworkProxyPtr&);
+        void traceLookup(const std::string&, const std::vector<Address>&, const std::exception_ptr&);
+
         const InstancePtr _instance;
         const IceInternal::ProtocolSupport _protocol;
         const bool _preferIPv6;
+        const std::chrono::seconds _cacheTTL;
+        const std::chrono::seconds _negativeCacheTTL;
         bool _destroyed{false};
-        std::deque<ResolveEntry> _queue;
-        ObserverHelperT<Ice::Instrumentation::ThreadObserver> _observer;
+        std::deque<std::string> _queue;
+        std::map<std::string, ResolveEntry> _lookups;
+        std::map<std::string, CacheEntry> _cache;
+        std::vector<ObserverHelperT<Ice::Instrumentation::ThreadObserver>> _observers;
         std::mutex _mutex;
         std::condition_variable _conditionVariable;
+
+        // Statistics traced with each lookup when Ice.Trace.Network >= 2. The Network traces are the only way to get
+        // these statistics: the metrics only report the DNS lookups, through the endpoint lookup observer.
+        std::uint64_t _lookupCount{0};
+        std::uint64_t _failureCount{0};
+        std::uint64_t _cacheHitCount{0};
+        std::uint64_t _negativeCacheHitCount{0};
+        std::uint64_t _coalescedCount{0};
     };
 }
 
@@ -97,6 +97,19 @@ IdleTimeoutTransceiverDecorator::write(Buffer& buf)
     return op;
 }
 
+SocketOperation
+IdleTimeoutTransceiverDecorator::writev(const vector<Buffer*>& buffers)
+{
+    _timer->cancel(_heartbeatTimerTask);
+
+    SocketOperation op = _decoratee->writev(buffers);
+    if (op == SocketOperationNone) // write completed
+    {
+        _timer->schedule(_heartbeatTimerTask, chrono::milliseconds(_idleTimeout) / 2);
+    }
+    return op;
+}
+
 #if defined(ICE_USE_IOCP)
 bool
 IdleTimeoutTransceiverDecorator::startWrite(Buffer& buf)
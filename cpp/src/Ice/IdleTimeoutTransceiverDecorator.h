@@ -47,6 +47,7 @@ namespace IceInternal
 
         SocketOperation write(Buffer&) final;
         SocketOperation read(Buffer&) final;
+        SocketOperation writev(const std::vector<Buffer*>&) final;
 
 #if defined(ICE_USE_IOCP)
         bool startWrite(Buffer&) final;
@@ -67,6 +68,8 @@ namespace IceInternal
 
         void checkSendSize(const Buffer& buf) final { _decoratee->checkSendSize(buf); };
         void setBufferSize(int rcvSize, int sndSize) final { _decoratee->setBufferSize(rcvSize, sndSize); }
+        [[nodiscard]] std::uint32_t zeroCopySent() const final { return _decoratee->zeroCopySent(); }
+        [[nodiscard]] std::uint32_t zeroCopyCompleted() const final { return _decoratee->zeroCopyCompleted(); }
 
         [[nodiscard]] bool idleCheckEnabled() const noexcept { return _idleCheckEnabled; }
         void enableIdleCheck();
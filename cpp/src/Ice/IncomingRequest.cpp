@@ -8,6 +8,72 @@ using namespace std;
 using namespace Ice;
 using namespace IceInternal;
 
+namespace
+{
+    // The maximum number of context entries kept for reuse by each thread.
+    const size_t maxRecycledContextEntries = 16;
+
+    // The maximum capacity of a string kept for reuse. A thread doesn't keep the memory of an unusually large
+    // identity, facet, operation or context entry once the request which needed it is dispatched.
+    const size_t maxRecycledStringCapacity = 1024;
+
+    // The memory of the current object of the last request dispatched by a thread. The next request dispatched by
+    // this thread unmarshals its identity, facet, operation and context in this memory: the strings are reassigned
+    // and the context map nodes are reinserted, which doesn't allocate as long as the strings of the new request fit
+    // in the strings of the previous one.
+    struct RecycledCurrent
+    {
+        RecycledCurrent() { contextEntries.reserve(maxRecycledContextEntries); }
+
+        Identity id;
+        string facet;
+        string operation;
+        vector<Context::node_type> contextEntries;
+
+        // False while the memory is used by an IncomingRequest. A request dispatched during the dispatch of another
+        // request by the same thread (a collocated invocation) doesn't reuse any memory.
+        bool available{true};
+    };
+
+    thread_local RecycledCurrent recycledCurrent;
+
+    void readString(InputStream& inputStream, string& v, bool convert = true)
+    {
+        const char* data = nullptr;
+        size_t size = 0;
+        inputStream.read(data, size, convert);
+        v.assign(data, size);
+    }
+
+    void recycleString(string& v, string& recycled) noexcept
+    {
+        if (v.capacity() <= maxRecycledStringCapacity)
+        {
+            v.swap(recycled);
+        }
+    }
+
+    // Returns the memory of a current object to the calling thread.
+    void recycle(Current& current) noexcept
+    {
+        RecycledCurrent& recycled = recycledCurrent;
+        recycleString(current.id.name, recycled.id.name);
+        recycleString(current.id.category, recycled.id.category);
+        recycleString(current.facet, recycled.facet);
+        recycleString(current.operation, recycled.operation);
+        auto p = current.ctx.begin();
+        while (p != current.ctx.end() && recycled.contextEntries.size() < maxRecycledContextEntries)
+        {
+            auto q = p++;
+            if (q->first.capacity() <= maxRecycledStringCapacity && q->second.capacity() <= maxRecycledStringCapacity)
+            {
+                recycled.contextEntries.push_back(current.ctx.extract(q));
+            }
+        }
+        recycled.available = true;
+    }
+}
+
 IncomingRequest::IncomingRequest(
     int32_t requestId,
     ConnectionPtr connection,
@@ -21,46 +87,98 @@ IncomingRequest::IncomingRequest(
     _current.con = std::move(connection);
     _current.requestId = requestId;
 
-    // Read everything else from the input stream.
-    auto start = inputStream.i;
-    inputStream.read(_current.id);
+    RecycledCurrent& recycled = recycledCurrent;
+    if (recycled.available)
+    {
+        recycled.available = false;
+        _recycled = true;
+        _current.id.name.swap(recycled.id.name);
+        _current.id.category.swap(recycled.id.category);
+        _current.facet.swap(recycled.facet);
+        _current.operation.swap(recycled.operation);
+    }
 
-    vector<string> facetPath;
-    inputStream.read(facetPath);
-    if (!facetPath.empty())
+    try
     {
-        if (facetPath.size() > 1)
+        // Read everything else from the input stream.
+        auto start = inputStream.i;
+        readString(inputStream, _current.id.name);
+        readString(inputStream, _current.id.category);
+
+        // The facet path is a sequence of strings with at most one element.
+        int32_t facetPathSize = inputStream.readSize();
+        if (facetPathSize > 1)
         {
             throw MarshalException{__FILE__, __LINE__, "received facet path with more than one element"};
         }
-        _current.facet = facetPath[0];
-    }
+        if (facetPathSize == 1)
+        {
+            readString(inputStream, _current.facet);
+        }
+        else
+        {
+            _current.facet.clear();
+        }
 
-    inputStream.read(_current.operation, false);
+        readString(inputStream, _current.operation, false);
 
-    uint8_t mode;
-    inputStream.read(mode);
-    _current.mode = static_cast<OperationMode>(mode);
+        uint8_t mode;
+        inputStream.read(mode);
+        _current.mode = static_cast<OperationMode>(mode);
 
-    int32_t sz = inputStream.readSize();
-    while (sz--)
-    {
-        string key;
-        string value;
-        inputStream.read(key);
-        inputStream.read(value);
-        _current.ctx.emplace(std::move(key), std::move(value));
-    }
+        int32_t sz = inputStream.readSize();
+        while (sz--)
+        {
+            if (_recycled && !recycled.contextEntries.empty())
+            {
+                Context::node_type entry = std::move(recycled.contextEntries.back());
+                recycled.contextEntries.pop_back();
+                readString(inputStream, entry.key());
+                readString(inputStream, entry.mapped());
+                auto result = _current.ctx.insert(std::move(entry));
+                if (!result.inserted)
+                {
+                    // Duplicate key, the first entry is kept.
+                    recycled.contextEntries.push_back(std::move(result.node));
+                }
+            }
+            else
+            {
+                string key;
+                string value;
+                inputStream.read(key);
+                inputStream.read(value);
+                _current.ctx.emplace(std::move(key), std::move(value));
+            }
+        }
 
-    int32_t encapsulationSize;
-    inputStream.read(encapsulationSize);
-    EncodingVersion encoding;
-    inputStream.read(encoding.major);
-    inputStream.read(encoding.minor);
-    _current.encoding = encoding;
+        int32_t encapsulationSize;
+        inputStream.read(encapsulationSize);
+        EncodingVersion encoding;
+        inputStream.read(encoding.major);
+        inputStream.read(encoding.minor);
+        _current.encoding = encoding;
 
-    // Rewind to the start of the encapsulation
-    inputStream.i -= 6;
+        // Rewind to the start of the encapsulation
+        inputStream.i -= 6;
 
-    _requestSize = static_cast<int32_t>(inputStream.i - start) + encapsulationSize;
+        _requestSize = static_cast<int32_t>(inputStream.i - start) + encapsulationSize;
+    }
+    catch (...)
+    {
+        // The destructor isn't called if the constructor throws.
+        if (_recycled)
+        {
+            recycle(_current);
+        }
+        throw;
+    }
+}
+
+IncomingRequest::~IncomingRequest()
+{
+    if (_recycled)
+    {
+        recycle(_current);
+    }
 }
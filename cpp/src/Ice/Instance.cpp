@@ -1,11 +1,13 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "Instance.h"
+#include "BufferPool.h"
 #include "CheckIdentity.h"
 #include "ConnectionFactory.h"
 #include "ConsoleUtil.h"
 #include "DefaultsAndOverrides.h"
 #include "EndpointFactoryManager.h"
+#include "EndpointLatencyTable.h"
 #include "FileUtil.h"
 #include "IPEndpointI.h" // For EndpointHostResolver
 #include "Ice/Communicator.h"
@@ -39,6 +41,7 @@
 #include "DisableWarnings.h"
 
 #include <cstdio>
+#include <fstream>
 #include <list>
 #include <mutex>
 
@@ -199,7 +202,7 @@ namespace IceInternal // Required because ObserverUpdaterI is a friend of Instan
     class ThreadObserverTimer final : public IceInternal::Timer
     {
     public:
-        ThreadObserverTimer() : _hasObserver(false) {}
+        ThreadObserverTimer(chrono::nanoseconds wheelTick) : Timer(wheelTick), _hasObserver(false) {}
 
         void updateObserver(const Ice::Instrumentation::CommunicatorObserverPtr&);
 
@@ -1114,6 +1117,12 @@ IceInternal::Instance::initialize(const Ice::CommunicatorPtr& communicator)
             }
         }
 
+        {
+            // In microseconds, 0 disables time-based auto-flush.
+            int32_t num = _initData.properties->getIcePropertyAsInt("Ice.BatchAutoFlushInterval");
+            const_cast<chrono::microseconds&>(_batchAutoFlushInterval) = chrono::microseconds(max(num, 0));
+        }
+
         {
             int32_t num = _initData.properties->getIcePropertyAsInt("Ice.ClassGraphDepthMax");
             if (num < 1 || static_cast<size_t>(num) > static_cast<size_t>(0x7fffffff))
@@ -1126,6 +1135,25 @@ IceInternal::Instance::initialize(const Ice::CommunicatorPtr& communicator)
             }
         }
 
+        string compressionDictionary = _initData.properties->getIceProperty("Ice.Compression.Dictionary");
+        if (!compressionDictionary.empty())
+        {
+            ifstream in(streamFilename(compressionDictionary).c_str(), ios::binary);
+            if (!in)
+            {
+                throw FileException(__FILE__, __LINE__, compressionDictionary);
+            }
+            auto& dictionary = const_cast<vector<byte>&>(_compressionDictionary);
+            in.seekg(0, ios::end);
+            dictionary.resize(static_cast<size_t>(in.tellg()));
+            in.seekg(0, ios::beg);
+            in.read(reinterpret_cast<char*>(dictionary.data()), static_cast<streamsize>(dictionary.size()));
+            if (!in)
+            {
+                throw FileException(__FILE__, __LINE__, compressionDictionary);
+            }
+        }
+
         string toStringModeStr = _initData.properties->getIceProperty("Ice.ToStringMode");
         if (toStringModeStr == "ASCII")
         {
@@ -1211,6 +1239,11 @@ IceInternal::Instance::initialize(const Ice::CommunicatorPtr& communicator)
 
         _retryQueue = make_shared<RetryQueue>(shared_from_this());
 
+        // With the Latency endpoint selection type, an endpoint without latency sample for this interval is tried
+        // again to measure its latency.
+        _endpointLatencyTable = make_shared<EndpointLatencyTable>(
+            chrono::seconds(max(_initData.properties->getIcePropertyAsInt("Ice.LatencyExplorationInterval"), 1)));
+
         StringSeq retryValues = _initData.properties->getIcePropertyAsList("Ice.RetryIntervals");
         if (retryValues.size() == 0)
         {
@@ -1303,7 +1336,7 @@ IceInternal::Instance::~Instance()
     assert(!_clientThreadPool);
     assert(!_serverThreadPool);
     assert(!_endpointHostResolver);
-    assert(!_endpointHostResolverThread.joinable());
+    assert(_endpointHostResolverThreads.empty());
     assert(!_retryQueue);
     assert(!_timer);
     assert(!_routerManager);
@@ -1337,6 +1370,14 @@ IceInternal::Instance::~Instance()
 void
 IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::CommunicatorPtr& communicator)
 {
+    // Enable the process-wide buffer pool before plug-ins and thread pools start allocating buffers. It's disabled
+    // by destroy() once all the communicators which enabled it are destroyed.
+    if (_initData.properties->getIcePropertyAsInt("Ice.BufferPool") > 0)
+    {
+        enableBufferPool();
+        _bufferPoolEnabled = true;
+    }
+
     // Load plug-ins.
     assert(!_serverThreadPool);
     auto pluginManagerImpl = dynamic_pointer_cast<PluginManagerI>(_pluginManager);
@@ -1453,7 +1494,10 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
     //
     try
     {
-        _timer = make_shared<ThreadObserverTimer>();
+        // With Ice.TimerWheelTick > 0, the communicator timer uses a timing wheel with this tick (in milliseconds).
+        // Connections schedule and cancel their timer tasks constantly, this makes these calls O(1).
+        int32_t wheelTick = _initData.properties->getIcePropertyAsInt("Ice.TimerWheelTick");
+        _timer = make_shared<ThreadObserverTimer>(chrono::milliseconds(max(wheelTick, 0)));
     }
     catch (const Ice::Exception& ex)
     {
@@ -1465,7 +1509,17 @@ IceInternal::Instance::finishSetup(int& argc, const char* argv[], const Ice::Com
     try
     {
         _endpointHostResolver = make_shared<EndpointHostResolver>(shared_from_this());
-        _endpointHostResolverThread = std::thread([this] { _endpointHostResolver->run(); });
+        for (size_t i = 0; i < _endpointHostResolver->size(); ++i)
+        {
+            _endpointHostResolverThreads.emplace_back([this, i] { _endpointHostResolver->run(i); });
+        }
+
+        // Warm up the cache with the host names listed by Ice.HostResolver.PreResolve, the connections to these hosts
+        // don't wait for a DNS lookup.
+        for (const auto& host : _initData.properties->getIcePropertyAsList("Ice.HostResolver.PreResolve"))
+        {
+            _endpointHostResolver->preResolve(host);
+        }
     }
     catch (const Ice::Exception& ex)
     {
@@ -1669,10 +1723,11 @@ IceInternal::Instance::destroy()
     {
         _serverThreadPool->joinWithAllThreads();
     }
-    if (_endpointHostResolverThread.joinable())
+    for (auto& thread : _endpointHostResolverThreads)
     {
-        _endpointHostResolverThread.join();
+        thread.join();
     }
+    _endpointHostResolverThreads.clear();
 
     if (_routerManager)
     {
@@ -1729,6 +1784,12 @@ IceInternal::Instance::destroy()
 
         _sslEngine = nullptr;
 
+        if (_bufferPoolEnabled)
+        {
+            disableBufferPool();
+            _bufferPoolEnabled = false;
+        }
+
         _state = StateDestroyed;
         _conditionVariable.notify_all();
     }
@@ -32,6 +32,7 @@
 #include "TraceLevelsF.h"
 
 #include <list>
+#include <vector>
 
 namespace IceInternal
 {
@@ -41,6 +42,9 @@ namespace IceInternal
     class MetricsAdminI;
     using MetricsAdminIPtr = std::shared_ptr<MetricsAdminI>;
 
+    class EndpointLatencyTable;
+    using EndpointLatencyTablePtr = std::shared_ptr<EndpointLatencyTable>;
+
     //
     // Structure to track warnings for attempts to set socket buffer sizes
     //
@@ -81,12 +85,15 @@ namespace IceInternal
         EndpointHostResolverPtr endpointHostResolver();
         RetryQueuePtr retryQueue();
         [[nodiscard]] const std::vector<int>& retryIntervals() const { return _retryIntervals; }
+        [[nodiscard]] const EndpointLatencyTablePtr& endpointLatencyTable() const { return _endpointLatencyTable; }
         IceInternal::TimerPtr timer();
         [[nodiscard]] EndpointFactoryManagerPtr endpointFactoryManager() const;
         [[nodiscard]] Ice::PluginManagerPtr pluginManager() const;
         [[nodiscard]] size_t messageSizeMax() const { return _messageSizeMax; }
         [[nodiscard]] size_t batchAutoFlushSize() const { return _batchAutoFlushSize; }
+        [[nodiscard]] std::chrono::microseconds batchAutoFlushInterval() const { return _batchAutoFlushInterval; }
         [[nodiscard]] size_t classGraphDepthMax() const { return _classGraphDepthMax; }
+        [[nodiscard]] const std::vector<std::byte>& compressionDictionary() const { return _compressionDictionary; }
         [[nodiscard]] Ice::ToStringMode toStringMode() const { return _toStringMode; }
         [[nodiscard]] bool acceptClassCycles() const { return _acceptClassCycles; }
 
@@ -151,7 +158,9 @@ namespace IceInternal
         const DefaultsAndOverridesPtr _defaultsAndOverrides;               // Immutable, not reset by destroy().
         const size_t _messageSizeMax{0};                                   // Immutable, not reset by destroy().
         const size_t _batchAutoFlushSize{0};                               // Immutable, not reset by destroy().
+        const std::chrono::microseconds _batchAutoFlushInterval{0};        // Immutable, not reset by destroy().
         const size_t _classGraphDepthMax{0};                               // Immutable, not reset by destroy().
+        const std::vector<std::byte> _compressionDictionary;               // Immutable, not reset by destroy().
         const Ice::ToStringMode _toStringMode{Ice::ToStringMode::Unicode}; // Immutable, not reset by destroy().
         const bool _acceptClassCycles{false};                              // Immutable, not reset by destroy().
         Ice::ConnectionOptions _clientConnectionOptions;
@@ -167,9 +176,10 @@ namespace IceInternal
         ThreadPoolPtr _clientThreadPool;
         ThreadPoolPtr _serverThreadPool;
         EndpointHostResolverPtr _endpointHostResolver;
-        std::thread _endpointHostResolverThread;
+        std::vector<std::thread> _endpointHostResolverThreads;
         RetryQueuePtr _retryQueue;
         std::vector<int> _retryIntervals;
+        EndpointLatencyTablePtr _endpointLatencyTable;
         ThreadObserverTimerPtr _timer;
         EndpointFactoryManagerPtr _endpointFactoryManager;
         Ice::PluginManagerPtr _pluginManager;
@@ -177,6 +187,7 @@ namespace IceInternal
         Ice::StringConverterPtr _stringConverter;
         Ice::WstringConverterPtr _wstringConverter;
         bool _adminEnabled{false};
+        bool _bufferPoolEnabled{false}; // True if this communicator enabled the buffer pool, see Ice.BufferPool.
         Ice::ObjectAdapterPtr _adminAdapter;
         Ice::FacetMap _adminFacets;
         Ice::Identity _adminIdentity;
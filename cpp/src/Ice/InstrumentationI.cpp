@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "InstrumentationI.h"
+#include "BufferPool.h"
 #include "Ice/Communicator.h"
 #include "Ice/Connection.h"
 #include "Ice/Endpoint.h"
@@ -54,6 +55,54 @@ namespace
         ThreadState newState;
     };
 
+    // The BufferPool map. Its metrics are a snapshot of the statistics of the buffer pool taken when the metrics are
+    // retrieved, it isn't updated by observers.
+    class BufferPoolMetricsMap final : public MetricsMapI
+    {
+    public:
+        BufferPoolMetricsMap(const string& mapPrefix, const PropertiesPtr& properties)
+            : MetricsMapI(mapPrefix, properties)
+        {
+        }
+
+        void destroy() final {}
+
+        MetricsFailuresSeq getFailures() final { return {}; }
+
+        MetricsFailures getFailures(const string&) final { return {}; }
+
+        [[nodiscard]] MetricsMap getMetrics() const final
+        {
+            MetricsMap metrics;
+            for (const auto& stats : getBufferPoolStats())
+            {
+                if (stats.allocations > 0 || stats.cached > 0)
+                {
+                    auto m = make_shared<BufferPoolMetrics>();
+                    m->id = to_string(stats.size);
+                    m->total = stats.allocations;
+                    m->current = static_cast<int32_t>(stats.cached);
+                    m->hits = stats.hits;
+                    metrics.push_back(m);
+                }
+            }
+            return metrics;
+        }
+
+        [[nodiscard]] MetricsMapIPtr clone() const final { return make_shared<BufferPoolMetricsMap>(*this); }
+    };
+
+    class BufferPoolMetricsMapFactory final : public MetricsMapFactory
+    {
+    public:
+        BufferPoolMetricsMapFactory() : MetricsMapFactory(nullptr) {}
+
+        MetricsMapIPtr create(const string& mapPrefix, const PropertiesPtr& properties) final
+        {
+            return make_shared<BufferPoolMetricsMap>(mapPrefix, properties);
+        }
+    };
+
     IPConnectionInfoPtr getIPConnectionInfo(const ConnectionInfoPtr& info)
     {
         for (ConnectionInfoPtr p = info; p; p = p->underlying)
@@ -778,6 +827,7 @@ CommunicatorObserverI::CommunicatorObserverI(const InitializationData& initData)
 {
     _invocations.registerSubMap<RemoteMetrics>("Remote", &InvocationMetrics::remotes);
     _invocations.registerSubMap<CollocatedMetrics>("Collocated", &InvocationMetrics::collocated);
+    _metrics->registerMap("BufferPool", make_shared<BufferPoolMetricsMapFactory>());
 }
 
 void
@@ -50,33 +50,42 @@ LoggerMiddleware::dispatch(Ice::IncomingRequest& request, function<void(Outgoing
                 sendResponse(std::move(response));
             });
     }
+    catch (...)
+    {
+        warning(current_exception(), request.current());
+        throw;
+    }
+}
+
+void
+LoggerMiddleware::warning(exception_ptr ex, const Current& current) const noexcept
+{
+    try
+    {
+        rethrow_exception(ex);
+    }
     catch (const UserException&)
     {
         // No warning.
-        throw;
     }
-    catch (const RequestFailedException& ex)
+    catch (const RequestFailedException& e)
     {
         if (_warningLevel > 1)
         {
-            warning(ex, request.current());
+            warning(e, current);
         }
-        throw;
     }
-    catch (const Ice::Exception& ex)
+    catch (const Ice::Exception& e)
     {
-        warning(ex, request.current());
-        throw;
+        warning(e, current);
     }
-    catch (const std::exception& ex)
+    catch (const std::exception& e)
     {
-        warning(ex.what(), request.current());
-        throw;
+        warning(e.what(), current);
     }
     catch (...)
     {
-        warning("c++ exception", request.current());
-        throw;
+        warning("c++ exception", current);
     }
 }
 
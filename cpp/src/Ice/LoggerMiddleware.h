@@ -18,6 +18,12 @@ namespace IceInternal
 
         void dispatch(Ice::IncomingRequest&, std::function<void(Ice::OutgoingResponse)>) final;
 
+        // Logs a warning for an exception thrown by the next dispatcher, unless this exception doesn't warrant a
+        // warning with the configured warning level.
+        void warning(std::exception_ptr, const Ice::Current&) const noexcept;
+
+        [[nodiscard]] const Ice::ObjectPtr& next() const noexcept { return _next; }
+
     private:
         void warning(const Ice::Exception&, const Ice::Current&) const noexcept;
         void warning(const std::string&, const Ice::Current&) const noexcept;
@@ -21,6 +21,12 @@ ifeq ($(os),Linux)
 ifeq ($(shell pkg-config --exists libsystemd 2> /dev/null && echo yes),yes)
 Ice_cppflags                            += -DICE_USE_SYSTEMD $(shell pkg-config --cflags libsystemd)
 endif
+ifeq ($(shell pkg-config --exists liblz4 2> /dev/null && echo yes),yes)
+Ice_cppflags                            += -DICE_HAS_LZ4 $(shell pkg-config --cflags liblz4)
+endif
+ifeq ($(shell pkg-config --exists libzstd 2> /dev/null && echo yes),yes)
+Ice_cppflags                            += -DICE_HAS_ZSTD $(shell pkg-config --cflags libzstd)
+endif
 endif
 
 ios_extrasources :=  $(wildcard $(addprefix $(currentdir)/ios/,*.cpp *.mm))
@@ -31,7 +37,9 @@ ios_excludes := $(wildcard $(addprefix $(currentdir)/,\
 	Service.cpp \
 	SysLoggerI.cpp \
 	SystemdJournalI.cpp \
-	Tcp*.cpp))
+	Shm*.cpp \
+	Tcp*.cpp \
+	Unix*.cpp))
 
 Ice[iphoneos]_excludes                  = $(ios_excludes)
 Ice[iphoneos]_extra_sources             = $(ios_extrasources)
@@ -170,8 +170,11 @@ MetricsMapFactory::MetricsMapFactory(Updater* updater) : _updater(updater) {}
 void
 MetricsMapFactory::update()
 {
-    assert(_updater);
-    _updater->update();
+    // The maps which aren't updated by observers (such as the BufferPool map) don't have an updater.
+    if (_updater)
+    {
+        _updater->update();
+    }
 }
 
 MetricsViewI::MetricsViewI(string name) : _name(std::move(name)) {}
@@ -430,6 +433,21 @@ MetricsAdminI::updateViews()
     }
 }
 
+void
+MetricsAdminI::registerMap(const std::string& mapName, const MetricsMapFactoryPtr& factory)
+{
+    bool updated;
+    {
+        lock_guard lock(_mutex);
+        _factories[mapName] = factory;
+        updated = addOrUpdateMap(mapName, factory);
+    }
+    if (updated)
+    {
+        factory->update();
+    }
+}
+
 void
 MetricsAdminI::unregisterMap(const std::string& mapName)
 {
@@ -5,6 +5,7 @@
 #include "Ice/LoggerUtil.h" // For setTcpBufSize
 #include "Ice/Properties.h" // For setTcpBufSize
 #include "Ice/StringUtil.h"
+#include "HashUtil.h"
 #include "NetworkProxy.h"
 #include "ProtocolInstance.h" // For setTcpBufSize
 #include "Random.h"
@@ -49,33 +50,6 @@ namespace
         bool operator()(const Address& lhs, const Address& rhs) const { return compareAddress(lhs, rhs) < 0; }
     };
 
-    void
-    sortAddresses(vector<Address>& addrs, ProtocolSupport protocol, Ice::EndpointSelectionType selType, bool preferIPv6)
-    {
-        if (selType == Ice::EndpointSelectionType::Random)
-        {
-            IceInternal::shuffle(addrs.begin(), addrs.end());
-        }
-
-        if (protocol == EnableBoth)
-        {
-            if (preferIPv6)
-            {
-                stable_partition(
-                    addrs.begin(),
-                    addrs.end(),
-                    [](const Address& ss) { return ss.saStorage.ss_family == AF_INET6; });
-            }
-            else
-            {
-                stable_partition(
-                    addrs.begin(),
-                    addrs.end(),
-                    [](const Address& ss) { return ss.saStorage.ss_family != AF_INET6; });
-            }
-        }
-    }
-
     void setTcpNoDelay(SOCKET fd)
     {
         int flag = 1;
@@ -104,6 +78,12 @@ namespace
         {
             fd = socket(family, SOCK_DGRAM, IPPROTO_UDP);
         }
+#ifndef _WIN32
+        else if (family == AF_UNIX)
+        {
+            fd = socket(family, SOCK_STREAM, 0);
+        }
+#endif
         else
         {
             fd = socket(family, SOCK_STREAM, IPPROTO_TCP);
@@ -114,7 +94,11 @@ namespace
             throw SocketException(__FILE__, __LINE__, getSocketErrno());
         }
 
+#ifndef _WIN32
+        if (!udp && family != AF_UNIX)
+#else
         if (!udp)
+#endif
         {
             setTcpNoDelay(fd);
             setKeepAlive(fd);
@@ -639,6 +623,12 @@ namespace
         {
             size = sizeof(sockaddr_in6);
         }
+#ifndef _WIN32
+        else if (addr.saStorage.ss_family == AF_UNIX)
+        {
+            size = sizeof(sockaddr_un);
+        }
+#endif
         return size;
     }
 
@@ -855,6 +845,37 @@ IceInternal::getAddresses(
     return result;
 }
 
+void
+IceInternal::sortAddresses(
+    vector<Address>& addrs,
+    ProtocolSupport protocol,
+    Ice::EndpointSelectionType selType,
+    bool preferIPv6)
+{
+    if (selType == Ice::EndpointSelectionType::Random)
+    {
+        IceInternal::shuffle(addrs.begin(), addrs.end());
+    }
+
+    if (protocol == EnableBoth)
+    {
+        if (preferIPv6)
+        {
+            stable_partition(
+                addrs.begin(),
+                addrs.end(),
+                [](const Address& ss) { return ss.saStorage.ss_family == AF_INET6; });
+        }
+        else
+        {
+            stable_partition(
+                addrs.begin(),
+                addrs.end(),
+                [](const Address& ss) { return ss.saStorage.ss_family != AF_INET6; });
+        }
+    }
+}
+
 ProtocolSupport
 IceInternal::getProtocolSupport(const Address& addr)
 {
@@ -923,6 +944,20 @@ IceInternal::compareAddress(const Address& addr1, const Address& addr2)
             return 1;
         }
     }
+#ifndef _WIN32
+    else if (addr1.saStorage.ss_family == AF_UNIX)
+    {
+        int res = strncmp(addr1.saUn.sun_path, addr2.saUn.sun_path, sizeof(addr1.saUn.sun_path));
+        if (res < 0)
+        {
+            return -1;
+        }
+        else if (res > 0)
+        {
+            return 1;
+        }
+    }
+#endif
     else
     {
         if (addr1.saIn6.sin6_port < addr2.saIn6.sin6_port)
@@ -948,6 +983,32 @@ IceInternal::compareAddress(const Address& addr1, const Address& addr2)
     return 0;
 }
 
+size_t
+IceInternal::hashAddress(const Address& addr)
+{
+    size_t h = 5381;
+    hashAdd(h, static_cast<int32_t>(addr.saStorage.ss_family));
+    if (addr.saStorage.ss_family == AF_INET)
+    {
+        hashAdd(h, static_cast<int32_t>(addr.saIn.sin_port));
+        hashAdd(h, static_cast<size_t>(addr.saIn.sin_addr.s_addr));
+    }
+#ifndef _WIN32
+    else if (addr.saStorage.ss_family == AF_UNIX)
+    {
+        hashAdd(h, string_view(addr.saUn.sun_path, strnlen(addr.saUn.sun_path, sizeof(addr.saUn.sun_path))));
+    }
+#endif
+    else
+    {
+        hashAdd(h, static_cast<int32_t>(addr.saIn6.sin6_port));
+        hashAdd(
+            h,
+            string_view(reinterpret_cast<const char*>(&addr.saIn6.sin6_addr), sizeof(addr.saIn6.sin6_addr)));
+    }
+    return h;
+}
+
 bool
 IceInternal::isIPv6Supported()
 {
@@ -1034,6 +1095,14 @@ IceInternal::closeSocket(SOCKET fd)
 string
 IceInternal::addrToString(const Address& addr)
 {
+#ifndef _WIN32
+    if (addr.saStorage.ss_family == AF_UNIX)
+    {
+        // The local address of a connected client socket is unnamed.
+        size_t length = strnlen(addr.saUn.sun_path, sizeof(addr.saUn.sun_path));
+        return length > 0 ? string{addr.saUn.sun_path, length} : "<unnamed>";
+    }
+#endif
     ostringstream s;
     s << inetAddrToString(addr) << ':' << getPort(addr);
     return s.str();
@@ -1530,6 +1599,22 @@ IceInternal::setReuseAddress(SOCKET fd, bool reuse)
     }
 }
 
+bool
+IceInternal::setReusePort([[maybe_unused]] SOCKET fd, [[maybe_unused]] bool reuse)
+{
+#if defined(SO_REUSEPORT) && !defined(_WIN32)
+    int flag = reuse ? 1 : 0;
+    if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, reinterpret_cast<char*>(&flag), int(sizeof(int))) == SOCKET_ERROR)
+    {
+        closeSocketNoThrow(fd);
+        throw SocketException(__FILE__, __LINE__, getSocketErrno());
+    }
+    return true;
+#else
+    return false; // Not supported on this platform.
+#endif
+}
+
 Address
 IceInternal::doBind(SOCKET fd, const Address& addr, const string&)
 {
@@ -1584,6 +1669,19 @@ IceInternal::normalizeIPv6Address(const string& host)
     return host;
 }
 
+#ifndef _WIN32
+Address
+IceInternal::getUnixAddress(const string& path)
+{
+    Address addr;
+    addr.saUn.sun_family = AF_UNIX;
+    // The endpoint checks the length of the path, the path is always null-terminated.
+    assert(!path.empty() && path.size() < sizeof(addr.saUn.sun_path));
+    memcpy(addr.saUn.sun_path, path.c_str(), path.size() + 1);
+    return addr;
+}
+#endif
+
 SyscallException::ErrorCode
 IceInternal::getSocketErrno()
 {
@@ -1763,7 +1861,12 @@ repeatConnect:
         }
 
         closeSocketNoThrow(fd);
+#ifndef _WIN32
+        // Connecting to a Unix domain socket that no server created fails with ENOENT.
+        if (connectionRefused() || (addr.saStorage.ss_family == AF_UNIX && errno == ENOENT))
+#else
         if (connectionRefused())
+#endif
         {
             throw ConnectionRefusedException{__FILE__, __LINE__};
         }
@@ -1871,8 +1974,10 @@ IceInternal::doAccept(SOCKET fd)
     int ret;
 #endif
 
+    Address addr;
 repeatAccept:
-    if ((ret = ::accept(fd, nullptr, nullptr)) == INVALID_SOCKET)
+    auto len = static_cast<socklen_t>(sizeof(sockaddr_storage));
+    if ((ret = ::accept(fd, &addr.sa, &len)) == INVALID_SOCKET)
     {
         if (acceptInterrupted())
         {
@@ -1882,6 +1987,12 @@ repeatAccept:
         throw SocketException(__FILE__, __LINE__, getSocketErrno());
     }
 
+#ifndef _WIN32
+    if (addr.saStorage.ss_family == AF_UNIX)
+    {
+        return ret; // The TCP options don't apply to Unix domain sockets.
+    }
+#endif
     setTcpNoDelay(ret);
     setKeepAlive(ret);
     return ret;
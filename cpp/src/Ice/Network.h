@@ -31,11 +31,21 @@ typedef int ssize_t;
 #    include <netinet/tcp.h>
 #    include <sys/poll.h>
 #    include <sys/socket.h>
+#    include <sys/un.h>
 #    include <unistd.h>
 #endif
 
 #if defined(__linux__) && !defined(ICE_NO_EPOLL)
 #    define ICE_USE_EPOLL 1
+//
+// The epoll selector can wait for the readiness of the file descriptors with io_uring poll requests instead of epoll
+// when the kernel supports it, the selector falls back to epoll otherwise.
+//
+#    if !defined(ICE_NO_IO_URING) && defined(__has_include)
+#        if __has_include(<linux/io_uring.h>)
+#            define ICE_USE_IO_URING 1
+#        endif
+#    endif
 #elif (defined(__APPLE__) || defined(__FreeBSD__) || defined(__FreeBSD_kernel__)) && TARGET_OS_IPHONE == 0
 #    define ICE_USE_KQUEUE 1
 #elif defined(__APPLE__)
@@ -89,6 +99,9 @@ namespace IceInternal
         sockaddr sa;
         sockaddr_in saIn;
         sockaddr_in6 saIn6;
+#ifndef _WIN32
+        sockaddr_un saUn;
+#endif
         sockaddr_storage saStorage;
     };
 
@@ -185,9 +198,11 @@ namespace IceInternal
     ICE_API std::string errorToStringDNS(ErrorCode);
     ICE_API std::vector<Address>
     getAddresses(const std::string&, int, ProtocolSupport, Ice::EndpointSelectionType, bool, bool);
+    ICE_API void sortAddresses(std::vector<Address>&, ProtocolSupport, Ice::EndpointSelectionType, bool);
     ICE_API ProtocolSupport getProtocolSupport(const Address&);
     ICE_API Address getAddressForServer(const std::string&, int, ProtocolSupport, bool, bool);
     ICE_API int compareAddress(const Address&, const Address&);
+    ICE_API std::size_t hashAddress(const Address&); // Consistent with compareAddress.
 
     ICE_API bool isIPv6Supported();
     ICE_API SOCKET createSocket(bool, const Address&);
@@ -225,6 +240,7 @@ namespace IceInternal
     ICE_API void setMcastInterface(SOCKET, const std::string&, const Address&);
     ICE_API void setMcastTtl(SOCKET, int, const Address&);
     ICE_API void setReuseAddress(SOCKET, bool);
+    ICE_API bool setReusePort(SOCKET, bool);
     ICE_API Address doBind(SOCKET, const Address&, const std::string& intf = "");
     ICE_API void doListen(SOCKET, int);
 
@@ -250,6 +266,9 @@ namespace IceInternal
 
     ICE_API Address getNumericAddress(const std::string&);
     ICE_API std::string normalizeIPv6Address(const std::string&);
+#ifndef _WIN32
+    ICE_API Address getUnixAddress(const std::string&);
+#endif
 
 #if defined(ICE_USE_IOCP)
     ICE_API void doConnectAsync(SOCKET, const Address&, const Address&, AsyncInfo&);
@@ -8,7 +8,6 @@
 #include "Ice/SlicedData.h"
 
 #include <algorithm>
-#include <array>
 #include <sstream>
 
 using namespace std;
@@ -111,46 +110,49 @@ Ice::Object::_iceD_ice_id(
 void
 Ice::Object::dispatch(IncomingRequest& request, std::function<void(OutgoingResponse)> sendResponse)
 {
-    static constexpr std::array<string_view, 4> allOperations{"ice_id", "ice_ids", "ice_isA", "ice_ping"};
-
     const Current& current = request.current();
-    auto r = equal_range(allOperations.begin(), allOperations.end(), current.operation);
-
-    if (r.first == r.second)
-    {
-        sendResponse(makeOutgoingResponse(make_exception_ptr(OperationNotExistException{__FILE__, __LINE__}), current));
-        return;
-    }
 
-    switch (r.first - allOperations.begin())
+    // Dispatch on the length of the operation name first, like the generated dispatch implementations.
+    switch (current.operation.size())
     {
-        case 0:
+        case 6:
         {
-            _iceD_ice_id(request, std::move(sendResponse));
-            break;
-        }
-        case 1:
-        {
-            _iceD_ice_ids(request, std::move(sendResponse));
+            if (current.operation == "ice_id")
+            {
+                _iceD_ice_id(request, std::move(sendResponse));
+                return;
+            }
             break;
         }
-        case 2:
+        case 7:
         {
-            _iceD_ice_isA(request, std::move(sendResponse));
+            if (current.operation == "ice_ids")
+            {
+                _iceD_ice_ids(request, std::move(sendResponse));
+                return;
+            }
+            if (current.operation == "ice_isA")
+            {
+                _iceD_ice_isA(request, std::move(sendResponse));
+                return;
+            }
             break;
         }
-        case 3:
+        case 8:
         {
-            _iceD_ice_ping(request, std::move(sendResponse));
+            if (current.operation == "ice_ping")
+            {
+                _iceD_ice_ping(request, std::move(sendResponse));
+                return;
+            }
             break;
         }
         default:
         {
-            assert(false);
-            sendResponse(
-                makeOutgoingResponse(make_exception_ptr(OperationNotExistException{__FILE__, __LINE__}), current));
+            break;
         }
     }
+    sendResponse(makeOutgoingResponse(make_exception_ptr(OperationNotExistException{__FILE__, __LINE__}), current));
 }
 
 void
@@ -592,11 +592,18 @@ Ice::ObjectAdapterI::getEndpoints() const noexcept
     lock_guard lock(_mutex);
 
     EndpointSeq endpoints;
-    transform(
-        _incomingConnectionFactories.begin(),
-        _incomingConnectionFactories.end(),
-        back_inserter(endpoints),
-        [](const IncomingConnectionFactoryPtr& factory) { return factory->endpoint(); });
+    for (const auto& factory : _incomingConnectionFactories)
+    {
+        // Factories sharing the same endpoint through SO_REUSEPORT are only listed once.
+        EndpointIPtr endpoint = factory->endpoint();
+        if (find_if(
+                endpoints.begin(),
+                endpoints.end(),
+                [&endpoint](const EndpointPtr& p) { return *endpoint == *p; }) == endpoints.end())
+        {
+            endpoints.push_back(endpoint);
+        }
+    }
     return endpoints;
 }
 
@@ -957,13 +964,38 @@ Ice::ObjectAdapterI::initialize(optional<RouterPrx> router)
             // fill in the real port number.
             //
             vector<EndpointIPtr> endpoints = parseEndpoints(properties->getProperty(_name + ".Endpoints"), true);
+            int acceptors = properties->getPropertyAsIntWithDefault(_name + ".Acceptors", 1);
             for (const auto& endpoint : endpoints)
             {
                 for (const auto& expanded : endpoint->expandHost())
                 {
-                    auto factory = make_shared<IncomingConnectionFactory>(_instance, expanded, shared_from_this());
+                    auto factory = make_shared<IncomingConnectionFactory>(
+                        _instance,
+                        expanded,
+                        shared_from_this(),
+                        acceptors > 1 && !expanded->datagram() ? 0 : -1);
                     factory->initialize();
                     _incomingConnectionFactories.push_back(factory);
+
+                    //
+                    // If the acceptor listens with SO_REUSEPORT, create the additional acceptors. They listen on the
+                    // endpoint of the first acceptor, which provides the port if the endpoint uses a system-assigned
+                    // port. The kernel load-balances the incoming connections between the acceptors.
+                    //
+                    // Note that while the port is bound with SO_REUSEPORT, any other process running with the same
+                    // user ID can also bind it with SO_REUSEPORT and receive a share of the incoming connections.
+                    //
+                    if (factory->reusePort())
+                    {
+                        EndpointIPtr listening = factory->endpoint();
+                        for (int i = 1; i < acceptors; ++i)
+                        {
+                            auto shard =
+                                make_shared<IncomingConnectionFactory>(_instance, listening, shared_from_this(), i);
+                            shard->initialize();
+                            _incomingConnectionFactories.push_back(shard);
+                        }
+                    }
                 }
             }
             if (endpoints.empty())
@@ -1,9 +1,11 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "Ice/OutgoingAsync.h"
+#include "BufferPool.h"
 #include "CollocatedRequestHandler.h"
 #include "ConnectionFactory.h"
 #include "ConnectionI.h"
+#include "EndpointLatencyTable.h"
 #include "Ice/ImplicitContext.h"
 #include "Ice/LocalExceptions.h"
 #include "Ice/LoggerUtil.h"
@@ -18,6 +20,9 @@
 #include "ThreadPool.h"
 #include "TraceLevels.h"
 
+#include <cstring>
+#include <new>
+
 using namespace std;
 using namespace Ice;
 using namespace IceInternal;
@@ -27,6 +32,40 @@ const unsigned char OutgoingAsyncBase::Sent = 0x2;
 
 OutgoingAsyncCompletionCallback::~OutgoingAsyncCompletionCallback() = default; // Out of line to avoid weak vtable
 
+namespace
+{
+    // The header stored in front of each outgoing async: the capacity of its block. Its size preserves the alignment
+    // of the blocks returned by malloc.
+    const size_t outgoingAsyncHeaderSize = alignof(max_align_t);
+}
+
+void*
+IceInternal::allocateOutgoingAsync(size_t size)
+{
+    // With the buffer pool enabled, the block is a block of the pool and its capacity is a size class. Otherwise, it's
+    // allocated with malloc with the requested size. The release uses the recorded capacity: a block allocated by the
+    // pool is freed if the pool is disabled in the meantime, and a block allocated with malloc is only cached by the
+    // pool if its capacity happens to be a size class.
+    const size_t capacity = bufferCapacity(size + outgoingAsyncHeaderSize);
+    byte* block = allocateBuffer(capacity);
+    if (!block)
+    {
+        throw std::bad_alloc();
+    }
+    memcpy(block, &capacity, sizeof(capacity));
+    return block + outgoingAsyncHeaderSize;
+}
+
+void
+IceInternal::releaseOutgoingAsync(void* p, [[maybe_unused]] size_t size) noexcept
+{
+    byte* block = static_cast<byte*>(p) - outgoingAsyncHeaderSize;
+    size_t capacity;
+    memcpy(&capacity, block, sizeof(capacity));
+    assert(capacity >= size + outgoingAsyncHeaderSize);
+    releaseBuffer(block, capacity);
+}
+
 bool
 OutgoingAsyncBase::sent()
 {
@@ -873,6 +912,16 @@ OutgoingAsync::response()
         _childObserver.detach();
     }
 
+    if (_invokeRemoteTime)
+    {
+        // The latency is only recorded for outgoing connections.
+        const auto& latency = static_pointer_cast<ConnectionI>(_cachedConnection)->endpointLatency();
+        if (latency)
+        {
+            latency->invocationCompleted(chrono::steady_clock::now() - *_invokeRemoteTime);
+        }
+    }
+
     uint8_t replyStatus;
     try
     {
@@ -1015,12 +1064,17 @@ AsyncStatus
 OutgoingAsync::invokeRemote(const ConnectionIPtr& connection, bool compress, bool response)
 {
     _cachedConnection = connection;
+    if (_proxy._getReference()->getEndpointSelection() == EndpointSelectionType::Latency)
+    {
+        _invokeRemoteTime = chrono::steady_clock::now();
+    }
     return connection->sendAsyncRequest(shared_from_this(), compress, response, 0);
 }
 
 AsyncStatus
 OutgoingAsync::invokeCollocated(CollocatedRequestHandler* handler)
 {
+    _invokeRemoteTime = nullopt;
     return handler->invokeAsyncRequest(this, 0, _synchronous);
 }
 
@@ -13,9 +13,11 @@ const Property ProxyPropsData[] =
 {
     Property{"EndpointSelection", "", false, false, nullptr},
     Property{"ConnectionCached", "", false, false, nullptr},
+    Property{"ConnectionPoolSize", "", false, false, nullptr},
     Property{"PreferSecure", "", false, false, nullptr},
     Property{"LocatorCacheTimeout", "", false, false, nullptr},
     Property{"InvocationTimeout", "", false, false, nullptr},
+    Property{"BatchAutoFlushInterval", "", false, false, nullptr},
     Property{"Locator", "", false, false, &PropertyNames::ProxyProps},
     Property{"Router", "", false, false, &PropertyNames::ProxyProps},
     Property{"CollocationOptimized", "", false, false, nullptr},
@@ -28,7 +30,7 @@ const PropertyArray PropertyNames::ProxyProps
     .prefixOnly=false,
     .isOptIn=false,
     .properties=ProxyPropsData,
-    .length=9
+    .length=11
 };
 
 const Property ConnectionPropsData[] =
@@ -56,7 +58,9 @@ const Property ThreadPoolPropsData[] =
     Property{"SizeMax", "", false, false, nullptr},
     Property{"SizeWarn", "0", false, false, nullptr},
     Property{"Serialize", "0", false, false, nullptr},
-    Property{"ThreadIdleTime", "60", false, false, nullptr}
+    Property{"ThreadIdleTime", "60", false, false, nullptr},
+    Property{"Reactors", "1", false, false, nullptr},
+    Property{"IoUring", "0", false, false, nullptr}
 };
 
 const PropertyArray PropertyNames::ThreadPoolProps
@@ -65,7 +69,7 @@ const PropertyArray PropertyNames::ThreadPoolProps
     .prefixOnly=true,
     .isOptIn=false,
     .properties=ThreadPoolPropsData,
-    .length=5
+    .length=7
 };
 
 const Property ObjectAdapterPropsData[] =
@@ -81,6 +85,7 @@ const Property ObjectAdapterPropsData[] =
     Property{"ProxyOptions", "", false, false, nullptr},
     Property{"ThreadPool", "", false, false, &PropertyNames::ThreadPoolProps},
     Property{"MaxConnections", "0", false, false, nullptr},
+    Property{"Acceptors", "1", false, false, nullptr},
     Property{"MessageSizeMax", "", false, false, nullptr}
 };
 
@@ -90,7 +95,7 @@ const PropertyArray PropertyNames::ObjectAdapterProps
     .prefixOnly=true,
     .isOptIn=false,
     .properties=ObjectAdapterPropsData,
-    .length=12
+    .length=13
 };
 
 const Property LMDBPropsData[] =
@@ -123,12 +128,19 @@ const Property IcePropsData[] =
     Property{"BackgroundLocatorCacheUpdates", "0", false, false, nullptr},
     Property{"BatchAutoFlush", "", false, true, nullptr},
     Property{"BatchAutoFlushSize", "1024", false, false, nullptr},
+    Property{"BatchAutoFlushInterval", "0", false, false, nullptr},
+    Property{"BufferPool", "0", false, false, nullptr},
     Property{"ClassGraphDepthMax", "10", false, false, nullptr},
+    Property{"Compression.Codec", "bzip2", false, false, nullptr},
+    Property{"Compression.Dictionary", "", false, false, nullptr},
     Property{"Compression.Level", "1", false, false, nullptr},
+    Property{"Compression.Threshold", "100", false, false, nullptr},
     Property{"Config", "", false, false, nullptr},
+    Property{"ConnectAttemptDelay", "0", false, false, nullptr},
     Property{"Connection.Client", "", false, false, &PropertyNames::ConnectionProps},
     Property{"Connection.Server", "", false, false, &PropertyNames::ConnectionProps},
     Property{"Default.CollocationOptimized", "1", false, false, nullptr},
+    Property{"Default.ConnectionPoolSize", "1", false, false, nullptr},
     Property{"Default.EncodingVersion", "1.1", false, false, nullptr},
     Property{"Default.EndpointSelection", "Random", false, false, nullptr},
     Property{"Default.Host", "", false, false, nullptr},
@@ -143,10 +155,15 @@ const Property IcePropsData[] =
     Property{"EventLog.Source", "", false, false, nullptr},
     Property{"HTTPProxyHost", "", false, false, nullptr},
     Property{"HTTPProxyPort", "1080", false, false, nullptr},
+    Property{"HostResolver.CacheTTL", "0", false, false, nullptr},
+    Property{"HostResolver.NegativeCacheTTL", "0", false, false, nullptr},
+    Property{"HostResolver.PreResolve", "", false, false, nullptr},
+    Property{"HostResolver.Size", "1", false, false, nullptr},
     Property{"ImplicitContext", "None", false, false, nullptr},
     Property{"InitPlugins", "1", false, false, nullptr},
     Property{"IPv4", "1", false, false, nullptr},
     Property{"IPv6", "1", false, false, nullptr},
+    Property{"LatencyExplorationInterval", "60", false, false, nullptr},
     Property{"LogFile", "", false, false, nullptr},
     Property{"LogFile.SizeMax", "0", false, false, nullptr},
     Property{"LogStdErr.Convert", "1", false, false, nullptr},
@@ -163,6 +180,7 @@ const Property IcePropsData[] =
     Property{"ProgramName", "", false, false, nullptr},
     Property{"RetryIntervals", "0", false, false, nullptr},
     Property{"ServerIdleTime", "0", false, false, nullptr},
+    Property{"Shm.RingSize", "4194304", false, false, nullptr},
     Property{"SOCKSProxyHost", "", false, false, nullptr},
     Property{"SOCKSProxyPort", "1080", false, false, nullptr},
     Property{"StdErr", "", false, false, nullptr},
@@ -170,6 +188,7 @@ const Property IcePropsData[] =
     Property{"SyslogFacility", "LOG_USER", false, false, nullptr},
     Property{"ThreadPool.Client", "", false, false, &PropertyNames::ThreadPoolProps},
     Property{"ThreadPool.Server", "", false, false, &PropertyNames::ThreadPoolProps},
+    Property{"TimerWheelTick", "0", false, false, nullptr},
     Property{"ToStringMode", "Unicode", false, false, nullptr},
     Property{"Trace.Admin.Properties", "0", false, false, nullptr},
     Property{"Trace.Admin.Logger", "0", false, false, nullptr},
@@ -183,6 +202,8 @@ const Property IcePropsData[] =
     Property{"UDP.SndSize", "", false, false, nullptr},
     Property{"TCP.Backlog", "511", false, false, nullptr},
     Property{"TCP.RcvSize", "", false, false, nullptr},
+    Property{"TCP.ReadAheadSize", "0", false, false, nullptr},
+    Property{"TCP.ZeroCopyThreshold", "0", false, false, nullptr},
     Property{"TCP.SndSize", "", false, false, nullptr},
     Property{"UseOSLog", "0", false, false, nullptr},
     Property{"UseSyslog", "0", false, false, nullptr},
@@ -201,7 +222,7 @@ const PropertyArray PropertyNames::IceProps
     .prefixOnly=false,
     .isOptIn=false,
     .properties=IcePropsData,
-    .length=83
+    .length=99
 };
 
 const Property IceMXPropsData[] =
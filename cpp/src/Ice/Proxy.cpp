@@ -117,6 +117,12 @@ Ice::ObjectPrx::ice_isConnectionCached() const noexcept
     return _reference->getCacheConnection();
 }
 
+int
+Ice::ObjectPrx::ice_getConnectionPoolSize() const noexcept
+{
+    return _reference->getConnectionPoolSize();
+}
+
 EndpointSelectionType
 Ice::ObjectPrx::ice_getEndpointSelection() const noexcept
 {
@@ -167,6 +173,12 @@ Ice::ObjectPrx::ice_getInvocationTimeout() const noexcept
     return _reference->getInvocationTimeout();
 }
 
+chrono::microseconds
+Ice::ObjectPrx::ice_getBatchAutoFlushInterval() const noexcept
+{
+    return _reference->getBatchAutoFlushInterval();
+}
+
 bool
 Ice::ObjectPrx::ice_isTwoway() const noexcept
 {
@@ -270,6 +282,19 @@ Ice::ObjectPrx::_adapterId(string newAdapterId) const
     }
 }
 
+ReferencePtr
+Ice::ObjectPrx::_batchAutoFlushInterval(chrono::microseconds newInterval) const
+{
+    if (newInterval == _reference->getBatchAutoFlushInterval())
+    {
+        return _reference;
+    }
+    else
+    {
+        return _reference->changeBatchAutoFlushInterval(newInterval);
+    }
+}
+
 ReferencePtr
 Ice::ObjectPrx::_batchDatagram() const
 {
@@ -350,6 +375,24 @@ Ice::ObjectPrx::_connectionId(string id) const
     }
 }
 
+ReferencePtr
+Ice::ObjectPrx::_connectionPoolSize(int newSize) const
+{
+    if (newSize < 1)
+    {
+        throw invalid_argument("invalid connection pool size passed to ice_connectionPoolSize");
+    }
+
+    if (newSize == _reference->getConnectionPoolSize())
+    {
+        return _reference;
+    }
+    else
+    {
+        return _reference->changeConnectionPoolSize(newSize);
+    }
+}
+
 ReferencePtr
 Ice::ObjectPrx::_context(Context newContext) const
 {
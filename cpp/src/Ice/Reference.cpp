@@ -4,9 +4,11 @@
 #include "CollocatedRequestHandler.h"
 #include "ConnectRequestHandler.h"
 #include "ConnectionFactory.h"
+#include "ConnectionPoolRequestHandler.h"
 #include "ConnectionI.h"
 #include "DefaultsAndOverrides.h"
 #include "EndpointI.h"
+#include "EndpointLatencyTable.h"
 #include "FixedRequestHandler.h"
 #include "HashUtil.h"
 #include "Ice/Comparable.h"
@@ -86,6 +88,14 @@ IceInternal::Reference::changeInvocationTimeout(chrono::milliseconds invocationT
     return r;
 }
 
+ReferencePtr
+IceInternal::Reference::changeBatchAutoFlushInterval(chrono::microseconds interval) const
+{
+    ReferencePtr r = clone();
+    r->_batchAutoFlushInterval = interval;
+    return r;
+}
+
 ReferencePtr
 IceInternal::Reference::changeEncoding(Ice::EncodingVersion encoding) const
 {
@@ -102,6 +112,12 @@ IceInternal::Reference::changeCompress(bool newCompress) const
     return r;
 }
 
+chrono::microseconds
+IceInternal::Reference::getBatchAutoFlushInterval() const noexcept
+{
+    return _batchAutoFlushInterval.value_or(_instance->batchAutoFlushInterval());
+}
+
 optional<bool>
 IceInternal::Reference::getCompressOverride() const noexcept
 {
@@ -124,6 +140,7 @@ Reference::hash() const noexcept
     hashAdd(h, _compress);
     // We don't include protocol and encoding in the hash; they are using 1.0 and 1.1, respectively.
     hashAdd(h, _invocationTimeout.count());
+    hashAdd(h, getBatchAutoFlushInterval().count());
     return h;
 }
 
@@ -324,6 +341,11 @@ IceInternal::Reference::operator==(const Reference& r) const noexcept
     {
         return false;
     }
+
+    if (getBatchAutoFlushInterval() != r.getBatchAutoFlushInterval())
+    {
+        return false;
+    }
     return true;
 }
 
@@ -415,6 +437,15 @@ IceInternal::Reference::operator<(const Reference& r) const noexcept
         return false;
     }
 
+    if (getBatchAutoFlushInterval() < r.getBatchAutoFlushInterval())
+    {
+        return true;
+    }
+    else if (r.getBatchAutoFlushInterval() < getBatchAutoFlushInterval())
+    {
+        return false;
+    }
+
     return false;
 }
 
@@ -456,7 +487,8 @@ IceInternal::Reference::Reference(const Reference& r)
       _facet(r._facet),
       _protocol(r._protocol),
       _encoding(r._encoding),
-      _invocationTimeout(r._invocationTimeout)
+      _invocationTimeout(r._invocationTimeout),
+      _batchAutoFlushInterval(r._batchAutoFlushInterval)
 {
 }
 
@@ -513,6 +545,12 @@ IceInternal::FixedReference::getCacheConnection() const noexcept
     return true;
 }
 
+int
+IceInternal::FixedReference::getConnectionPoolSize() const noexcept
+{
+    return 1;
+}
+
 bool
 IceInternal::FixedReference::getPreferSecure() const noexcept
 {
@@ -573,6 +611,12 @@ IceInternal::FixedReference::changeCacheConnection(bool) const
     throw FixedProxyException(__FILE__, __LINE__);
 }
 
+ReferencePtr
+IceInternal::FixedReference::changeConnectionPoolSize(int) const
+{
+    throw FixedProxyException(__FILE__, __LINE__);
+}
+
 ReferencePtr
 IceInternal::FixedReference::changePreferSecure(bool) const
 {
@@ -778,6 +822,7 @@ IceInternal::RoutableReference::RoutableReference(
       _routerInfo(std::move(routerInfo)),
       _collocationOptimized(collocationOptimized),
       _cacheConnection(cacheConnection),
+      _connectionPoolSize(getInstance()->defaultsAndOverrides()->defaultConnectionPoolSize),
       _preferSecure(preferSecure),
       _endpointSelection(endpointSelection),
       _locatorCacheTimeout(locatorCacheTimeout)
@@ -822,6 +867,12 @@ IceInternal::RoutableReference::getCacheConnection() const noexcept
     return _cacheConnection;
 }
 
+int
+IceInternal::RoutableReference::getConnectionPoolSize() const noexcept
+{
+    return _connectionPoolSize;
+}
+
 bool
 IceInternal::RoutableReference::getPreferSecure() const noexcept
 {
@@ -940,6 +991,14 @@ IceInternal::RoutableReference::changeCacheConnection(bool newCache) const
     return r;
 }
 
+ReferencePtr
+IceInternal::RoutableReference::changeConnectionPoolSize(int newSize) const
+{
+    RoutableReferencePtr r = dynamic_pointer_cast<RoutableReference>(clone());
+    r->_connectionPoolSize = newSize;
+    return r;
+}
+
 ReferencePtr
 IceInternal::RoutableReference::changePreferSecure(bool newPreferSecure) const
 {
@@ -1094,11 +1153,35 @@ IceInternal::RoutableReference::toProperty(string prefix) const
     properties[prefix + ".CollocationOptimized"] = _collocationOptimized ? "1" : "0";
     properties[prefix + ".ConnectionCached"] = _cacheConnection ? "1" : "0";
     properties[prefix + ".PreferSecure"] = _preferSecure ? "1" : "0";
-    properties[prefix + ".EndpointSelection"] =
-        _endpointSelection == EndpointSelectionType::Random ? "Random" : "Ordered";
+    switch (_endpointSelection)
+    {
+        case EndpointSelectionType::Random:
+        {
+            properties[prefix + ".EndpointSelection"] = "Random";
+            break;
+        }
+        case EndpointSelectionType::Ordered:
+        {
+            properties[prefix + ".EndpointSelection"] = "Ordered";
+            break;
+        }
+        case EndpointSelectionType::Latency:
+        {
+            properties[prefix + ".EndpointSelection"] = "Latency";
+            break;
+        }
+    }
     properties[prefix + ".LocatorCacheTimeout"] =
         to_string(chrono::duration_cast<chrono::seconds>(_locatorCacheTimeout).count());
     properties[prefix + ".InvocationTimeout"] = to_string(getInvocationTimeout().count());
+    if (getBatchAutoFlushInterval() != getInstance()->batchAutoFlushInterval())
+    {
+        properties[prefix + ".BatchAutoFlushInterval"] = to_string(getBatchAutoFlushInterval().count());
+    }
+    if (_connectionPoolSize != getInstance()->defaultsAndOverrides()->defaultConnectionPoolSize)
+    {
+        properties[prefix + ".ConnectionPoolSize"] = to_string(_connectionPoolSize);
+    }
 
     if (_routerInfo)
     {
@@ -1160,6 +1243,10 @@ IceInternal::RoutableReference::operator==(const Reference& r) const noexcept
     {
         return false;
     }
+    if (_connectionPoolSize != rhs->_connectionPoolSize)
+    {
+        return false;
+    }
     if (_endpointSelection != rhs->_endpointSelection)
     {
         return false;
@@ -1248,6 +1335,14 @@ IceInternal::RoutableReference::operator<(const Reference& r) const noexcept
     {
         return false;
     }
+    if (_connectionPoolSize < rhs->_connectionPoolSize)
+    {
+        return true;
+    }
+    else if (rhs->_connectionPoolSize < _connectionPoolSize)
+    {
+        return false;
+    }
     if (_endpointSelection < rhs->_endpointSelection)
     {
         return true;
@@ -1332,6 +1427,29 @@ IceInternal::RoutableReference::getRequestHandler() const
         }
     }
 
+    if (_cacheConnection && _connectionPoolSize > 1)
+    {
+        // The connections of the pool are distinguished by their connection ID, derived from the connection ID of this
+        // reference. Proxies with the same endpoints and pool size share the connections of the pool.
+        vector<RequestHandlerPtr> handlers;
+        handlers.reserve(static_cast<size_t>(_connectionPoolSize));
+        handlers.push_back(getConnectRequestHandler());
+        for (int i = 1; i < _connectionPoolSize; ++i)
+        {
+            auto ref = dynamic_pointer_cast<RoutableReference>(changeConnectionId(_connectionId + "#" + to_string(i)));
+            handlers.push_back(ref->getConnectRequestHandler());
+        }
+        return make_shared<ConnectionPoolRequestHandler>(self, std::move(handlers));
+    }
+
+    return getConnectRequestHandler();
+}
+
+RequestHandlerPtr
+IceInternal::RoutableReference::getConnectRequestHandler() const
+{
+    auto self = const_cast<RoutableReference*>(this)->shared_from_this();
+
     ConnectRequestHandlerPtr handler = make_shared<ConnectRequestHandler>(self);
     getConnectionAsync(
         [handler](Ice::ConnectionIPtr connection, bool compress)
@@ -1607,6 +1725,7 @@ IceInternal::RoutableReference::RoutableReference(const RoutableReference& r)
       _routerInfo(r._routerInfo),
       _collocationOptimized(r._collocationOptimized),
       _cacheConnection(r._cacheConnection),
+      _connectionPoolSize(r._connectionPoolSize),
       _preferSecure(r._preferSecure),
       _endpointSelection(r._endpointSelection),
       _locatorCacheTimeout(r._locatorCacheTimeout),
@@ -1668,6 +1787,13 @@ IceInternal::RoutableReference::filterEndpoints(const vector<EndpointIPtr>& allE
             // Nothing to do.
             break;
         }
+        case EndpointSelectionType::Latency:
+        {
+            // The endpoints with the same latency rank are used in random order.
+            IceInternal::shuffle(endpoints.begin(), endpoints.end());
+            getInstance()->endpointLatencyTable()->sort(endpoints);
+            break;
+        }
         default:
         {
             assert(false);
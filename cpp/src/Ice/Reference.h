@@ -56,6 +56,9 @@ namespace IceInternal
         [[nodiscard]] std::chrono::milliseconds getInvocationTimeout() const noexcept { return _invocationTimeout; }
         [[nodiscard]] std::optional<bool> getCompress() const noexcept { return _compress; }
 
+        // Gets the batch auto-flush interval of this reference, or the communicator's default if not set.
+        [[nodiscard]] std::chrono::microseconds getBatchAutoFlushInterval() const noexcept;
+
         [[nodiscard]] Ice::CommunicatorPtr getCommunicator() const noexcept;
 
         [[nodiscard]] virtual std::vector<EndpointIPtr> getEndpoints() const = 0;
@@ -64,6 +67,7 @@ namespace IceInternal
         [[nodiscard]] virtual RouterInfoPtr getRouterInfo() const noexcept { return nullptr; }
         [[nodiscard]] virtual bool getCollocationOptimized() const noexcept = 0;
         [[nodiscard]] virtual bool getCacheConnection() const noexcept = 0;
+        [[nodiscard]] virtual int getConnectionPoolSize() const noexcept = 0;
         [[nodiscard]] virtual bool getPreferSecure() const noexcept = 0;
         [[nodiscard]] virtual Ice::EndpointSelectionType getEndpointSelection() const noexcept = 0;
         [[nodiscard]] virtual std::chrono::milliseconds getLocatorCacheTimeout() const noexcept = 0;
@@ -79,6 +83,7 @@ namespace IceInternal
         [[nodiscard]] ReferencePtr changeIdentity(Ice::Identity) const;
         [[nodiscard]] ReferencePtr changeFacet(std::string) const;
         [[nodiscard]] ReferencePtr changeInvocationTimeout(std::chrono::milliseconds) const;
+        [[nodiscard]] ReferencePtr changeBatchAutoFlushInterval(std::chrono::microseconds) const;
 
         [[nodiscard]] virtual ReferencePtr changeEncoding(Ice::EncodingVersion) const;
         [[nodiscard]] virtual ReferencePtr changeCompress(bool) const;
@@ -90,6 +95,7 @@ namespace IceInternal
         [[nodiscard]] virtual ReferencePtr changeCollocationOptimized(bool) const = 0;
         [[nodiscard]] virtual ReferencePtr changeLocatorCacheTimeout(std::chrono::milliseconds) const = 0;
         [[nodiscard]] virtual ReferencePtr changeCacheConnection(bool) const = 0;
+        [[nodiscard]] virtual ReferencePtr changeConnectionPoolSize(int) const = 0;
         [[nodiscard]] virtual ReferencePtr changePreferSecure(bool) const = 0;
         [[nodiscard]] virtual ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const = 0;
 
@@ -167,6 +173,7 @@ namespace IceInternal
         Ice::ProtocolVersion _protocol;
         Ice::EncodingVersion _encoding;
         std::chrono::milliseconds _invocationTimeout;
+        std::optional<std::chrono::microseconds> _batchAutoFlushInterval;
     };
 
     class FixedReference final : public Reference
@@ -192,6 +199,7 @@ namespace IceInternal
         [[nodiscard]] std::string getAdapterId() const final;
         [[nodiscard]] bool getCollocationOptimized() const noexcept final;
         [[nodiscard]] bool getCacheConnection() const noexcept final;
+        [[nodiscard]] int getConnectionPoolSize() const noexcept final;
         [[nodiscard]] bool getPreferSecure() const noexcept final;
         [[nodiscard]] Ice::EndpointSelectionType getEndpointSelection() const noexcept final;
         [[nodiscard]] std::chrono::milliseconds getLocatorCacheTimeout() const noexcept final;
@@ -203,6 +211,7 @@ namespace IceInternal
         [[nodiscard]] ReferencePtr changeRouter(std::optional<Ice::RouterPrx>) const final;
         [[nodiscard]] ReferencePtr changeCollocationOptimized(bool) const final;
         [[nodiscard]] ReferencePtr changeCacheConnection(bool) const final;
+        [[nodiscard]] ReferencePtr changeConnectionPoolSize(int) const final;
         [[nodiscard]] ReferencePtr changePreferSecure(bool) const final;
         [[nodiscard]] ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const final;
         [[nodiscard]] ReferencePtr changeLocatorCacheTimeout(std::chrono::milliseconds) const final;
@@ -263,6 +272,7 @@ namespace IceInternal
         [[nodiscard]] RouterInfoPtr getRouterInfo() const noexcept final;
         [[nodiscard]] bool getCollocationOptimized() const noexcept final;
         [[nodiscard]] bool getCacheConnection() const noexcept final;
+        [[nodiscard]] int getConnectionPoolSize() const noexcept final;
         [[nodiscard]] bool getPreferSecure() const noexcept final;
         [[nodiscard]] Ice::EndpointSelectionType getEndpointSelection() const noexcept final;
         [[nodiscard]] std::chrono::milliseconds getLocatorCacheTimeout() const noexcept final;
@@ -277,6 +287,7 @@ namespace IceInternal
         [[nodiscard]] ReferencePtr changeRouter(std::optional<Ice::RouterPrx>) const final;
         [[nodiscard]] ReferencePtr changeCollocationOptimized(bool) const final;
         [[nodiscard]] ReferencePtr changeCacheConnection(bool) const final;
+        [[nodiscard]] ReferencePtr changeConnectionPoolSize(int) const final;
         [[nodiscard]] ReferencePtr changePreferSecure(bool) const final;
         [[nodiscard]] ReferencePtr changeEndpointSelection(Ice::EndpointSelectionType) const final;
         [[nodiscard]] ReferencePtr changeLocatorCacheTimeout(std::chrono::milliseconds) const final;
@@ -311,6 +322,9 @@ namespace IceInternal
         [[nodiscard]] std::vector<EndpointIPtr> filterEndpoints(const std::vector<EndpointIPtr>&) const;
 
     private:
+        // Returns a connect request handler which establishes or finds the connection of this reference.
+        [[nodiscard]] RequestHandlerPtr getConnectRequestHandler() const;
+
         void createConnectionAsync(
             const std::vector<EndpointIPtr>&,
             std::function<void(Ice::ConnectionIPtr, bool)> response,
@@ -332,6 +346,7 @@ namespace IceInternal
         RouterInfoPtr _routerInfo;   // Null if no router is used.
         bool _collocationOptimized;
         bool _cacheConnection;
+        int _connectionPoolSize;
         bool _preferSecure;
         Ice::EndpointSelectionType _endpointSelection;
         std::chrono::milliseconds _locatorCacheTimeout;
@@ -791,12 +791,17 @@ IceInternal::ReferenceFactory::create(
             {
                 endpointSelection = EndpointSelectionType::Ordered;
             }
+            else if (type == "Latency")
+            {
+                endpointSelection = EndpointSelectionType::Latency;
+            }
             else
             {
                 throw ParseException(
                     __FILE__,
                     __LINE__,
-                    "illegal value '" + type + "' for property " + property + "; expected 'Random' or 'Ordered'");
+                    "illegal value '" + type + "' for property " + property +
+                        "; expected 'Random', 'Ordered' or 'Latency'");
             }
         }
 
@@ -819,7 +824,7 @@ IceInternal::ReferenceFactory::create(
     //
     // Create new reference
     //
-    return make_shared<RoutableReference>(
+    auto reference = make_shared<RoutableReference>(
         _instance,
         _communicator,
         std::move(ident),
@@ -840,4 +845,24 @@ IceInternal::ReferenceFactory::create(
         locatorCacheTimeout,
         invocationTimeout,
         std::move(ctx));
+
+    if (!propertyPrefix.empty())
+    {
+        string property = propertyPrefix + ".BatchAutoFlushInterval";
+        PropertiesPtr properties = _instance->initializationData().properties;
+        if (!properties->getProperty(property).empty())
+        {
+            int32_t interval = properties->getPropertyAsInt(property);
+            reference = static_pointer_cast<RoutableReference>(
+                reference->changeBatchAutoFlushInterval(chrono::microseconds(max(interval, 0))));
+        }
+
+        property = propertyPrefix + ".ConnectionPoolSize";
+        if (!properties->getProperty(property).empty())
+        {
+            int32_t size = properties->getPropertyAsInt(property);
+            reference = static_pointer_cast<RoutableReference>(reference->changeConnectionPoolSize(max(size, 1)));
+        }
+    }
+    return reference;
 }
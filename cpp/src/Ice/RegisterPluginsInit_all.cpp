@@ -10,6 +10,9 @@ extern "C"
     Ice::Plugin* createIceTCP(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
     Ice::Plugin* createIceWS(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
     Ice::Plugin* createIceSSL(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
+#if !defined(_WIN32)
+    Ice::Plugin* createIceUnix(const Ice::CommunicatorPtr&, const std::string&, const Ice::StringSeq&);
+#endif
 }
 
 IceInternal::RegisterPluginsInit::RegisterPluginsInit() noexcept
@@ -17,7 +20,10 @@ IceInternal::RegisterPluginsInit::RegisterPluginsInit() noexcept
     Ice::registerPluginFactory("IceTCP", createIceTCP, true);
     Ice::registerPluginFactory("IceSSL", createIceSSL, true);
 
-    // Include the UDP and WS transport plugins with "shared" builds.
+    // Include the UDP, WS and Unix transport plugins with "shared" builds.
     Ice::registerPluginFactory("IceUDP", createIceUDP, true);
     Ice::registerPluginFactory("IceWS", createIceWS, true);
+#if !defined(_WIN32)
+    Ice::registerPluginFactory("IceUnix", createIceUnix, true);
+#endif
 }
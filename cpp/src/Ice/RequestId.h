@@ -0,0 +1,29 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_REQUEST_ID_H
+#define ICE_REQUEST_ID_H
+
+#include <atomic>
+#include <cstdint>
+
+namespace IceInternal
+{
+    /// Gets a new request ID without locking the connection mutex. Request IDs are strictly positive: once the
+    /// counter overflows, it wraps around to 1.
+    /// @param counter The request ID counter of the connection, which holds the next request ID.
+    /// @return The new request ID.
+    inline std::int32_t nextRequestId(std::atomic<std::int32_t>& counter) noexcept
+    {
+        std::int32_t requestId = counter++;
+        while (requestId <= 0)
+        {
+            // Wrap around, unless another thread already did.
+            std::int32_t expected = requestId + 1;
+            counter.compare_exchange_strong(expected, 1);
+            requestId = counter++;
+        }
+        return requestId;
+    }
+}
+
+#endif
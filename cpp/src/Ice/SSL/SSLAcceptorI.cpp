@@ -45,6 +45,12 @@ Ice::SSL::AcceptorI::listen()
     return _endpoint;
 }
 
+bool
+Ice::SSL::AcceptorI::setReusePort()
+{
+    return _delegate->setReusePort();
+}
+
 #if defined(ICE_USE_IOCP)
 void
 Ice::SSL::AcceptorI::startAccept()
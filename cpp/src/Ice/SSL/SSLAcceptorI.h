@@ -31,6 +31,7 @@ namespace Ice::SSL
 
         void close() final;
         IceInternal::EndpointIPtr listen() final;
+        bool setReusePort() final;
 #if defined(ICE_USE_IOCP)
         void startAccept() final;
         void finishAccept() final;
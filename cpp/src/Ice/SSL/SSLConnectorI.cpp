@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "SSLConnectorI.h"
+#include "../HashUtil.h"
 #include "Ice/SSL/ClientAuthenticationOptions.h"
 #include "SSLEngine.h"
 #include "SSLInstance.h"
@@ -47,6 +48,14 @@ Ice::SSL::ConnectorI::toString() const
     return _delegate->toString();
 }
 
+size_t
+Ice::SSL::ConnectorI::hash() const noexcept
+{
+    size_t h = _delegate->hash();
+    IceInternal::hashAdd(h, static_cast<int32_t>(type()));
+    return h;
+}
+
 bool
 Ice::SSL::ConnectorI::operator==(const IceInternal::Connector& r) const
 {
@@ -24,6 +24,7 @@ namespace Ice::SSL
 
         bool operator==(const IceInternal::Connector&) const final;
         bool operator<(const IceInternal::Connector&) const final;
+        [[nodiscard]] std::size_t hash() const noexcept final;
 
     private:
         friend class EndpointI;
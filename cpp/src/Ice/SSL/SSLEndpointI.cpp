@@ -158,6 +158,12 @@ Ice::SSL::EndpointI::compress(bool compress) const
     }
 }
 
+uint8_t
+Ice::SSL::EndpointI::compressionCodec() const
+{
+    return _delegate->compressionCodec();
+}
+
 bool
 Ice::SSL::EndpointI::datagram() const
 {
@@ -30,6 +30,7 @@ namespace Ice::SSL
         [[nodiscard]] IceInternal::EndpointIPtr connectionId(const std::string&) const final;
         [[nodiscard]] bool compress() const final;
         [[nodiscard]] IceInternal::EndpointIPtr compress(bool) const final;
+        [[nodiscard]] std::uint8_t compressionCodec() const final;
         [[nodiscard]] bool datagram() const final;
         [[nodiscard]] bool secure() const final;
 
@@ -22,6 +22,31 @@ namespace
 {
     struct timespec zeroTimeout = {0, 0};
 }
+#elif defined(ICE_USE_IO_URING)
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+
+namespace
+{
+    // Reserved io_uring user data values, the user data of poll requests for event handlers start at
+    // firstRingPollId.
+    const std::uint64_t ringInterruptId = 0;
+    const std::uint64_t ringRemoveId = 1;
+    const std::uint64_t firstRingPollId = 2;
+
+    const unsigned ringSubmissionEntries = 256;
+    const unsigned ringCompletionEntries = 4096;
+
+    int ioUringSetup(unsigned entries, struct io_uring_params* params)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+    }
+
+    int ioUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags, void* arg, size_t argSize)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize));
+    }
+}
 #endif
 
 #if defined(ICE_USE_IOCP)
@@ -172,7 +197,11 @@ Selector::completed(EventHandler* handler, SocketOperation op)
 
 #elif defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL) || defined(ICE_USE_POLL)
 
+#    if defined(ICE_USE_IO_URING)
+Selector::Selector(InstancePtr instance, bool ioUring) : _instance(std::move(instance))
+#    else
 Selector::Selector(InstancePtr instance) : _instance(std::move(instance))
+#    endif
 {
     SOCKET fds[2];
     createPipe(fds);
@@ -181,6 +210,12 @@ Selector::Selector(InstancePtr instance) : _instance(std::move(instance))
     _selecting = false;
 
 #    if defined(ICE_USE_EPOLL)
+#        if defined(ICE_USE_IO_URING)
+    if (ioUring && setupRing())
+    {
+        return;
+    }
+#        endif
     _events.resize(256);
     _queueFd = epoll_create(1);
     if (_queueFd < 0)
@@ -224,6 +259,9 @@ Selector::Selector(InstancePtr instance) : _instance(std::move(instance))
 void
 Selector::destroy()
 {
+#    if defined(ICE_USE_IO_URING)
+    destroyRing();
+#    endif
 #    if defined(ICE_USE_KQUEUE) || defined(ICE_USE_EPOLL)
     try
     {
@@ -294,6 +332,13 @@ Selector::enable(EventHandler* handler, SocketOperation status)
 
     if (handler->_registered & status)
     {
+#    if defined(ICE_USE_IO_URING)
+        if (_ring)
+        {
+            updateRing(handler);
+            return;
+        }
+#    endif
 #    if defined(ICE_USE_EPOLL)
         SOCKET fd = nativeInfo->fd();
         auto previous = static_cast<SocketOperation>(handler->_registered & ~(handler->_disabled | status));
@@ -349,6 +394,13 @@ Selector::disable(EventHandler* handler, SocketOperation status)
 
     if (handler->_registered & status)
     {
+#    if defined(ICE_USE_IO_URING)
+        if (_ring)
+        {
+            updateRing(handler);
+            return;
+        }
+#    endif
 #    if defined(ICE_USE_EPOLL)
         SOCKET fd = nativeInfo->fd();
         auto newStatus = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
@@ -406,6 +458,14 @@ Selector::finish(EventHandler* handler, bool closeNow)
         //
         updateSelector();
     }
+#    elif defined(ICE_USE_IO_URING)
+    if (closeNow && _ring)
+    {
+        //
+        // Submit the removal of the poll request now since the FD is about to be closed.
+        //
+        submitRing();
+    }
 #    elif !defined(ICE_USE_EPOLL)
     if (!_changes.empty())
     {
@@ -490,6 +550,34 @@ Selector::startSelect()
         _interrupted = false;
     }
 
+#    if defined(ICE_USE_IO_URING)
+    if (_ring)
+    {
+        //
+        // Poll requests are one-shot: re-arm the interrupt pipe and the event handlers for which a completion was
+        // returned by the last select. Re-arming checks the current readiness of the FD so this provides the same
+        // level-triggered semantics as epoll. The queued requests are submitted by the io_uring_enter call of the
+        // next select, which also waits for the completions.
+        //
+        if (!_ringInterruptArmed)
+        {
+            armRing(ringInterruptId, _fdIntrRead, POLLIN);
+            _ringInterruptArmed = true;
+        }
+        for (EventHandler* handler : _ringRearm)
+        {
+            auto p = _ringHandlers.find(handler);
+            if (p != _ringHandlers.end() && !p->second.armed)
+            {
+                p->second.id = _nextRingId++;
+                _ringPolls.insert(make_pair(p->second.id, handler));
+                armRing(p->second.id, p->second.fd, p->second.events);
+                p->second.armed = true;
+            }
+        }
+        _ringRearm.clear();
+    }
+#    endif
 #    if !defined(ICE_USE_EPOLL)
     if (!_changes.empty())
     {
@@ -528,11 +616,20 @@ Selector::finishSelect(vector<pair<EventHandler*, SocketOperation>>& handlers)
         pair<EventHandler*, SocketOperation> p;
 
 #    if defined(ICE_USE_EPOLL)
-        struct epoll_event& ev = _events[i];
-        p.first = reinterpret_cast<EventHandler*>(ev.data.ptr);
-        p.second = static_cast<SocketOperation>(
-            ((ev.events & (EPOLLIN | EPOLLERR)) ? SocketOperationRead : SocketOperationNone) |
-            ((ev.events & (EPOLLOUT | EPOLLERR)) ? SocketOperationWrite : SocketOperationNone));
+#        if defined(ICE_USE_IO_URING)
+        if (_ring)
+        {
+            p = completeRing(i);
+        }
+        else
+#        endif
+        {
+            struct epoll_event& ev = _events[i];
+            p.first = reinterpret_cast<EventHandler*>(ev.data.ptr);
+            p.second = static_cast<SocketOperation>(
+                ((ev.events & (EPOLLIN | EPOLLERR)) ? SocketOperationRead : SocketOperationNone) |
+                ((ev.events & (EPOLLOUT | EPOLLERR)) ? SocketOperationWrite : SocketOperationNone));
+        }
 #    elif defined(ICE_USE_KQUEUE)
         struct kevent& ev = _events[static_cast<size_t>(i)];
         if (ev.flags & EV_ERROR)
@@ -580,6 +677,13 @@ Selector::finishSelect(vector<pair<EventHandler*, SocketOperation>>& handlers)
         }
     }
 
+#    if defined(ICE_USE_IO_URING)
+    if (_ring && _count > 0)
+    {
+        __atomic_store_n(_cqHead, *_cqHead + static_cast<unsigned>(_count), __ATOMIC_RELEASE);
+    }
+#    endif
+
     for (auto& readyHandler : _readyHandlers)
     {
         pair<EventHandler*, SocketOperation> p;
@@ -622,7 +726,16 @@ Selector::select(int timeout)
     while (true)
     {
 #    if defined(ICE_USE_EPOLL)
-        _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+#        if defined(ICE_USE_IO_URING)
+        if (_ring)
+        {
+            _count = waitRing(timeout);
+        }
+        else
+#        endif
+        {
+            _count = epoll_wait(_queueFd, &_events[0], _events.size(), timeout);
+        }
 #    elif defined(ICE_USE_KQUEUE)
         assert(!_events.empty());
         if (timeout >= 0)
@@ -786,6 +899,14 @@ Selector::updateSelectorForEventHandler(
     [[maybe_unused]] SocketOperation remove,
     [[maybe_unused]] SocketOperation add)
 {
+#    if defined(ICE_USE_IO_URING)
+    if (_ring)
+    {
+        updateRing(handler);
+        checkReady(handler);
+        return;
+    }
+#    endif
 #    if defined(ICE_USE_EPOLL)
     SocketOperation previous = handler->_registered;
     previous = static_cast<SocketOperation>(previous & ~add);
@@ -883,6 +1004,296 @@ Selector::updateSelectorForEventHandler(
     checkReady(handler);
 }
 
+#    if defined(ICE_USE_IO_URING)
+bool
+Selector::setupRing()
+{
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = ringCompletionEntries;
+    int fd = ioUringSetup(ringSubmissionEntries, &params);
+    if (fd < 0)
+    {
+        return false; // Not supported by the kernel or not permitted, fallback to epoll.
+    }
+
+    //
+    // We rely on the single mmap ring layout (Linux 5.4), on the kernel never dropping completions (Linux 5.5) and
+    // on the extended io_uring_enter arguments to wait with a timeout (Linux 5.11).
+    //
+    const unsigned required = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+    if ((params.features & required) != required)
+    {
+        ::close(fd);
+        return false;
+    }
+
+    _ringMemSize = max(
+        params.sq_off.array + params.sq_entries * sizeof(unsigned),
+        params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe));
+    _ringMem = mmap(nullptr, _ringMemSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (_ringMem == MAP_FAILED)
+    {
+        _ringMem = nullptr;
+        ::close(fd);
+        return false;
+    }
+
+    _sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    void* sqes = mmap(nullptr, _sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (sqes == MAP_FAILED)
+    {
+        munmap(_ringMem, _ringMemSize);
+        _ringMem = nullptr;
+        ::close(fd);
+        return false;
+    }
+
+    auto* mem = static_cast<char*>(_ringMem);
+    _sqes = static_cast<struct io_uring_sqe*>(sqes);
+    _sqHead = reinterpret_cast<unsigned*>(mem + params.sq_off.head);
+    _sqTail = reinterpret_cast<unsigned*>(mem + params.sq_off.tail);
+    _sqArray = reinterpret_cast<unsigned*>(mem + params.sq_off.array);
+    _sqMask = *reinterpret_cast<unsigned*>(mem + params.sq_off.ring_mask);
+    _sqEntries = params.sq_entries;
+    _cqHead = reinterpret_cast<unsigned*>(mem + params.cq_off.head);
+    _cqTail = reinterpret_cast<unsigned*>(mem + params.cq_off.tail);
+    _cqMask = *reinterpret_cast<unsigned*>(mem + params.cq_off.ring_mask);
+    _cqes = reinterpret_cast<struct io_uring_cqe*>(mem + params.cq_off.cqes);
+
+    _queueFd = fd;
+    _ring = true;
+    _nextRingId = firstRingPollId;
+
+    // The interrupt pipe request is submitted with the first select.
+    armRing(ringInterruptId, _fdIntrRead, POLLIN);
+    _ringInterruptArmed = true;
+    return true;
+}
+
+void
+Selector::destroyRing()
+{
+    if (_sqes)
+    {
+        munmap(_sqes, _sqesSize);
+        _sqes = nullptr;
+    }
+    if (_ringMem)
+    {
+        munmap(_ringMem, _ringMemSize);
+        _ringMem = nullptr;
+    }
+}
+
+void
+Selector::updateRing(EventHandler* handler)
+{
+    auto status = static_cast<SocketOperation>(handler->_registered & ~handler->_disabled);
+    std::uint32_t events = 0;
+    if (status & SocketOperationRead)
+    {
+        events |= POLLIN;
+    }
+    if (status & SocketOperationWrite)
+    {
+        events |= POLLOUT;
+    }
+
+    NativeInfoPtr nativeInfo = handler->getNativeInfo();
+    SOCKET fd = nativeInfo ? nativeInfo->fd() : INVALID_SOCKET;
+    if (fd == INVALID_SOCKET)
+    {
+        events = 0;
+    }
+
+    auto p = _ringHandlers.find(handler);
+    if (p != _ringHandlers.end())
+    {
+        if (p->second.events == events && p->second.fd == fd)
+        {
+            return;
+        }
+
+        //
+        // Cancel the pending poll request, its completion (if any) is ignored since its identifier is no longer
+        // associated with the event handler.
+        //
+        if (p->second.armed)
+        {
+            struct io_uring_sqe sqe;
+            memset(&sqe, 0, sizeof(sqe));
+            sqe.opcode = IORING_OP_POLL_REMOVE;
+            sqe.fd = -1;
+            sqe.addr = p->second.id;
+            sqe.user_data = ringRemoveId;
+            pushRing(sqe);
+            _ringPolls.erase(p->second.id);
+        }
+
+        if (!events)
+        {
+            _ringHandlers.erase(p);
+        }
+        else
+        {
+            p->second.id = _nextRingId++;
+            p->second.fd = fd;
+            p->second.events = events;
+            p->second.armed = true;
+            _ringPolls.insert(make_pair(p->second.id, handler));
+            armRing(p->second.id, fd, events);
+        }
+    }
+    else if (events)
+    {
+        RingPoll poll{_nextRingId++, fd, events, true};
+        _ringHandlers.insert(make_pair(handler, poll));
+        _ringPolls.insert(make_pair(poll.id, handler));
+        armRing(poll.id, fd, events);
+    }
+
+    //
+    // Submit the requests now if another thread is waiting for completions, otherwise they are submitted with the
+    // next select.
+    //
+    if (_selecting)
+    {
+        submitRing();
+    }
+}
+
+void
+Selector::pushRing(const struct io_uring_sqe& sqe)
+{
+    unsigned tail = *_sqTail;
+    if (tail - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE) == _sqEntries)
+    {
+        submitRing(); // The submission queue is full, submit the pending requests to make room.
+    }
+    unsigned index = tail & _sqMask;
+    _sqes[index] = sqe;
+    _sqArray[index] = index;
+    __atomic_store_n(_sqTail, tail + 1, __ATOMIC_RELEASE);
+}
+
+void
+Selector::armRing(std::uint64_t id, SOCKET fd, std::uint32_t events)
+{
+    struct io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_POLL_ADD;
+    sqe.fd = fd;
+    sqe.poll32_events = events;
+    sqe.user_data = id;
+    pushRing(sqe);
+}
+
+unsigned
+Selector::pendingRing() const
+{
+    //
+    // The kernel consumes the submitted requests from the head of the submission queue. The select thread and the
+    // threads updating event handlers might both submit requests, so the pending requests are computed from the
+    // queue rather than counted.
+    //
+    return __atomic_load_n(_sqTail, __ATOMIC_ACQUIRE) - __atomic_load_n(_sqHead, __ATOMIC_ACQUIRE);
+}
+
+void
+Selector::submitRing()
+{
+    unsigned pending;
+    while ((pending = pendingRing()) > 0)
+    {
+        int rs = ioUringEnter(_queueFd, pending, 0, 0, nullptr, 0);
+        if (rs <= 0)
+        {
+            if (rs < 0 && interrupted())
+            {
+                continue;
+            }
+            Ice::Error out(_instance->initializationData().logger);
+            out << "error while updating selector:\n" << IceInternal::errorToString(IceInternal::getSocketErrno());
+            break;
+        }
+    }
+}
+
+int
+Selector::waitRing(int timeout)
+{
+    struct __kernel_timespec ts;
+    struct io_uring_getevents_arg arg;
+    memset(&arg, 0, sizeof(arg));
+    if (timeout > 0)
+    {
+        ts.tv_sec = timeout / 1000;
+        ts.tv_nsec = static_cast<long long>(timeout % 1000) * 1000000;
+        arg.ts = reinterpret_cast<std::uint64_t>(&ts);
+    }
+
+    //
+    // Submit the requests queued since the last select and wait for completions with the same io_uring_enter call.
+    // There's no need to wait if completions are already available or for a non-blocking select.
+    //
+    unsigned toSubmit = pendingRing();
+    unsigned head = *_cqHead;
+    unsigned minComplete = timeout != 0 && __atomic_load_n(_cqTail, __ATOMIC_ACQUIRE) == head ? 1 : 0;
+    if (toSubmit > 0 || minComplete > 0)
+    {
+        int rs = ioUringEnter(
+            _queueFd,
+            toSubmit,
+            minComplete,
+            IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+            &arg,
+            sizeof(arg));
+        if (rs < 0 && IceInternal::getSocketErrno() != ETIME)
+        {
+            return SOCKET_ERROR;
+        }
+    }
+    return static_cast<int>(__atomic_load_n(_cqTail, __ATOMIC_ACQUIRE) - head);
+}
+
+pair<EventHandler*, SocketOperation>
+Selector::completeRing(int i)
+{
+    const struct io_uring_cqe& cqe = _cqes[(*_cqHead + static_cast<unsigned>(i)) & _cqMask];
+    if (cqe.user_data == ringInterruptId)
+    {
+        _ringInterruptArmed = false;
+        return make_pair(nullptr, SocketOperationNone); // Interrupted
+    }
+
+    auto q = _ringPolls.find(cqe.user_data);
+    if (q == _ringPolls.end())
+    {
+        return make_pair(nullptr, SocketOperationNone); // Completion of a removed or canceled poll request.
+    }
+    EventHandler* handler = q->second;
+    _ringPolls.erase(q);
+
+    auto p = _ringHandlers.find(handler);
+    assert(p != _ringHandlers.end());
+    p->second.armed = false;
+    _ringRearm.push_back(handler);
+
+    SocketOperation status = SocketOperationNone;
+    if (cqe.res < 0 || (cqe.res & (POLLIN | POLLERR | POLLHUP)))
+    {
+        status = static_cast<SocketOperation>(status | SocketOperationRead);
+    }
+    if (cqe.res < 0 || (cqe.res & (POLLOUT | POLLERR | POLLHUP)))
+    {
+        status = static_cast<SocketOperation>(status | SocketOperationWrite);
+    }
+    return make_pair(handler, status);
+}
+#    endif
+
 #elif defined(ICE_USE_CFSTREAM)
 
 namespace
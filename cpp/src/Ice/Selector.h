@@ -13,6 +13,12 @@
 
 #if defined(ICE_USE_EPOLL)
 #    include <sys/epoll.h>
+#    if defined(ICE_USE_IO_URING)
+#        include <cstdint>
+#        include <linux/io_uring.h>
+#        include <unordered_map>
+#        include <vector>
+#    endif
 #elif defined(ICE_USE_KQUEUE)
 #    include <sys/event.h>
 #elif defined(ICE_USE_IOCP)
@@ -81,7 +87,16 @@ namespace IceInternal
     class Selector final
     {
     public:
+#    if defined(ICE_USE_IO_URING)
+        // With ioUring, the selector waits for the readiness of the file descriptors with io_uring poll requests
+        // instead of epoll when the kernel supports it.
+        Selector(InstancePtr, bool ioUring);
+
+        // Returns true if the selector uses io_uring, false if it uses epoll.
+        [[nodiscard]] bool ioUring() const { return _ring; }
+#    else
         Selector(InstancePtr);
+#    endif
 
         void destroy();
 
@@ -106,6 +121,26 @@ namespace IceInternal
         void updateSelector();
         void updateSelectorForEventHandler(EventHandler*, SocketOperation, SocketOperation);
 
+#    if defined(ICE_USE_IO_URING)
+        struct RingPoll
+        {
+            std::uint64_t id;
+            SOCKET fd;
+            std::uint32_t events;
+            bool armed;
+        };
+
+        bool setupRing();
+        void destroyRing();
+        void updateRing(EventHandler*);
+        void pushRing(const struct io_uring_sqe&);
+        void armRing(std::uint64_t, SOCKET, std::uint32_t);
+        [[nodiscard]] unsigned pendingRing() const;
+        void submitRing();
+        int waitRing(int);
+        std::pair<EventHandler*, SocketOperation> completeRing(int);
+#    endif
+
         const InstancePtr _instance;
 
         SOCKET _fdIntrRead;
@@ -119,6 +154,28 @@ namespace IceInternal
 #    if defined(ICE_USE_EPOLL)
         std::vector<struct epoll_event> _events;
         int _queueFd;
+#        if defined(ICE_USE_IO_URING)
+        // When _ring is true, _queueFd is the io_uring file descriptor instead of the epoll file descriptor.
+        bool _ring{false};
+        void* _ringMem{nullptr};
+        size_t _ringMemSize{0};
+        struct io_uring_sqe* _sqes{nullptr};
+        size_t _sqesSize{0};
+        unsigned* _sqHead{nullptr};
+        unsigned* _sqTail{nullptr};
+        unsigned* _sqArray{nullptr};
+        unsigned _sqMask{0};
+        unsigned _sqEntries{0};
+        unsigned* _cqHead{nullptr};
+        unsigned* _cqTail{nullptr};
+        unsigned _cqMask{0};
+        struct io_uring_cqe* _cqes{nullptr};
+        std::uint64_t _nextRingId{0};
+        bool _ringInterruptArmed{false};
+        std::unordered_map<EventHandler*, RingPoll> _ringHandlers;
+        std::unordered_map<std::uint64_t, EventHandler*> _ringPolls;
+        std::vector<EventHandler*> _ringRearm;
+#        endif
 #    elif defined(ICE_USE_KQUEUE)
         std::vector<struct kevent> _events;
         std::vector<struct kevent> _changes;
@@ -6,6 +6,7 @@
 #include "Ice/LoggerUtil.h"
 #include "Ice/ServantLocator.h"
 #include "Ice/StringUtil.h"
+#include "HashUtil.h"
 #include "Instance.h"
 
 using namespace std;
@@ -14,23 +15,37 @@ using namespace IceInternal;
 
 Ice::ServantLocator::~ServantLocator() = default; // avoid weak vtable
 
+size_t
+IceInternal::ServantManager::IdentityHash::operator()(const Identity& ident) const noexcept
+{
+    size_t h = 5381;
+    hashAdd(h, ident.name);
+    hashAdd(h, ident.category);
+    return h;
+}
+
+IceInternal::ServantManager::ServantMapShard&
+IceInternal::ServantManager::shard(const Identity& ident) const
+{
+    // Use the high bits of the hash, the low bits select the bucket in the shard.
+    size_t h = IdentityHash{}(ident);
+    return _servantMapShards[(h >> (sizeof(size_t) * 8 - 6)) % servantMapShardCount];
+}
+
 void
 IceInternal::ServantManager::addServant(ObjectPtr object, Identity ident, string facet)
 {
-    lock_guard lock(_mutex);
+    shared_lock lock(_mutex);
 
     assert(_instance); // Must not be called after destruction.
 
-    auto p = _servantMapMapHint;
-
-    if (p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    ServantMapShard& s = shard(ident);
+    lock_guard shardLock(s.mutex);
 
-    if (p == _servantMapMap.end())
+    auto p = s.servantMapMap.find(ident);
+    if (p == s.servantMapMap.end())
     {
-        p = _servantMapMap.insert(_servantMapMapHint, pair<const Identity, FacetMap>(std::move(ident), FacetMap()));
+        p = s.servantMapMap.emplace(std::move(ident), FacetMap()).first;
     }
     else
     {
@@ -47,8 +62,6 @@ IceInternal::ServantManager::addServant(ObjectPtr object, Identity ident, string
         }
     }
 
-    _servantMapMapHint = p;
-
     p->second.insert(pair<const string, ObjectPtr>(std::move(facet), std::move(object)));
 }
 
@@ -75,19 +88,17 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string_v
     // with *this locked. We don't want to run user code, such as the servant
     // destructor, with an internal Ice mutex locked.
 
-    lock_guard lock(_mutex);
+    shared_lock lock(_mutex);
 
     assert(_instance); // Must not be called after destruction.
 
-    auto p = _servantMapMapHint;
-    FacetMap::iterator q;
+    ServantMapShard& s = shard(ident);
+    lock_guard shardLock(s.mutex);
 
-    if (p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
+    auto p = s.servantMapMap.find(ident);
+    FacetMap::iterator q;
 
-    if (p == _servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    if (p == s.servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
     {
         ToStringMode toStringMode = _instance->toStringMode();
         ostringstream os;
@@ -104,15 +115,7 @@ IceInternal::ServantManager::removeServant(const Identity& ident, const string_v
 
     if (p->second.empty())
     {
-        if (p == _servantMapMapHint)
-        {
-            _servantMapMap.erase(p++);
-            _servantMapMapHint = p;
-        }
-        else
-        {
-            _servantMapMap.erase(p);
-        }
+        s.servantMapMap.erase(p);
     }
     return servant;
 }
@@ -143,18 +146,15 @@ IceInternal::ServantManager::removeDefaultServant(const string_view category)
 FacetMap
 IceInternal::ServantManager::removeAllFacets(const Identity& ident)
 {
-    lock_guard lock(_mutex);
+    shared_lock lock(_mutex);
 
     assert(_instance); // Must not be called after destruction.
 
-    auto p = _servantMapMapHint;
+    ServantMapShard& s = shard(ident);
+    lock_guard shardLock(s.mutex);
 
-    if (p == _servantMapMap.end() || p->first != ident)
-    {
-        p = _servantMapMap.find(ident);
-    }
-
-    if (p == _servantMapMap.end())
+    auto p = s.servantMapMap.find(ident);
+    if (p == s.servantMapMap.end())
     {
         throw NotRegisteredException(
             __FILE__,
@@ -163,58 +163,44 @@ IceInternal::ServantManager::removeAllFacets(const Identity& ident)
             Ice::identityToString(ident, _instance->toStringMode()));
     }
 
-    FacetMap result = p->second;
-
-    if (p == _servantMapMapHint)
-    {
-        _servantMapMap.erase(p++);
-        _servantMapMapHint = p;
-    }
-    else
-    {
-        _servantMapMap.erase(p);
-    }
-
+    FacetMap result = std::move(p->second);
+    s.servantMapMap.erase(p);
     return result;
 }
 
 ObjectPtr
 IceInternal::ServantManager::findServant(const Identity& ident, const string_view facet) const
 {
-    lock_guard lock(_mutex);
-
     //
-    // This assert is not valid if the adapter dispatch incoming
-    // requests from bidir connections. This method might be called if
-    // requests are received over the bidir connection after the
+    // This method doesn't check _instance: the check is not valid if the adapter
+    // dispatch incoming requests from bidir connections. This method might be
+    // called if requests are received over the bidir connection after the
     // adapter was deactivated.
     //
-    // assert(_instance); // Must not be called after destruction.
-
-    auto p = _servantMapMapHint;
-    FacetMap::iterator q;
-
-    auto& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if (p == servantMapMap.end() || p->first != ident)
     {
-        p = servantMapMap.find(ident);
+        ServantMapShard& s = shard(ident);
+        shared_lock shardLock(s.mutex);
+
+        auto p = s.servantMapMap.find(ident);
+        if (p != s.servantMapMap.end())
+        {
+            auto q = p->second.find(facet);
+            if (q != p->second.end())
+            {
+                return q->second;
+            }
+        }
     }
 
-    if (p == servantMapMap.end() || (q = p->second.find(facet)) == p->second.end())
+    shared_lock lock(_mutex);
+
+    auto d = _defaultServantMap.find(ident.category);
+    if (d == _defaultServantMap.end())
     {
-        auto d = _defaultServantMap.find(ident.category);
+        d = _defaultServantMap.find("");
         if (d == _defaultServantMap.end())
         {
-            d = _defaultServantMap.find("");
-            if (d == _defaultServantMap.end())
-            {
-                return nullptr;
-            }
-            else
-            {
-                return d->second;
-            }
+            return nullptr;
         }
         else
         {
@@ -223,15 +209,14 @@ IceInternal::ServantManager::findServant(const Identity& ident, const string_vie
     }
     else
     {
-        _servantMapMapHint = p;
-        return q->second;
+        return d->second;
     }
 }
 
 ObjectPtr
 IceInternal::ServantManager::findDefaultServant(const string_view category) const
 {
-    lock_guard lock(_mutex);
+    shared_lock lock(_mutex);
 
     auto p = _defaultServantMap.find(category);
     if (p == _defaultServantMap.end())
@@ -247,26 +232,20 @@ IceInternal::ServantManager::findDefaultServant(const string_view category) cons
 FacetMap
 IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 {
-    lock_guard lock(_mutex);
+    shared_lock lock(_mutex);
 
     assert(_instance); // Must not be called after destruction.
 
-    auto p = _servantMapMapHint;
-
-    auto& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if (p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
+    ServantMapShard& s = shard(ident);
+    shared_lock shardLock(s.mutex);
 
-    if (p == servantMapMap.end())
+    auto p = s.servantMapMap.find(ident);
+    if (p == s.servantMapMap.end())
     {
         return {};
     }
     else
     {
-        _servantMapMapHint = p;
         return p->second;
     }
 }
@@ -274,31 +253,18 @@ IceInternal::ServantManager::findAllFacets(const Identity& ident) const
 bool
 IceInternal::ServantManager::hasServant(const Identity& ident) const
 {
-    lock_guard lock(_mutex);
+    // Like findServant, this method doesn't check _instance.
 
-    //
-    // This assert is not valid if the adapter dispatch incoming
-    // requests from bidir connections. This method might be called if
-    // requests are received over the bidir connection after the
-    // adapter was deactivated.
-    //
-    // assert(_instance); // Must not be called after destruction.
-
-    auto p = _servantMapMapHint;
-    auto& servantMapMap = const_cast<ServantMapMap&>(_servantMapMap);
-
-    if (p == servantMapMap.end() || p->first != ident)
-    {
-        p = servantMapMap.find(ident);
-    }
+    ServantMapShard& s = shard(ident);
+    shared_lock shardLock(s.mutex);
 
-    if (p == servantMapMap.end())
+    auto p = s.servantMapMap.find(ident);
+    if (p == s.servantMapMap.end())
     {
         return false;
     }
     else
     {
-        _servantMapMapHint = p;
         assert(!p->second.empty());
         return true;
     }
@@ -311,15 +277,12 @@ IceInternal::ServantManager::addServantLocator(ServantLocatorPtr locator, string
 
     assert(_instance); // Must not be called after destruction.
 
-    if ((_locatorMapHint != _locatorMap.end() && _locatorMapHint->first == category) ||
-        _locatorMap.find(category) != _locatorMap.end())
+    if (_locatorMap.find(category) != _locatorMap.end())
     {
         throw AlreadyRegisteredException(__FILE__, __LINE__, "servant locator", category);
     }
 
-    _locatorMapHint = _locatorMap.insert(
-        _locatorMapHint,
-        pair<const string, ServantLocatorPtr>(std::move(category), std::move(locator)));
+    _locatorMap.insert(pair<const string, ServantLocatorPtr>(std::move(category), std::move(locator)));
 }
 
 ServantLocatorPtr
@@ -329,20 +292,7 @@ IceInternal::ServantManager::removeServantLocator(const string_view category)
 
     assert(_instance); // Must not be called after destruction.
 
-    auto p = _locatorMap.end();
-    if (_locatorMapHint != p)
-    {
-        if (_locatorMapHint->first == category)
-        {
-            p = _locatorMapHint;
-        }
-    }
-
-    if (p == _locatorMap.end())
-    {
-        p = _locatorMap.find(category);
-    }
-
+    auto p = _locatorMap.find(category);
     if (p == _locatorMap.end())
     {
         throw NotRegisteredException(__FILE__, __LINE__, "servant locator", string{category});
@@ -350,14 +300,13 @@ IceInternal::ServantManager::removeServantLocator(const string_view category)
 
     ServantLocatorPtr locator = p->second;
     _locatorMap.erase(p);
-    _locatorMapHint = _locatorMap.begin();
     return locator;
 }
 
 ServantLocatorPtr
 IceInternal::ServantManager::findServantLocator(const string_view category) const
 {
-    lock_guard lock(_mutex);
+    shared_lock lock(_mutex);
 
     //
     // This assert is not valid if the adapter dispatch incoming
@@ -367,25 +316,9 @@ IceInternal::ServantManager::findServantLocator(const string_view category) cons
     //
     // assert(_instance); // Must not be called after destruction.
 
-    auto& locatorMap = const_cast<map<string, ServantLocatorPtr, std::less<>>&>(_locatorMap);
-
-    auto p = locatorMap.end();
-    if (_locatorMapHint != locatorMap.end())
+    auto p = _locatorMap.find(category);
+    if (p != _locatorMap.end())
     {
-        if (_locatorMapHint->first == category)
-        {
-            p = _locatorMapHint;
-        }
-    }
-
-    if (p == locatorMap.end())
-    {
-        p = locatorMap.find(category);
-    }
-
-    if (p != locatorMap.end())
-    {
-        _locatorMapHint = p;
         return p->second;
     }
     else
@@ -396,9 +329,7 @@ IceInternal::ServantManager::findServantLocator(const string_view category) cons
 
 IceInternal::ServantManager::ServantManager(InstancePtr instance, string adapterName)
     : _instance(std::move(instance)),
-      _adapterName(std::move(adapterName)),
-      _servantMapMapHint(_servantMapMap.end()),
-      _locatorMapHint(_locatorMap.end())
+      _adapterName(std::move(adapterName))
 {
 }
 
@@ -407,7 +338,7 @@ IceInternal::ServantManager::~ServantManager() = default;
 void
 IceInternal::ServantManager::destroy()
 {
-    ServantMapMap servantMapMap;
+    array<ServantMapMap, servantMapShardCount> servantMapMaps;
     DefaultServantMap defaultServantMap;
     map<string, ServantLocatorPtr, std::less<>> locatorMap;
     Ice::LoggerPtr logger;
@@ -424,13 +355,15 @@ IceInternal::ServantManager::destroy()
 
         logger = _instance->initializationData().logger;
 
-        servantMapMap.swap(_servantMapMap);
-        _servantMapMapHint = _servantMapMap.end();
+        for (size_t i = 0; i < servantMapShardCount; ++i)
+        {
+            lock_guard shardLock(_servantMapShards[i].mutex);
+            servantMapMaps[i].swap(_servantMapShards[i].servantMapMap);
+        }
 
         defaultServantMap.swap(_defaultServantMap);
 
         locatorMap.swap(_locatorMap);
-        _locatorMapHint = _locatorMap.end();
 
         _instance = nullptr;
     }
@@ -463,7 +396,10 @@ IceInternal::ServantManager::destroy()
     // hold any internal Ice mutex while running user code (such as servant
     // or servant locator destructors).
     //
-    servantMapMap.clear();
+    for (auto& servantMapMap : servantMapMaps)
+    {
+        servantMapMap.clear();
+    }
     locatorMap.clear();
     defaultServantMap.clear();
 }
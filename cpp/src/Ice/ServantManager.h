@@ -10,7 +10,9 @@
 #include "Ice/ServantLocator.h"
 #include "ServantManagerF.h"
 
-#include <mutex>
+#include <array>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace Ice
 {
@@ -49,17 +51,36 @@ namespace IceInternal
 
         const std::string _adapterName;
 
-        using ServantMapMap = std::map<Ice::Identity, Ice::FacetMap>;
+        struct IdentityHash
+        {
+            std::size_t operator()(const Ice::Identity&) const noexcept;
+        };
+
+        using ServantMapMap = std::unordered_map<Ice::Identity, Ice::FacetMap, IdentityHash>;
         using DefaultServantMap = std::map<std::string, Ice::ObjectPtr, std::less<>>;
 
-        ServantMapMap _servantMapMap;
-        mutable ServantMapMap::iterator _servantMapMapHint;
+        // The servants are spread over shards selected by the identity hash, each shard with its own mutex: finding
+        // a servant only takes a shared lock on the shard of its identity, so it doesn't wait for other lookups, and
+        // only waits for the addition or removal of a servant in the same shard.
+        struct alignas(64) ServantMapShard
+        {
+            mutable std::shared_mutex mutex;
+            ServantMapMap servantMapMap;
+        };
+
+        static constexpr std::size_t servantMapShardCount = 64;
+
+        ServantMapShard& shard(const Ice::Identity&) const;
+
+        mutable std::array<ServantMapShard, servantMapShardCount> _servantMapShards;
+
+        // Protects _instance, the default servants and the servant locators. A thread that locks both this mutex and
+        // the mutex of a shard locks this mutex first.
+        mutable std::shared_mutex _mutex;
 
         DefaultServantMap _defaultServantMap;
 
         std::map<std::string, Ice::ServantLocatorPtr, std::less<>> _locatorMap;
-        mutable std::map<std::string, Ice::ServantLocatorPtr, std::less<>>::iterator _locatorMapHint;
-        mutable std::mutex _mutex;
     };
 }
 
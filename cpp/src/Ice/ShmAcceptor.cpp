@@ -0,0 +1,73 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Config.h"
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#    include "ShmAcceptor.h"
+#    include "ShmEndpoint.h"
+#    include "ShmTransceiver.h"
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceInternal::NativeInfoPtr
+IceInternal::ShmAcceptor::getNativeInfo()
+{
+    return _delegate->getNativeInfo();
+}
+
+void
+IceInternal::ShmAcceptor::close()
+{
+    _delegate->close();
+}
+
+EndpointIPtr
+IceInternal::ShmAcceptor::listen()
+{
+    _endpoint = _endpoint->endpoint(_delegate->listen());
+    return _endpoint;
+}
+
+bool
+IceInternal::ShmAcceptor::setReusePort()
+{
+    return _delegate->setReusePort();
+}
+
+IceInternal::TransceiverPtr
+IceInternal::ShmAcceptor::accept()
+{
+    // The shared memory is received in ShmTransceiver::initialize, since accept must not block.
+    return make_shared<ShmTransceiver>(_instance, _delegate->accept(), true);
+}
+
+string
+IceInternal::ShmAcceptor::protocol() const
+{
+    return _delegate->protocol();
+}
+
+string
+IceInternal::ShmAcceptor::toString() const
+{
+    return _delegate->toString();
+}
+
+string
+IceInternal::ShmAcceptor::toDetailedString() const
+{
+    return _delegate->toDetailedString();
+}
+
+IceInternal::ShmAcceptor::ShmAcceptor(ShmEndpointPtr endpoint, ProtocolInstancePtr instance, AcceptorPtr del)
+    : _endpoint(std::move(endpoint)),
+      _instance(std::move(instance)),
+      _delegate(std::move(del))
+{
+}
+
+IceInternal::ShmAcceptor::~ShmAcceptor() = default;
+#endif
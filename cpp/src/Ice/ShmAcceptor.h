@@ -0,0 +1,36 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_SHM_ACCEPTOR_H
+#define ICE_SHM_ACCEPTOR_H
+
+#include "Acceptor.h"
+#include "EndpointIF.h"
+#include "Network.h"
+#include "ProtocolInstanceF.h"
+#include "TransceiverF.h"
+
+namespace IceInternal
+{
+    class ShmAcceptor final : public Acceptor
+    {
+    public:
+        ShmAcceptor(ShmEndpointPtr, ProtocolInstancePtr, AcceptorPtr);
+        ~ShmAcceptor() override;
+        NativeInfoPtr getNativeInfo() final;
+
+        void close() final;
+        EndpointIPtr listen() final;
+        bool setReusePort() final;
+        TransceiverPtr accept() final;
+        [[nodiscard]] std::string protocol() const final;
+        [[nodiscard]] std::string toString() const final;
+        [[nodiscard]] std::string toDetailedString() const final;
+
+    private:
+        ShmEndpointPtr _endpoint;
+        const ProtocolInstancePtr _instance;
+        const AcceptorPtr _delegate;
+    };
+}
+
+#endif
@@ -0,0 +1,83 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Config.h"
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#    include "ShmConnector.h"
+#    include "HashUtil.h"
+#    include "Ice/Comparable.h"
+#    include "ShmTransceiver.h"
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+TransceiverPtr
+IceInternal::ShmConnector::connect()
+{
+    return make_shared<ShmTransceiver>(_instance, _delegate->connect(), false);
+}
+
+int16_t
+IceInternal::ShmConnector::type() const
+{
+    return _delegate->type();
+}
+
+string
+IceInternal::ShmConnector::toString() const
+{
+    return _delegate->toString();
+}
+
+size_t
+IceInternal::ShmConnector::hash() const noexcept
+{
+    size_t h = _delegate->hash();
+    hashAdd(h, static_cast<int32_t>(type()));
+    return h;
+}
+
+bool
+IceInternal::ShmConnector::operator==(const Connector& r) const
+{
+    const auto* p = dynamic_cast<const ShmConnector*>(&r);
+    if (!p)
+    {
+        return false;
+    }
+
+    if (this == p)
+    {
+        return true;
+    }
+
+    return Ice::targetEqualTo(_delegate, p->_delegate);
+}
+
+bool
+IceInternal::ShmConnector::operator<(const Connector& r) const
+{
+    const auto* p = dynamic_cast<const ShmConnector*>(&r);
+    if (!p)
+    {
+        return type() < r.type();
+    }
+
+    if (this == p)
+    {
+        return false;
+    }
+
+    return Ice::targetLess(_delegate, p->_delegate);
+}
+
+IceInternal::ShmConnector::ShmConnector(ProtocolInstancePtr instance, ConnectorPtr del)
+    : _instance(std::move(instance)),
+      _delegate(std::move(del))
+{
+}
+
+IceInternal::ShmConnector::~ShmConnector() = default;
+#endif
@@ -0,0 +1,32 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_SHM_CONNECTOR_H
+#define ICE_SHM_CONNECTOR_H
+
+#include "Connector.h"
+#include "ProtocolInstanceF.h"
+#include "TransceiverF.h"
+
+namespace IceInternal
+{
+    class ShmConnector final : public Connector
+    {
+    public:
+        ShmConnector(ProtocolInstancePtr, ConnectorPtr);
+        ~ShmConnector() override;
+        TransceiverPtr connect() final;
+
+        [[nodiscard]] std::int16_t type() const final;
+        [[nodiscard]] std::string toString() const final;
+
+        bool operator==(const Connector&) const final;
+        bool operator<(const Connector&) const final;
+        [[nodiscard]] std::size_t hash() const noexcept final;
+
+    private:
+        const ProtocolInstancePtr _instance;
+        const ConnectorPtr _delegate;
+    };
+}
+
+#endif
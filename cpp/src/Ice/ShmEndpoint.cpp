@@ -0,0 +1,263 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Config.h"
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#    include "ShmEndpoint.h"
+#    include "Ice/Comparable.h"
+#    include "ProtocolInstance.h"
+#    include "ShmAcceptor.h"
+#    include "ShmConnector.h"
+
+#    include <algorithm>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceInternal::ShmEndpoint::ShmEndpoint(ProtocolInstancePtr instance, EndpointIPtr del)
+    : _instance(std::move(instance)),
+      _delegate(std::move(del))
+{
+}
+
+EndpointInfoPtr
+IceInternal::ShmEndpoint::getInfo() const noexcept
+{
+    // The delegate endpoint is created with the shm protocol instance, its info reports the shm endpoint type.
+    return _delegate->getInfo();
+}
+
+int16_t
+IceInternal::ShmEndpoint::type() const
+{
+    return _delegate->type();
+}
+
+const string&
+IceInternal::ShmEndpoint::protocol() const
+{
+    return _delegate->protocol();
+}
+
+void
+IceInternal::ShmEndpoint::streamWriteImpl(OutputStream* s) const
+{
+    _delegate->streamWriteImpl(s);
+}
+
+int32_t
+IceInternal::ShmEndpoint::timeout() const
+{
+    return _delegate->timeout();
+}
+
+EndpointIPtr
+IceInternal::ShmEndpoint::timeout(int32_t timeout) const
+{
+    return endpoint(_delegate->timeout(timeout));
+}
+
+const string&
+IceInternal::ShmEndpoint::connectionId() const
+{
+    return _delegate->connectionId();
+}
+
+EndpointIPtr
+IceInternal::ShmEndpoint::connectionId(const string& connectionId) const
+{
+    return endpoint(_delegate->connectionId(connectionId));
+}
+
+bool
+IceInternal::ShmEndpoint::compress() const
+{
+    return _delegate->compress();
+}
+
+EndpointIPtr
+IceInternal::ShmEndpoint::compress(bool compress) const
+{
+    return endpoint(_delegate->compress(compress));
+}
+
+uint8_t
+IceInternal::ShmEndpoint::compressionCodec() const
+{
+    return _delegate->compressionCodec();
+}
+
+bool
+IceInternal::ShmEndpoint::datagram() const
+{
+    return false;
+}
+
+bool
+IceInternal::ShmEndpoint::secure() const
+{
+    return false;
+}
+
+TransceiverPtr
+IceInternal::ShmEndpoint::transceiver() const
+{
+    return nullptr;
+}
+
+void
+IceInternal::ShmEndpoint::connectorsAsync(
+    EndpointSelectionType selType,
+    function<void(vector<IceInternal::ConnectorPtr>)> response,
+    function<void(exception_ptr)> exception) const
+{
+    auto self = const_cast<ShmEndpoint*>(this)->shared_from_this();
+    _delegate->connectorsAsync(
+        selType,
+        [response, self](vector<ConnectorPtr> connectors)
+        {
+            for (auto& connector : connectors)
+            {
+                connector = make_shared<ShmConnector>(self->_instance, connector);
+            }
+            response(std::move(connectors));
+        },
+        exception);
+}
+
+AcceptorPtr
+IceInternal::ShmEndpoint::acceptor(
+    const string& adapterName,
+    const optional<Ice::SSL::ServerAuthenticationOptions>& serverAuthenticationOptions) const
+{
+    AcceptorPtr acceptor = _delegate->acceptor(adapterName, serverAuthenticationOptions);
+    return make_shared<ShmAcceptor>(const_cast<ShmEndpoint*>(this)->shared_from_this(), _instance, acceptor);
+}
+
+ShmEndpointPtr
+IceInternal::ShmEndpoint::endpoint(const EndpointIPtr& delEndp) const
+{
+    if (delEndp.get() == _delegate.get())
+    {
+        return const_cast<ShmEndpoint*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<ShmEndpoint>(_instance, delEndp);
+    }
+}
+
+vector<EndpointIPtr>
+IceInternal::ShmEndpoint::expandHost() const
+{
+    vector<EndpointIPtr> endpoints = _delegate->expandHost();
+
+    transform(
+        endpoints.begin(),
+        endpoints.end(),
+        endpoints.begin(),
+        [this](const EndpointIPtr& p) { return endpoint(p); });
+
+    return endpoints;
+}
+
+bool
+IceInternal::ShmEndpoint::isLoopbackOrMulticast() const
+{
+    return _delegate->isLoopbackOrMulticast();
+}
+
+shared_ptr<EndpointI>
+IceInternal::ShmEndpoint::toPublishedEndpoint(string publishedHost) const
+{
+    return endpoint(_delegate->toPublishedEndpoint(std::move(publishedHost)));
+}
+
+bool
+IceInternal::ShmEndpoint::equivalent(const EndpointIPtr& endpoint) const
+{
+    auto shmEndpoint = dynamic_pointer_cast<ShmEndpoint>(endpoint);
+    if (!shmEndpoint)
+    {
+        return false;
+    }
+    return _delegate->equivalent(shmEndpoint->_delegate);
+}
+
+size_t
+IceInternal::ShmEndpoint::hash() const noexcept
+{
+    return _delegate->hash();
+}
+
+string
+IceInternal::ShmEndpoint::options() const
+{
+    return _delegate->options();
+}
+
+bool
+IceInternal::ShmEndpoint::operator==(const Endpoint& r) const
+{
+    const auto* p = dynamic_cast<const ShmEndpoint*>(&r);
+    if (!p)
+    {
+        return false;
+    }
+
+    if (this == p)
+    {
+        return true;
+    }
+
+    return targetEqualTo(_delegate, p->_delegate);
+}
+
+bool
+IceInternal::ShmEndpoint::operator<(const Endpoint& r) const
+{
+    const auto* p = dynamic_cast<const ShmEndpoint*>(&r);
+    if (!p)
+    {
+        const auto* e = dynamic_cast<const EndpointI*>(&r);
+        if (!e)
+        {
+            return false;
+        }
+        return type() < e->type();
+    }
+
+    if (this == p)
+    {
+        return false;
+    }
+
+    return targetLess(_delegate, p->_delegate);
+}
+
+IceInternal::ShmEndpointFactory::ShmEndpointFactory(const ProtocolInstancePtr& instance, int16_t type)
+    : EndpointFactoryWithUnderlying(instance, type)
+{
+}
+
+EndpointFactoryPtr
+IceInternal::ShmEndpointFactory::cloneWithUnderlying(const ProtocolInstancePtr& instance, int16_t underlying) const
+{
+    return make_shared<ShmEndpointFactory>(instance, underlying);
+}
+
+EndpointIPtr
+IceInternal::ShmEndpointFactory::createWithUnderlying(const EndpointIPtr& underlying, vector<string>&, bool) const
+{
+    // The shm endpoint has no options of its own, all the options are parsed by the Unix endpoint.
+    return make_shared<ShmEndpoint>(_instance, underlying);
+}
+
+EndpointIPtr
+IceInternal::ShmEndpointFactory::readWithUnderlying(const EndpointIPtr& underlying, InputStream*) const
+{
+    return make_shared<ShmEndpoint>(_instance, underlying);
+}
+#endif
@@ -0,0 +1,76 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_SHM_ENDPOINT_H
+#define ICE_SHM_ENDPOINT_H
+
+#include "EndpointFactory.h"
+#include "EndpointI.h"
+#include "ProtocolInstanceF.h"
+
+namespace IceInternal
+{
+    // A shared-memory endpoint, such as `shm -p /run/app.sock`. The connection is established over a Unix domain
+    // socket, the delegate endpoint, and the messages are then exchanged through rings in memory shared by the two
+    // processes: the socket is only used to notify the peer.
+    class ShmEndpoint final : public EndpointI, public std::enable_shared_from_this<ShmEndpoint>
+    {
+    public:
+        ShmEndpoint(ProtocolInstancePtr, EndpointIPtr);
+
+        void streamWriteImpl(Ice::OutputStream*) const final;
+
+        [[nodiscard]] Ice::EndpointInfoPtr getInfo() const noexcept final;
+        [[nodiscard]] std::int16_t type() const final;
+        [[nodiscard]] const std::string& protocol() const final;
+
+        [[nodiscard]] std::int32_t timeout() const final;
+        [[nodiscard]] EndpointIPtr timeout(std::int32_t) const final;
+        [[nodiscard]] const std::string& connectionId() const final;
+        [[nodiscard]] EndpointIPtr connectionId(const std::string&) const final;
+        [[nodiscard]] bool compress() const final;
+        [[nodiscard]] EndpointIPtr compress(bool) const final;
+        [[nodiscard]] std::uint8_t compressionCodec() const final;
+        [[nodiscard]] bool datagram() const final;
+        [[nodiscard]] bool secure() const final;
+
+        [[nodiscard]] TransceiverPtr transceiver() const final;
+        void connectorsAsync(
+            Ice::EndpointSelectionType,
+            std::function<void(std::vector<ConnectorPtr>)>,
+            std::function<void(std::exception_ptr)>) const final;
+        [[nodiscard]] AcceptorPtr
+        acceptor(const std::string&, const std::optional<Ice::SSL::ServerAuthenticationOptions>&) const final;
+        [[nodiscard]] std::vector<EndpointIPtr> expandHost() const final;
+        [[nodiscard]] bool isLoopbackOrMulticast() const final;
+        [[nodiscard]] std::shared_ptr<EndpointI> toPublishedEndpoint(std::string publishedHost) const final;
+        [[nodiscard]] bool equivalent(const EndpointIPtr&) const final;
+        [[nodiscard]] std::size_t hash() const noexcept final;
+        [[nodiscard]] std::string options() const final;
+
+        [[nodiscard]] ShmEndpointPtr endpoint(const EndpointIPtr&) const;
+
+        bool operator==(const Ice::Endpoint&) const final;
+        bool operator<(const Ice::Endpoint&) const final;
+
+    private:
+        //
+        // All members are const, because endpoints are immutable.
+        //
+        const ProtocolInstancePtr _instance;
+        const EndpointIPtr _delegate;
+    };
+
+    class ShmEndpointFactory final : public EndpointFactoryWithUnderlying
+    {
+    public:
+        ShmEndpointFactory(const ProtocolInstancePtr&, std::int16_t);
+
+        [[nodiscard]] EndpointFactoryPtr cloneWithUnderlying(const ProtocolInstancePtr&, std::int16_t) const final;
+
+    protected:
+        EndpointIPtr createWithUnderlying(const EndpointIPtr&, std::vector<std::string>&, bool) const final;
+        EndpointIPtr readWithUnderlying(const EndpointIPtr&, Ice::InputStream*) const final;
+    };
+}
+
+#endif
@@ -0,0 +1,123 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "ShmRing.h"
+#include "Ice/LocalExceptions.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+IceInternal::ShmRing::ShmRing(ShmRingControl* control, byte* data, size_t size)
+    : _control(control),
+      _data(data),
+      _size(size)
+{
+    assert(_size > 0 && (_size & (_size - 1)) == 0); // The size must be a power of two.
+}
+
+size_t
+IceInternal::ShmRing::push(const byte* buf, size_t length)
+{
+    uint64_t tail = _control->tail.load(memory_order_relaxed);
+    uint64_t head = _control->head.load(memory_order_acquire);
+    auto n = static_cast<size_t>(min(static_cast<uint64_t>(length), _size - readable(head, tail)));
+    if (n == 0)
+    {
+        return 0;
+    }
+
+    // Copy up to the end of the data area, and the remainder at its beginning.
+    auto index = static_cast<size_t>(tail & (_size - 1));
+    size_t first = min(n, _size - index);
+    memcpy(_data + index, buf, first);
+    memcpy(_data, buf + first, n - first);
+
+    _control->tail.store(tail + n, memory_order_release);
+    return n;
+}
+
+bool
+IceInternal::ShmRing::takeReaderWaiting()
+{
+    // Order the publication of the tail before the load of the flag, this pairs with the fence of waitForData.
+    atomic_thread_fence(memory_order_seq_cst);
+    return _control->readerWaiting.load(memory_order_relaxed) != 0 && _control->readerWaiting.exchange(0) != 0;
+}
+
+bool
+IceInternal::ShmRing::waitForSpace()
+{
+    _control->writerWaiting.store(1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    uint64_t tail = _control->tail.load(memory_order_relaxed);
+    uint64_t head = _control->head.load(memory_order_acquire);
+    if (readable(head, tail) < _size)
+    {
+        _control->writerWaiting.store(0, memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+size_t
+IceInternal::ShmRing::pop(byte* buf, size_t length)
+{
+    uint64_t head = _control->head.load(memory_order_relaxed);
+    uint64_t tail = _control->tail.load(memory_order_acquire);
+    auto n = static_cast<size_t>(min(static_cast<uint64_t>(length), readable(head, tail)));
+    if (n == 0)
+    {
+        return 0;
+    }
+
+    auto index = static_cast<size_t>(head & (_size - 1));
+    size_t first = min(n, _size - index);
+    memcpy(buf, _data + index, first);
+    memcpy(buf + first, _data, n - first);
+
+    _control->head.store(head + n, memory_order_release);
+    return n;
+}
+
+bool
+IceInternal::ShmRing::takeWriterWaiting()
+{
+    // Order the release of the space before the load of the flag, this pairs with the fence of waitForSpace.
+    atomic_thread_fence(memory_order_seq_cst);
+    return _control->writerWaiting.load(memory_order_relaxed) != 0 && _control->writerWaiting.exchange(0) != 0;
+}
+
+bool
+IceInternal::ShmRing::waitForData()
+{
+    _control->readerWaiting.store(1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    if (!empty())
+    {
+        _control->readerWaiting.store(0, memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+bool
+IceInternal::ShmRing::empty() const
+{
+    return readable(_control->head.load(memory_order_relaxed), _control->tail.load(memory_order_acquire)) == 0;
+}
+
+uint64_t
+IceInternal::ShmRing::readable(uint64_t head, uint64_t tail) const
+{
+    // The positions are only trusted once checked: the peer could have corrupted the control block.
+    uint64_t n = tail - head;
+    if (n > _size)
+    {
+        throw ProtocolException{__FILE__, __LINE__, "invalid shared memory ring positions"};
+    }
+    return n;
+}
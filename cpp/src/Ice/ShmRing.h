@@ -0,0 +1,73 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_SHM_RING_H
+#define ICE_SHM_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace IceInternal
+{
+    // The control block of a ring buffer shared by two processes. The positions count the bytes written and read
+    // since the creation of the ring, they never wrap. Each position is on its own cache line to avoid false sharing
+    // between the producer and the consumer.
+    struct ShmRingControl
+    {
+        alignas(64) std::atomic<std::uint64_t> tail; // Updated by the producer.
+        alignas(64) std::atomic<std::uint64_t> head; // Updated by the consumer.
+
+        // Set by the consumer before waiting for data and by the producer before waiting for space. The other side
+        // clears the flag and notifies the waiting side once it made progress.
+        alignas(64) std::atomic<std::uint32_t> readerWaiting;
+        std::atomic<std::uint32_t> writerWaiting;
+    };
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "the ring positions must be address-free");
+
+    // A single-producer single-consumer byte ring in shared memory. Each process creates its own ShmRing over the
+    // mapped control block and data area: the producer only calls the producer methods, the consumer only calls the
+    // consumer methods. The peer is not trusted: a corrupted position raises ProtocolException instead of reading or
+    // writing outside of the data area.
+    class ShmRing
+    {
+    public:
+        ShmRing() = default;
+        ShmRing(ShmRingControl*, std::byte*, std::size_t);
+
+        // Producer methods.
+
+        // Copies up to length bytes into the ring and publishes them. Returns the number of bytes copied.
+        std::size_t push(const std::byte*, std::size_t);
+
+        // Returns true if the consumer waits for data, in which case it must be notified. The flag is cleared.
+        bool takeReaderWaiting();
+
+        // Records that the producer waits for space. Returns false if space was freed in the meantime, in which
+        // case the producer must not wait.
+        bool waitForSpace();
+
+        // Consumer methods.
+
+        // Copies up to length bytes out of the ring and releases their space. Returns the number of bytes copied.
+        std::size_t pop(std::byte*, std::size_t);
+
+        // Returns true if the producer waits for space, in which case it must be notified. The flag is cleared.
+        bool takeWriterWaiting();
+
+        // Records that the consumer waits for data. Returns false if data was published in the meantime, in which
+        // case the consumer must not wait.
+        bool waitForData();
+
+        [[nodiscard]] bool empty() const;
+
+    private:
+        std::uint64_t readable(std::uint64_t, std::uint64_t) const;
+
+        ShmRingControl* _control{nullptr};
+        std::byte* _data{nullptr};
+        std::size_t _size{0};
+    };
+}
+
+#endif
@@ -0,0 +1,536 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Config.h"
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#    include "ShmTransceiver.h"
+#    include "Ice/LocalExceptions.h"
+#    include "Ice/Properties.h"
+#    include "ProtocolInstance.h"
+
+#    include <atomic>
+#    include <cassert>
+#    include <cstring>
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+    // The first page of the segment holds the control blocks of the two rings, the data areas follow: first the
+    // data area of the client to server ring, then the data area of the server to client ring.
+    const size_t controlSize = 4096;
+    static_assert(2 * sizeof(ShmRingControl) <= controlSize);
+
+    const size_t minRingSize = 4096;
+    const size_t maxRingSize = size_t{1} << 30;
+
+    // The socket only carries wake-up notifications. With a small send buffer, a writer waiting for space fills it
+    // with a single write.
+    const int socketBufferSize = 4096;
+    const size_t socketScratchSize = 16 * 1024;
+
+    // The message sent by the client with the descriptor of the segment.
+    struct Hello
+    {
+        char magic[4];
+        uint32_t version;
+        uint64_t ringSize;
+    };
+
+    const char helloMagic[4] = {'I', 'c', 'e', 'S'};
+    const uint32_t helloVersion = 1;
+
+    bool isValidRingSize(uint64_t size)
+    {
+        return size >= minRingSize && size <= maxRingSize && (size & (size - 1)) == 0;
+    }
+
+    [[noreturn]] void throwSocketException(const char* file, int line)
+    {
+        if (connectionLost())
+        {
+            throw ConnectionLostException(file, line, getSocketErrno());
+        }
+        else
+        {
+            throw SocketException(file, line, getSocketErrno());
+        }
+    }
+
+    int createSharedMemory()
+    {
+#    if defined(__linux__)
+        return memfd_create("ice-shm", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+#    else
+        // Create a uniquely named object and remove its name right away, the segment is only reachable through the
+        // descriptors of the two processes.
+        static atomic<unsigned int> counter{0};
+        string name = "/ice-shm-" + to_string(getpid()) + "-" + to_string(counter++);
+        int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd >= 0)
+        {
+            shm_unlink(name.c_str());
+            fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+        return fd;
+#    endif
+    }
+}
+
+IceInternal::ShmTransceiver::ShmTransceiver(ProtocolInstancePtr instance, TransceiverPtr del, bool incoming)
+    : _instance(std::move(instance)),
+      _delegate(std::move(del)),
+      _incoming(incoming),
+      _state(StateInitializeDelegate),
+      _ringSize(0),
+      _segmentFd(-1),
+      _segment(nullptr),
+      _segmentSize(0)
+{
+    _socketBuffer.b.resize(socketScratchSize);
+    if (!_incoming)
+    {
+        // The client chooses the size of the rings: round the configured size up to a power of two.
+        auto size = static_cast<size_t>(max(_instance->properties()->getIcePropertyAsInt("Ice.Shm.RingSize"), 0));
+        _ringSize = minRingSize;
+        while (_ringSize < size && _ringSize < maxRingSize)
+        {
+            _ringSize *= 2;
+        }
+    }
+}
+
+IceInternal::ShmTransceiver::~ShmTransceiver()
+{
+    if (_segment)
+    {
+        munmap(_segment, _segmentSize);
+    }
+    if (_segmentFd != -1)
+    {
+        ::close(_segmentFd);
+    }
+}
+
+NativeInfoPtr
+IceInternal::ShmTransceiver::getNativeInfo()
+{
+    return _delegate->getNativeInfo();
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::initialize(Buffer& readBuffer, Buffer& writeBuffer)
+{
+    if (_state == StateInitializeDelegate)
+    {
+        SocketOperation op = _delegate->initialize(readBuffer, writeBuffer);
+        if (op != SocketOperationNone)
+        {
+            return op;
+        }
+
+        setSendBufferSize(_delegate->getNativeInfo()->fd(), socketBufferSize);
+
+        if (_incoming)
+        {
+            _state = StateReceiveSegment;
+        }
+        else
+        {
+            createSegment();
+            _state = StateSendSegment;
+        }
+    }
+
+    if (_state == StateSendSegment)
+    {
+        if (!sendSegment())
+        {
+            return SocketOperationWrite;
+        }
+
+        // The server has its own descriptor once the message is sent, the mapping remains valid without ours.
+        ::close(_segmentFd);
+        _segmentFd = -1;
+        _state = StateOpened;
+    }
+    else if (_state == StateReceiveSegment)
+    {
+        if (!receiveSegment())
+        {
+            return SocketOperationRead;
+        }
+        _state = StateOpened;
+    }
+
+    return SocketOperationNone;
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::closing(bool initiator, exception_ptr ex)
+{
+    // The closure is reported by the socket: the initiator waits for the peer to close its end.
+    return _delegate->closing(initiator, ex);
+}
+
+void
+IceInternal::ShmTransceiver::close()
+{
+    _delegate->close();
+
+    if (_segment)
+    {
+        munmap(_segment, _segmentSize);
+        _segment = nullptr;
+    }
+    if (_segmentFd != -1)
+    {
+        ::close(_segmentFd);
+        _segmentFd = -1;
+    }
+    _state = StateClosed;
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::write(Buffer& buf)
+{
+    if (_state < StateOpened)
+    {
+        // The connection calls write with an empty buffer until the transceiver is initialized.
+        return buf.i == buf.b.end() ? SocketOperationNone : SocketOperationWrite;
+    }
+
+    while (buf.i != buf.b.end())
+    {
+        size_t n = _writeRing.push(&*buf.i, static_cast<size_t>(buf.b.end() - buf.i));
+        buf.i += static_cast<ptrdiff_t>(n);
+        if (n > 0 && _writeRing.takeReaderWaiting())
+        {
+            notify();
+        }
+
+        if (buf.i != buf.b.end())
+        {
+            // The ring is full. The socket is filled before recording that we wait for space: once the reader sees
+            // the flag, it drains the socket which becomes writable.
+            fill();
+            if (_writeRing.waitForSpace())
+            {
+                return SocketOperationWrite;
+            }
+        }
+    }
+    return SocketOperationNone;
+}
+
+SocketOperation
+IceInternal::ShmTransceiver::read(Buffer& buf)
+{
+    if (_state < StateOpened)
+    {
+        // The connection calls read with an empty buffer until the transceiver is initialized.
+        return buf.i == buf.b.end() ? SocketOperationNone : SocketOperationRead;
+    }
+
+    while (buf.i != buf.b.end())
+    {
+        size_t n = _readRing.pop(&*buf.i, static_cast<size_t>(buf.b.end() - buf.i));
+        buf.i += static_cast<ptrdiff_t>(n);
+        if (n > 0 && _readRing.takeWriterWaiting())
+        {
+            drain();
+        }
+
+        if (buf.i != buf.b.end())
+        {
+            // The ring is empty. Consume the notifications received so far before waiting for new ones.
+            drain();
+            if (_closed)
+            {
+                // The bytes written by the peer before closing the connection are read first.
+                if (_readRing.empty())
+                {
+                    rethrow_exception(_closed);
+                }
+            }
+            else if (_readRing.waitForData())
+            {
+                _delegate->getNativeInfo()->ready(SocketOperationRead, false);
+                return SocketOperationRead;
+            }
+        }
+    }
+
+    //
+    // The selector isn't notified of the bytes still in the ring since they are not in the socket: set the read
+    // ready status to get this socket's handler called again until the ring is empty. If the ring is empty, the
+    // writer must notify us of the next bytes it writes.
+    //
+    _delegate->getNativeInfo()->ready(SocketOperationRead, _closed || !_readRing.waitForData());
+    return SocketOperationNone;
+}
+
+string
+IceInternal::ShmTransceiver::protocol() const
+{
+    return _delegate->protocol();
+}
+
+string
+IceInternal::ShmTransceiver::toString() const
+{
+    return _delegate->toString();
+}
+
+string
+IceInternal::ShmTransceiver::toDetailedString() const
+{
+    return _delegate->toDetailedString();
+}
+
+ConnectionInfoPtr
+IceInternal::ShmTransceiver::getInfo(bool incoming, string adapterName, string connectionId) const
+{
+    return _delegate->getInfo(incoming, std::move(adapterName), std::move(connectionId));
+}
+
+void
+IceInternal::ShmTransceiver::checkSendSize(const Buffer& buf)
+{
+    _delegate->checkSendSize(buf);
+}
+
+void
+IceInternal::ShmTransceiver::setBufferSize(int, int)
+{
+    // The socket buffers are kept small, the messages don't go through the socket.
+}
+
+void
+IceInternal::ShmTransceiver::createSegment()
+{
+    int fd = createSharedMemory();
+    if (fd < 0)
+    {
+        throw SyscallException{__FILE__, __LINE__, "cannot create shared memory segment", errno};
+    }
+    _segmentFd = fd;
+
+    size_t size = controlSize + 2 * _ringSize;
+    if (ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+        throw SyscallException{__FILE__, __LINE__, "ftruncate failed", errno};
+    }
+
+#    if defined(__linux__)
+    // Prevent the server from resizing the segment: accessing the mapping beyond the end of the file would crash.
+    if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL) != 0)
+    {
+        throw SyscallException{__FILE__, __LINE__, "fcntl failed", errno};
+    }
+#    endif
+
+    // The new segment is filled with zeros, which is the initial state of the rings except for the reader flags:
+    // the readers don't read until they are notified of the first bytes.
+    mapSegment(fd, size);
+    for (size_t i = 0; i < 2; ++i)
+    {
+        static_cast<ShmRingControl*>(_segment)[i].readerWaiting.store(1, memory_order_relaxed);
+    }
+}
+
+bool
+IceInternal::ShmTransceiver::sendSegment()
+{
+    Hello hello{};
+    memcpy(hello.magic, helloMagic, sizeof(helloMagic));
+    hello.version = helloVersion;
+    hello.ringSize = _ringSize;
+
+    iovec iov{&hello, sizeof(hello)};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+    memcpy(CMSG_DATA(cmsg), &_segmentFd, sizeof(int));
+
+    SOCKET fd = _delegate->getNativeInfo()->fd();
+    while (true)
+    {
+        ssize_t ret = ::sendmsg(fd, &msg, 0);
+        if (ret == SOCKET_ERROR)
+        {
+            if (interrupted())
+            {
+                continue;
+            }
+            if (wouldBlock())
+            {
+                return false;
+            }
+            throwSocketException(__FILE__, __LINE__);
+        }
+
+        // The message is much smaller than the send buffer of a new connection, it's sent at once.
+        if (static_cast<size_t>(ret) != sizeof(hello))
+        {
+            throw SocketException{__FILE__, __LINE__, "cannot send the shared memory segment"};
+        }
+        return true;
+    }
+}
+
+bool
+IceInternal::ShmTransceiver::receiveSegment()
+{
+    Hello hello{};
+    iovec iov{&hello, sizeof(hello)};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    SOCKET fd = _delegate->getNativeInfo()->fd();
+    ssize_t ret;
+    while (true)
+    {
+#    if defined(__linux__)
+        ret = ::recvmsg(fd, &msg, MSG_CMSG_CLOEXEC);
+#    else
+        ret = ::recvmsg(fd, &msg, 0);
+#    endif
+        if (ret == 0)
+        {
+            throw ConnectionLostException(__FILE__, __LINE__, 0);
+        }
+        else if (ret == SOCKET_ERROR)
+        {
+            if (interrupted())
+            {
+                continue;
+            }
+            if (wouldBlock())
+            {
+                return false;
+            }
+            throwSocketException(__FILE__, __LINE__);
+        }
+        break;
+    }
+
+    int segmentFd = -1;
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS && cmsg->cmsg_len >= CMSG_LEN(sizeof(int)))
+        {
+            memcpy(&segmentFd, CMSG_DATA(cmsg), sizeof(int));
+        }
+    }
+    if (segmentFd == -1)
+    {
+        throw ProtocolException{__FILE__, __LINE__, "shared memory segment not received"};
+    }
+    _segmentFd = segmentFd;
+
+    if (static_cast<size_t>(ret) != sizeof(hello) || memcmp(hello.magic, helloMagic, sizeof(helloMagic)) != 0 ||
+        hello.version != helloVersion || !isValidRingSize(hello.ringSize))
+    {
+        throw ProtocolException{__FILE__, __LINE__, "invalid shared memory segment"};
+    }
+    _ringSize = static_cast<size_t>(hello.ringSize);
+    size_t size = controlSize + 2 * _ringSize;
+
+    // The segment comes from the client, it's only mapped if it can't be shrunk while in use.
+    struct stat st;
+    if (fstat(_segmentFd, &st) != 0 || static_cast<size_t>(st.st_size) < size)
+    {
+        throw ProtocolException{__FILE__, __LINE__, "invalid shared memory segment size"};
+    }
+#    if defined(__linux__)
+    int seals = fcntl(_segmentFd, F_GET_SEALS);
+    if (seals == -1 || (seals & F_SEAL_SHRINK) == 0)
+    {
+        throw ProtocolException{__FILE__, __LINE__, "shared memory segment not sealed"};
+    }
+#    endif
+
+    mapSegment(_segmentFd, size);
+    ::close(_segmentFd);
+    _segmentFd = -1;
+    return true;
+}
+
+void
+IceInternal::ShmTransceiver::mapSegment(int fd, size_t size)
+{
+    void* segment = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (segment == MAP_FAILED)
+    {
+        throw SyscallException{__FILE__, __LINE__, "mmap failed", errno};
+    }
+    _segment = segment;
+    _segmentSize = size;
+
+    auto* controls = static_cast<ShmRingControl*>(_segment);
+    auto* data = static_cast<byte*>(_segment) + controlSize;
+    ShmRing clientToServer(&controls[0], data, _ringSize);
+    ShmRing serverToClient(&controls[1], data + _ringSize, _ringSize);
+    _readRing = _incoming ? clientToServer : serverToClient;
+    _writeRing = _incoming ? serverToClient : clientToServer;
+}
+
+void
+IceInternal::ShmTransceiver::notify()
+{
+    // A single byte wakes up the reader. If the socket is full, the reader has bytes to read already.
+    _socketBuffer.i = _socketBuffer.b.end() - 1;
+    _delegate->write(_socketBuffer);
+}
+
+void
+IceInternal::ShmTransceiver::fill()
+{
+    // Write to the socket until the kernel doesn't accept more bytes, the socket is then no longer writable. This
+    // also wakes up the reader.
+    do
+    {
+        _socketBuffer.i = _socketBuffer.b.begin();
+    } while (_delegate->write(_socketBuffer) == SocketOperationNone);
+}
+
+void
+IceInternal::ShmTransceiver::drain()
+{
+    if (_closed)
+    {
+        return;
+    }
+
+    try
+    {
+        do
+        {
+            _socketBuffer.i = _socketBuffer.b.begin();
+        } while (_delegate->read(_socketBuffer) == SocketOperationNone);
+    }
+    catch (const ConnectionLostException&)
+    {
+        _closed = current_exception();
+    }
+}
+#endif
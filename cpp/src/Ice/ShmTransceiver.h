@@ -0,0 +1,85 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_SHM_TRANSCEIVER_H
+#define ICE_SHM_TRANSCEIVER_H
+
+#include "Ice/Buffer.h"
+#include "Network.h"
+#include "ProtocolInstanceF.h"
+#include "ShmRing.h"
+#include "Transceiver.h"
+
+namespace IceInternal
+{
+    // Exchanges the bytes of a connection through two rings, one per direction, in a shared memory segment created
+    // by the client and passed to the server over the delegate Unix domain socket. The messages are copied into and
+    // out of the rings without system calls. The socket remains the native handle monitored by the selector, the
+    // peers write to it only to wake each other up:
+    // - a reader waiting for data is woken up by a byte sent by the writer once it published new data;
+    // - a writer waiting for space fills its socket send buffer, which makes the socket not writable. The reader
+    //   drains the socket once it released space, and the socket becomes writable again.
+    // The socket also reports the closure of the connection or the death of the peer process.
+    class ShmTransceiver final : public Transceiver
+    {
+    public:
+        ShmTransceiver(ProtocolInstancePtr, TransceiverPtr, bool);
+        ~ShmTransceiver();
+
+        NativeInfoPtr getNativeInfo() final;
+
+        SocketOperation initialize(Buffer&, Buffer&) final;
+        SocketOperation closing(bool, std::exception_ptr) final;
+        void close() final;
+        SocketOperation write(Buffer&) final;
+        SocketOperation read(Buffer&) final;
+
+        [[nodiscard]] std::string protocol() const final;
+        [[nodiscard]] std::string toString() const final;
+        [[nodiscard]] std::string toDetailedString() const final;
+        [[nodiscard]] Ice::ConnectionInfoPtr
+        getInfo(bool incoming, std::string adapterName, std::string connectionId) const final;
+        void checkSendSize(const Buffer&) final;
+        void setBufferSize(int rcvSize, int sndSize) final;
+
+    private:
+        void createSegment();
+        bool sendSegment();
+        bool receiveSegment();
+        void mapSegment(int, std::size_t);
+
+        void notify();
+        void fill();
+        void drain();
+
+        const ProtocolInstancePtr _instance;
+        const TransceiverPtr _delegate;
+        const bool _incoming;
+
+        enum State
+        {
+            StateInitializeDelegate,
+            StateSendSegment,
+            StateReceiveSegment,
+            StateOpened,
+            StateClosed
+        };
+
+        State _state;
+
+        std::size_t _ringSize;
+        int _segmentFd;
+        void* _segment;
+        std::size_t _segmentSize;
+        ShmRing _readRing;
+        ShmRing _writeRing;
+
+        // The scratch buffer for the bytes written to and read from the socket.
+        Buffer _socketBuffer;
+
+        // Set once the socket reported the closure of the connection: the bytes still in the read ring are read
+        // before raising this exception.
+        std::exception_ptr _closed;
+    };
+}
+
+#endif
@@ -4,6 +4,15 @@
 #include "NetworkProxy.h"
 #include "ProtocolInstance.h"
 
+#if !defined(_WIN32)
+#    include <sys/uio.h>
+#endif
+
+#if defined(__linux__) && defined(MSG_ZEROCOPY) && defined(SO_ZEROCOPY)
+#    include <linux/errqueue.h>
+#    define ICE_HAS_ZEROCOPY
+#endif
+
 using namespace IceInternal;
 
 StreamSocket::StreamSocket(
@@ -145,9 +154,44 @@ StreamSocket::setBufferSize(int rcvSize, int sndSize)
     setTcpBufSize(_fd, rcvSize, sndSize, _instance);
 }
 
+void
+StreamSocket::setReadAheadSize(size_t size)
+{
+    assert(_readAheadBegin == _readAheadEnd);
+#if defined(ICE_USE_IOCP)
+    // With IOCP, reads are asynchronous and performed by startRead/finishRead: read-ahead isn't supported.
+    (void)size;
+#else
+    _readAhead.resize(size);
+    _readAhead.shrink_to_fit();
+#endif
+}
+
+bool
+StreamSocket::setZeroCopyThreshold([[maybe_unused]] size_t threshold)
+{
+#if defined(ICE_HAS_ZEROCOPY)
+    int flag = 1;
+    if (setsockopt(_fd, SOL_SOCKET, SO_ZEROCOPY, &flag, sizeof(flag)) == SOCKET_ERROR)
+    {
+        return false; // Not supported by the kernel.
+    }
+    _zeroCopyThreshold = threshold;
+    return true;
+#else
+    return false;
+#endif
+}
+
 SocketOperation
 StreamSocket::read(Buffer& buf)
 {
+    if (_zeroCopySent != _zeroCopyCompleted)
+    {
+        // Zero-copy notifications are reported as a socket error condition: receive them to clear the condition.
+        completeZeroCopy();
+    }
+
     if (_state == StateProxyRead)
     {
         while (true)
@@ -165,7 +209,56 @@ StreamSocket::read(Buffer& buf)
             }
         }
     }
-    buf.i += read(reinterpret_cast<char*>(&*buf.i), static_cast<size_t>(buf.b.end() - buf.i));
+
+    if (_readAhead.empty())
+    {
+        buf.i += read(reinterpret_cast<char*>(&*buf.i), static_cast<size_t>(buf.b.end() - buf.i));
+        return buf.i != buf.b.end() ? SocketOperationRead : SocketOperationNone;
+    }
+
+    //
+    // First consume the bytes already received in the read-ahead buffer.
+    //
+    auto length = static_cast<size_t>(buf.b.end() - buf.i);
+    if (_readAheadBegin < _readAheadEnd)
+    {
+        size_t n = std::min(length, _readAheadEnd - _readAheadBegin);
+        memcpy(&*buf.i, _readAhead.data() + _readAheadBegin, n);
+        buf.i += n;
+        length -= n;
+        _readAheadBegin += n;
+    }
+
+    if (length > 0)
+    {
+        assert(_readAheadBegin == _readAheadEnd);
+        _readAheadBegin = 0;
+        _readAheadEnd = 0;
+
+        if (length >= _readAhead.size())
+        {
+            // Large reads go directly to the caller's buffer, there's nothing to gain from buffering them.
+            buf.i += read(reinterpret_cast<char*>(&*buf.i), length);
+        }
+        else
+        {
+            // Read as much as the kernel has to offer with a single call and keep the bytes not requested by the
+            // caller for the next reads. These bytes are typically the header and body of the next messages.
+            auto n = static_cast<size_t>(read(reinterpret_cast<char*>(_readAhead.data()), _readAhead.size()));
+            size_t consumed = std::min(n, length);
+            memcpy(&*buf.i, _readAhead.data(), consumed);
+            buf.i += consumed;
+            _readAheadBegin = consumed;
+            _readAheadEnd = n;
+        }
+    }
+
+    //
+    // The selector isn't notified of the buffered bytes since they are no longer in the socket: set the read ready
+    // status to get this socket's handler called again until the buffer is drained.
+    //
+    ready(SocketOperationRead, _readAheadBegin < _readAheadEnd);
+
     return buf.i != buf.b.end() ? SocketOperationRead : SocketOperationNone;
 }
 
@@ -189,10 +282,158 @@ StreamSocket::write(Buffer& buf)
             }
         }
     }
-    buf.i += write(reinterpret_cast<const char*>(&*buf.i), static_cast<size_t>(buf.b.end() - buf.i));
+
+    if (_zeroCopySent != _zeroCopyCompleted)
+    {
+        completeZeroCopy();
+    }
+
+    auto length = static_cast<size_t>(buf.b.end() - buf.i);
+    if (_zeroCopyThreshold > 0 && length >= _zeroCopyThreshold)
+    {
+        buf.i += writeZeroCopy(reinterpret_cast<const char*>(&*buf.i), length);
+    }
+    else
+    {
+        buf.i += write(reinterpret_cast<const char*>(&*buf.i), length);
+    }
     return buf.i != buf.b.end() ? SocketOperationWrite : SocketOperationNone;
 }
 
+SocketOperation
+StreamSocket::writev(const std::vector<Buffer*>& buffers)
+{
+#if defined(_WIN32)
+    for (Buffer* buf : buffers)
+    {
+        if (buf->i != buf->b.end() && write(*buf) != SocketOperationNone)
+        {
+            return SocketOperationWrite;
+        }
+    }
+    return SocketOperationNone;
+#else
+    assert(_fd != INVALID_SOCKET);
+
+    if (_state == StateProxyWrite)
+    {
+        for (Buffer* buf : buffers)
+        {
+            if (buf->i != buf->b.end() && write(*buf) != SocketOperationNone)
+            {
+                return SocketOperationWrite;
+            }
+        }
+        return SocketOperationNone;
+    }
+
+    if (_zeroCopySent != _zeroCopyCompleted)
+    {
+        completeZeroCopy();
+    }
+
+    //
+    // Gather as many buffers as we can in a single sendmsg call. The buffers are written in order, so once a call
+    // doesn't write everything we were asked to write, the kernel send buffer is full and we let the caller wait for
+    // write readiness.
+    //
+    const size_t maxIovecs = 64;
+    iovec iov[maxIovecs];
+    size_t first = 0;
+    while (true)
+    {
+        while (first < buffers.size() && buffers[first]->i == buffers[first]->b.end())
+        {
+            ++first;
+        }
+        if (first == buffers.size())
+        {
+            return SocketOperationNone;
+        }
+
+        size_t count = 0;
+        size_t total = 0;
+        for (size_t j = first; j < buffers.size() && count < maxIovecs; ++j)
+        {
+            Buffer* buf = buffers[j];
+            if (buf->i != buf->b.end())
+            {
+                iov[count].iov_base = buf->i;
+                iov[count].iov_len = static_cast<size_t>(buf->b.end() - buf->i);
+                total += iov[count].iov_len;
+                ++count;
+            }
+        }
+
+        msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_iov = iov;
+        msg.msg_iovlen = count;
+
+        int flags = 0;
+#    if defined(ICE_HAS_ZEROCOPY)
+        if (_zeroCopyThreshold > 0 && total >= _zeroCopyThreshold)
+        {
+            flags = MSG_ZEROCOPY;
+        }
+#    endif
+
+        ssize_t ret = ::sendmsg(_fd, &msg, flags);
+        if (ret == 0)
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, 0);
+        }
+        else if (ret == SOCKET_ERROR)
+        {
+            if (interrupted())
+            {
+                continue;
+            }
+
+            if (flags && noBuffers())
+            {
+                // The kernel ran out of memory to pin the pages, retry with a regular send.
+                _zeroCopyThreshold = 0;
+                continue;
+            }
+
+            if (wouldBlock())
+            {
+                return SocketOperationWrite;
+            }
+
+            if (connectionLost())
+            {
+                throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+
+        if (flags)
+        {
+            ++_zeroCopySent;
+        }
+
+        auto sent = static_cast<size_t>(ret);
+        for (size_t j = first; j < buffers.size() && sent > 0; ++j)
+        {
+            Buffer* buf = buffers[j];
+            auto length = static_cast<size_t>(buf->b.end() - buf->i);
+            if (sent < length)
+            {
+                buf->i += sent;
+                return SocketOperationWrite;
+            }
+            buf->i = buf->b.end();
+            sent -= length;
+        }
+    }
+#endif
+}
+
 ssize_t
 StreamSocket::read(char* buf, size_t length)
 {
@@ -319,6 +560,122 @@ StreamSocket::write(const char* buf, size_t length)
     return sent;
 }
 
+ssize_t
+StreamSocket::writeZeroCopy(const char* buf, size_t length)
+{
+#if defined(ICE_HAS_ZEROCOPY)
+    assert(_fd != INVALID_SOCKET);
+
+    ssize_t sent = 0;
+    while (length > 0)
+    {
+        ssize_t ret = ::send(_fd, buf, length, MSG_ZEROCOPY);
+        if (ret == 0)
+        {
+            throw Ice::ConnectionLostException(__FILE__, __LINE__, 0);
+        }
+        else if (ret == SOCKET_ERROR)
+        {
+            if (interrupted())
+            {
+                continue;
+            }
+
+            if (noBuffers())
+            {
+                // The kernel ran out of memory to pin the pages (the optmem limit is reached), fallback to a regular
+                // send and disable zero-copy for this socket.
+                _zeroCopyThreshold = 0;
+                return sent + write(buf, length);
+            }
+
+            if (wouldBlock())
+            {
+                return sent;
+            }
+
+            if (connectionLost())
+            {
+                throw Ice::ConnectionLostException(__FILE__, __LINE__, getSocketErrno());
+            }
+            else
+            {
+                throw Ice::SocketException(__FILE__, __LINE__, getSocketErrno());
+            }
+        }
+
+        ++_zeroCopySent;
+        buf += ret;
+        sent += ret;
+        length -= static_cast<size_t>(ret);
+    }
+    return sent;
+#else
+    return write(buf, length);
+#endif
+}
+
+void
+StreamSocket::completeZeroCopy()
+{
+#if defined(ICE_HAS_ZEROCOPY)
+    while (_zeroCopyCompleted != _zeroCopySent)
+    {
+        char control[128];
+        msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        if (::recvmsg(_fd, &msg, MSG_ERRQUEUE) == SOCKET_ERROR)
+        {
+            if (interrupted())
+            {
+                continue;
+            }
+            return; // No more notifications for now.
+        }
+
+        for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+        {
+            if ((cmsg->cmsg_level != SOL_IP || cmsg->cmsg_type != IP_RECVERR) &&
+                (cmsg->cmsg_level != SOL_IPV6 || cmsg->cmsg_type != IPV6_RECVERR))
+            {
+                continue;
+            }
+
+            const auto* err = reinterpret_cast<const sock_extended_err*>(CMSG_DATA(cmsg));
+            if (err->ee_errno != 0 || err->ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+            {
+                continue;
+            }
+
+            // The sends from ee_info to ee_data (inclusive) are released.
+            _zeroCopyReleased.emplace_back(err->ee_info, err->ee_data + 1);
+        }
+
+        //
+        // Advance the completion count with the ranges which follow it. Ranges are usually notified in order, the
+        // ranges notified out of order are kept until the ranges before them are notified.
+        //
+        bool advanced = true;
+        while (advanced)
+        {
+            advanced = false;
+            for (auto p = _zeroCopyReleased.begin(); p != _zeroCopyReleased.end(); ++p)
+            {
+                if (p->first == _zeroCopyCompleted)
+                {
+                    _zeroCopyCompleted = p->second;
+                    _zeroCopyReleased.erase(p);
+                    advanced = true;
+                    break;
+                }
+            }
+        }
+    }
+#endif
+}
+
 #if defined(ICE_USE_IOCP)
 AsyncInfo*
 StreamSocket::getAsyncInfo(SocketOperation op)
@@ -463,6 +820,10 @@ void
 StreamSocket::close()
 {
     assert(_fd != INVALID_SOCKET);
+    _readAhead.clear();
+    _readAheadBegin = 0;
+    _readAheadEnd = 0;
+    _zeroCopyReleased.clear();
     try
     {
         closeSocket(_fd);
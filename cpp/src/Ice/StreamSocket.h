@@ -7,7 +7,10 @@
 #include "Network.h"
 #include "ProtocolInstanceF.h"
 
+#include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace IceInternal
 {
@@ -25,8 +28,29 @@ namespace IceInternal
 
         void setBufferSize(int rcvSize, int sndSize);
 
+        /// Enables the read-ahead buffer. When enabled, small reads are served from a buffer of the given size which
+        /// is filled with a single system call, so several small protocol messages can be received with one recv().
+        /// @param size The read-ahead buffer size in bytes. 0 disables read-ahead.
+        void setReadAheadSize(size_t size);
+
+        /// Enables zero-copy sends (MSG_ZEROCOPY) for writes of at least the given size. The buffer of a zero-copy
+        /// send must be kept unchanged until the kernel releases it, see zeroCopyCompleted(). While zero-copy sends
+        /// are pending, each read and write first calls recvmsg(MSG_ERRQUEUE) to receive their completion, an extra
+        /// system call which only pays off for writes large enough to make avoiding the copy worthwhile.
+        /// @param threshold The minimum number of bytes to write for a write to use zero-copy.
+        /// @return true if enabled, false if zero-copy sends are not supported.
+        bool setZeroCopyThreshold(size_t threshold);
+
+        /// Returns the number of zero-copy sends performed so far.
+        [[nodiscard]] std::uint32_t zeroCopySent() const { return _zeroCopySent; }
+
+        /// Returns the number of zero-copy sends released by the kernel. The notifications are received with the
+        /// read and write calls, which are called when the socket reports an error condition.
+        [[nodiscard]] std::uint32_t zeroCopyCompleted() const { return _zeroCopyCompleted; }
+
         SocketOperation read(Buffer&);
         SocketOperation write(Buffer&);
+        SocketOperation writev(const std::vector<Buffer*>&);
 
         ssize_t read(char*, size_t);
         ssize_t write(const char*, size_t);
@@ -56,6 +80,9 @@ namespace IceInternal
         };
         [[nodiscard]] State toState(SocketOperation) const;
 
+        ssize_t writeZeroCopy(const char*, size_t);
+        void completeZeroCopy();
+
         const ProtocolInstancePtr _instance;
         const NetworkProxyPtr _proxy;
         const Address _addr;
@@ -64,6 +91,21 @@ namespace IceInternal
         State _state;
         std::string _desc;
 
+        // The read-ahead buffer, empty if read-ahead is disabled. The bytes between _readAheadBegin and _readAheadEnd
+        // were received but not consumed yet.
+        std::vector<std::byte> _readAhead;
+        size_t _readAheadBegin{0};
+        size_t _readAheadEnd{0};
+
+        // Zero-copy sends are used for writes of at least _zeroCopyThreshold bytes, 0 if disabled. The kernel numbers
+        // the zero-copy sends of a socket and notifies ranges of released sends through the socket error queue:
+        // _zeroCopyCompleted is the number of sends released so far and _zeroCopyReleased holds the ranges released
+        // out of order.
+        size_t _zeroCopyThreshold{0};
+        std::uint32_t _zeroCopySent{0};
+        std::uint32_t _zeroCopyCompleted{0};
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> _zeroCopyReleased;
+
 #if defined(ICE_USE_IOCP)
         size_t _maxSendPacketSize;
         size_t _maxRecvPacketSize;
@@ -64,6 +64,12 @@ IceInternal::TcpAcceptor::listen()
     return _endpoint;
 }
 
+bool
+IceInternal::TcpAcceptor::setReusePort()
+{
+    return IceInternal::setReusePort(_fd, true);
+}
+
 #    if defined(ICE_USE_IOCP)
 
 AsyncInfo*
@@ -4,6 +4,7 @@
 
 #if !defined(__APPLE__) || TARGET_OS_IPHONE == 0
 
+#    include "HashUtil.h"
 #    include "Ice/LoggerUtil.h"
 #    include "Network.h"
 #    include "NetworkProxy.h"
@@ -37,6 +38,17 @@ IceInternal::TcpConnector::toString() const
     return addrToString(!_proxy ? _addr : _proxy->getAddress());
 }
 
+size_t
+IceInternal::TcpConnector::hash() const noexcept
+{
+    size_t h = 5381;
+    hashAdd(h, hashAddress(_addr));
+    hashAdd(h, _timeout);
+    hashAdd(h, hashAddress(_sourceAddr));
+    hashAdd(h, _connectionId);
+    return h;
+}
+
 bool
 IceInternal::TcpConnector::operator==(const Connector& r) const
 {
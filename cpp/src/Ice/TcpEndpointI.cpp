@@ -4,6 +4,7 @@
 
 #if !defined(__APPLE__) || TARGET_OS_IPHONE == 0
 
+#    include "Compressor.h"
 #    include "HashUtil.h"
 #    include "Ice/InputStream.h"
 #    include "Ice/LocalExceptions.h"
@@ -38,10 +39,12 @@ IceInternal::TcpEndpointI::TcpEndpointI(
     const Address& sourceAddr,
     int32_t timeout,
     const string& connectionId,
-    bool compress)
+    bool compress,
+    uint8_t compressionCodec)
     : IPEndpointI(instance, host, port, sourceAddr, connectionId),
       _timeout(timeout),
-      _compress(compress)
+      _compress(compress),
+      _compressionCodec(compressionCodec)
 {
 }
 
@@ -49,14 +52,16 @@ IceInternal::TcpEndpointI::TcpEndpointI(const ProtocolInstancePtr& instance)
     : IPEndpointI(instance),
       // The default timeout for TCP endpoints is 60,000 milliseconds. This timeout is not used in Ice 3.8 and greater.
       _timeout(60000),
-      _compress(false)
+      _compress(false),
+      _compressionCodec(0)
 {
 }
 
 IceInternal::TcpEndpointI::TcpEndpointI(const ProtocolInstancePtr& instance, InputStream* s)
     : IPEndpointI(instance, s),
       _timeout(-1),
-      _compress(false)
+      _compress(false),
+      _compressionCodec(0)
 {
     s->read(const_cast<int32_t&>(_timeout));
     s->read(const_cast<bool&>(_compress));
@@ -98,7 +103,15 @@ IceInternal::TcpEndpointI::timeout(int32_t timeout) const
     }
     else
     {
-        return make_shared<TcpEndpointI>(_instance, _host, _port, _sourceAddr, timeout, _connectionId, _compress);
+        return make_shared<TcpEndpointI>(
+            _instance,
+            _host,
+            _port,
+            _sourceAddr,
+            timeout,
+            _connectionId,
+            _compress,
+            _compressionCodec);
     }
 }
 
@@ -117,10 +130,24 @@ IceInternal::TcpEndpointI::compress(bool compress) const
     }
     else
     {
-        return make_shared<TcpEndpointI>(_instance, _host, _port, _sourceAddr, _timeout, _connectionId, compress);
+        return make_shared<TcpEndpointI>(
+            _instance,
+            _host,
+            _port,
+            _sourceAddr,
+            _timeout,
+            _connectionId,
+            compress,
+            _compressionCodec);
     }
 }
 
+uint8_t
+IceInternal::TcpEndpointI::compressionCodec() const
+{
+    return _compressionCodec;
+}
+
 bool
 IceInternal::TcpEndpointI::datagram() const
 {
@@ -139,7 +166,15 @@ IceInternal::TcpEndpointI::toPublishedEndpoint(string publishedHost) const
     }
     else
     {
-        return make_shared<TcpEndpointI>(_instance, publishedHost, _port, Address{}, _timeout, "", _compress);
+        return make_shared<TcpEndpointI>(
+            _instance,
+            publishedHost,
+            _port,
+            Address{},
+            _timeout,
+            "",
+            _compress,
+            _compressionCodec);
     }
 }
 
@@ -169,7 +204,15 @@ IceInternal::TcpEndpointI::endpoint(const TcpAcceptorPtr& acceptor) const
     }
     else
     {
-        return make_shared<TcpEndpointI>(_instance, _host, port, _sourceAddr, _timeout, _connectionId, _compress);
+        return make_shared<TcpEndpointI>(
+            _instance,
+            _host,
+            port,
+            _sourceAddr,
+            _timeout,
+            _connectionId,
+            _compress,
+            _compressionCodec);
     }
 }
 
@@ -200,6 +243,11 @@ IceInternal::TcpEndpointI::options() const
         s << " -z";
     }
 
+    if (_compressionCodec)
+    {
+        s << " --codec " << codecName(_compressionCodec);
+    }
+
     return s.str();
 }
 
@@ -231,6 +279,10 @@ IceInternal::TcpEndpointI::operator==(const Endpoint& r) const
     {
         return false;
     }
+
+    // The compression codec is not compared: it's a local setting which isn't marshaled. Endpoints which only differ
+    // by their codec are equal and share the same connections, the codec of the endpoint which established the
+    // connection is used.
     return true;
 }
 
@@ -291,6 +343,27 @@ IceInternal::TcpEndpointI::checkOption(const string& option, const string& argum
         return true;
     }
 
+    if (option == "--codec")
+    {
+        if (argument.empty())
+        {
+            throw ParseException(
+                __FILE__,
+                __LINE__,
+                "no argument provided for --codec option in endpoint '" + endpoint + "'");
+        }
+
+        const_cast<uint8_t&>(_compressionCodec) = codecFromName(argument);
+        if (!_compressionCodec)
+        {
+            throw ParseException(
+                __FILE__,
+                __LINE__,
+                "invalid compression codec '" + argument + "' in endpoint '" + endpoint + "'");
+        }
+        return true;
+    }
+
     switch (option[1])
     {
         case 't':
@@ -350,7 +423,15 @@ IceInternal::TcpEndpointI::createConnector(const Address& address, const Network
 IPEndpointIPtr
 IceInternal::TcpEndpointI::createEndpoint(const string& host, int port, const string& connectionId) const
 {
-    return make_shared<TcpEndpointI>(_instance, host, port, _sourceAddr, _timeout, connectionId, _compress);
+    return make_shared<TcpEndpointI>(
+        _instance,
+        host,
+        port,
+        _sourceAddr,
+        _timeout,
+        connectionId,
+        _compress,
+        _compressionCodec);
 }
 
 IceInternal::TcpEndpointFactory::TcpEndpointFactory(ProtocolInstancePtr instance) : _instance(std::move(instance)) {}
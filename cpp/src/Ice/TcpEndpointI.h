@@ -21,7 +21,8 @@ namespace IceInternal
             const Address&,
             std::int32_t,
             const std::string&,
-            bool);
+            bool,
+            std::uint8_t);
         TcpEndpointI(const ProtocolInstancePtr&);
         TcpEndpointI(const ProtocolInstancePtr&, Ice::InputStream*);
 
@@ -33,6 +34,7 @@ namespace IceInternal
         [[nodiscard]] EndpointIPtr timeout(std::int32_t) const final;
         [[nodiscard]] bool compress() const final;
         [[nodiscard]] EndpointIPtr compress(bool) const final;
+        [[nodiscard]] std::uint8_t compressionCodec() const final;
         [[nodiscard]] bool datagram() const final;
 
         [[nodiscard]] std::shared_ptr<EndpointI> toPublishedEndpoint(std::string publishedHost) const final;
@@ -63,6 +65,7 @@ namespace IceInternal
         //
         const std::int32_t _timeout;
         const bool _compress;
+        const std::uint8_t _compressionCodec; // Not marshaled, like the source address.
     };
 
     class TcpEndpointFactory final : public EndpointFactory
@@ -55,6 +55,12 @@ IceInternal::TcpTransceiver::read(Buffer& buf)
     return _stream->read(buf);
 }
 
+SocketOperation
+IceInternal::TcpTransceiver::writev(const vector<Buffer*>& buffers)
+{
+    return _stream->writev(buffers);
+}
+
 #    if defined(ICE_USE_IOCP)
 bool
 IceInternal::TcpTransceiver::startWrite(Buffer& buf)
@@ -137,6 +143,30 @@ IceInternal::TcpTransceiver::setBufferSize(int rcvSize, int sndSize)
     _stream->setBufferSize(rcvSize, sndSize);
 }
 
+void
+IceInternal::TcpTransceiver::setReadAheadSize(size_t size)
+{
+    _stream->setReadAheadSize(size);
+}
+
+bool
+IceInternal::TcpTransceiver::setZeroCopyThreshold(size_t threshold)
+{
+    return _stream->setZeroCopyThreshold(threshold);
+}
+
+uint32_t
+IceInternal::TcpTransceiver::zeroCopySent() const
+{
+    return _stream->zeroCopySent();
+}
+
+uint32_t
+IceInternal::TcpTransceiver::zeroCopyCompleted() const
+{
+    return _stream->zeroCopyCompleted();
+}
+
 IceInternal::TcpTransceiver::TcpTransceiver(ProtocolInstancePtr instance, StreamSocketPtr stream)
     : _instance(std::move(instance)),
       _stream(std::move(stream))
@@ -26,6 +26,7 @@ namespace IceInternal
         void close() final;
         SocketOperation write(Buffer&) final;
         SocketOperation read(Buffer&) final;
+        SocketOperation writev(const std::vector<Buffer*>&) final;
 #if defined(ICE_USE_IOCP)
         bool startWrite(Buffer&) final;
         void finishWrite(Buffer&) final;
@@ -40,6 +41,10 @@ namespace IceInternal
         getInfo(bool incoming, std::string adapterName, std::string connectionId) const final;
         void checkSendSize(const Buffer&) final;
         void setBufferSize(int rcvSize, int sndSize) final;
+        void setReadAheadSize(size_t size) final;
+        bool setZeroCopyThreshold(size_t threshold) final;
+        [[nodiscard]] std::uint32_t zeroCopySent() const final;
+        [[nodiscard]] std::uint32_t zeroCopyCompleted() const final;
 
     private:
         friend class TcpConnector;
@@ -143,13 +143,18 @@ IceInternal::ThreadPool::create(const InstancePtr& instance, const string& prefi
     return threadPool;
 }
 
-IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, string prefix, int timeout)
+IceInternal::ThreadPool::ThreadPool(const InstancePtr& instance, string prefix, int timeout, int reactorId)
     : _instance(instance),
       _executor(_instance->initializationData().executor),
       _prefix(std::move(prefix)),
+#if defined(ICE_USE_IO_URING)
+      _selector(instance, instance->initializationData().properties->getPropertyAsInt(_prefix + ".IoUring") > 0),
+#else
       _selector(instance),
+#endif
       _serialize(_instance->initializationData().properties->getPropertyAsInt(_prefix + ".Serialize") > 0),
-      _serverIdleTime(timeout)
+      _serverIdleTime(timeout),
+      _reactorId(reactorId)
 #if !defined(ICE_USE_IOCP)
       ,
       _nextHandler(_handlers.end())
@@ -226,6 +231,19 @@ IceInternal::ThreadPool::initialize()
         sizeWarn = sizeMax;
     }
 
+    if (_reactorId >= 0)
+    {
+        // Size, SizeMax and SizeWarn are the numbers of threads of all the reactors together: each reactor gets its
+        // share, with at least one thread.
+        int reactors = properties->getPropertyAsIntWithDefault(_prefix + ".Reactors", 1);
+        size = max(size / reactors, 1);
+        sizeMax = max(sizeMax / reactors, size);
+        if (sizeWarn != 0)
+        {
+            sizeWarn = min(max(sizeWarn / reactors, size), sizeMax);
+        }
+    }
+
     int threadIdleTime = properties->getPropertyAsIntWithDefault(_prefix + ".ThreadIdleTime", 60);
     if (threadIdleTime < 0)
     {
@@ -250,8 +268,18 @@ IceInternal::ThreadPool::initialize()
     if (_instance->traceLevels()->threadPool >= 1)
     {
         Trace out(_instance->initializationData().logger, _instance->traceLevels()->threadPoolCat);
-        out << "creating " << _prefix << ": Size = " << _size << ", SizeMax = " << _sizeMax
-            << ", SizeWarn = " << _sizeWarn;
+        out << "creating " << _prefix;
+        if (_reactorId >= 0)
+        {
+            out << " reactor " << _reactorId;
+        }
+        out << ": Size = " << _size << ", SizeMax = " << _sizeMax << ", SizeWarn = " << _sizeWarn;
+#if defined(ICE_USE_IO_URING)
+        if (_selector.ioUring())
+        {
+            out << ", IoUring = 1";
+        }
+#endif
     }
 
     try
@@ -274,6 +302,47 @@ IceInternal::ThreadPool::initialize()
         joinWithAllThreads();
         throw;
     }
+
+    if (_reactorId < 0)
+    {
+        int reactors = properties->getPropertyAsIntWithDefault(_prefix + ".Reactors", 1);
+        if (reactors > 1 && _serverIdleTime > 0)
+        {
+            Warning out(_instance->initializationData().logger);
+            out << _prefix << ".Reactors is not supported with Ice.ServerIdleTime; Reactors adjusted to 1";
+        }
+        else if (reactors > 1)
+        {
+            createReactors(reactors);
+        }
+    }
+}
+
+void
+IceInternal::ThreadPool::createReactors(int reactors)
+{
+    //
+    // Each reactor is a thread pool with its own selector, mutex and threads, configured with the Serialize and
+    // ThreadIdleTime properties of this thread pool and with its share of the Size, SizeMax and SizeWarn threads (see
+    // initialize). Event handlers are pinned to one of the reactors on initialize and their IO and dispatch is
+    // performed by the reactor threads. This thread pool keeps its own Size threads, which only run the work items
+    // submitted with execute() or queued on its work queue.
+    //
+    try
+    {
+        for (int i = 0; i < reactors; ++i)
+        {
+            auto reactor = std::shared_ptr<ThreadPool>(new ThreadPool(_instance, _prefix, 0, i));
+            reactor->initialize();
+            _reactors.push_back(std::move(reactor));
+        }
+    }
+    catch (const Ice::Exception&)
+    {
+        destroy();
+        joinWithAllThreads();
+        throw;
+    }
 }
 
 IceInternal::ThreadPool::~ThreadPool() { assert(_destroyed); }
@@ -288,6 +357,11 @@ IceInternal::ThreadPool::destroy()
     }
     _destroyed = true;
     _workQueue->destroy();
+
+    for (const auto& reactor : _reactors)
+    {
+        reactor->destroy();
+    }
 }
 
 void
@@ -298,11 +372,26 @@ IceInternal::ThreadPool::updateObservers()
     {
         p->updateObserver();
     }
+
+    for (const auto& reactor : _reactors)
+    {
+        reactor->updateObservers();
+    }
 }
 
 void
 IceInternal::ThreadPool::initialize(const EventHandlerPtr& handler)
 {
+    if (!_reactors.empty())
+    {
+        // Pin the handler to the next reactor, the reactor is used for all the subsequent calls for this handler.
+        ThreadPool* reactor = _reactors[_nextReactor.fetch_add(1, memory_order_relaxed) % _reactors.size()].get();
+        assert(!handler->_reactor.load(memory_order_relaxed));
+        handler->_reactor.store(reactor, memory_order_release);
+        reactor->initialize(handler);
+        return;
+    }
+
     lock_guard lock(_mutex);
     assert(!_destroyed);
     _selector.initialize(handler.get());
@@ -328,6 +417,12 @@ IceInternal::ThreadPool::initialize(const EventHandlerPtr& handler)
 void
 IceInternal::ThreadPool::update(const EventHandlerPtr& handler, SocketOperation remove, SocketOperation add)
 {
+    if (!_reactors.empty())
+    {
+        handler->_reactor.load(memory_order_acquire)->update(handler, remove, add);
+        return;
+    }
+
     lock_guard lock(_mutex);
     assert(!_destroyed);
 
@@ -348,6 +443,11 @@ IceInternal::ThreadPool::update(const EventHandlerPtr& handler, SocketOperation
 bool
 IceInternal::ThreadPool::finish(const EventHandlerPtr& handler, bool closeNow)
 {
+    if (!_reactors.empty())
+    {
+        return handler->_reactor.load(memory_order_acquire)->finish(handler, closeNow);
+    }
+
     lock_guard lock(_mutex);
     assert(!_destroyed);
 #if !defined(ICE_USE_IOCP)
@@ -398,6 +498,12 @@ IceInternal::ThreadPool::finish(const EventHandlerPtr& handler, bool closeNow)
 void
 IceInternal::ThreadPool::ready(const EventHandlerPtr& handler, SocketOperation op, bool value)
 {
+    if (!_reactors.empty())
+    {
+        handler->_reactor.load(memory_order_acquire)->ready(handler, op, value);
+        return;
+    }
+
     lock_guard lock(_mutex);
     if (_destroyed)
     {
@@ -470,6 +576,11 @@ IceInternal::ThreadPool::joinWithAllThreads()
     {
         thread->join();
     }
+
+    for (const auto& reactor : _reactors)
+    {
+        reactor->joinWithAllThreads();
+    }
     _selector.destroy();
 }
 
@@ -974,7 +1085,12 @@ string
 IceInternal::ThreadPool::nextThreadId()
 {
     ostringstream os;
-    os << _prefix << "-" << _nextThreadId++;
+    os << _prefix << "-";
+    if (_reactorId >= 0)
+    {
+        os << _reactorId << "-";
+    }
+    os << _nextThreadId++;
     return os.str();
 }
 
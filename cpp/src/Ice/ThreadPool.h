@@ -13,9 +13,11 @@
 #include "Selector.h"
 #include "ThreadPoolF.h"
 
+#include <atomic>
 #include <list>
 #include <set>
 #include <thread>
+#include <vector>
 
 namespace IceInternal
 {
@@ -76,8 +78,9 @@ namespace IceInternal
         [[nodiscard]] std::string prefix() const;
 
     private:
-        ThreadPool(const InstancePtr&, std::string, int);
+        ThreadPool(const InstancePtr&, std::string, int, int = -1);
         void initialize();
+        void createReactors(int);
 
         void run(const EventHandlerThreadPtr&);
 
@@ -117,6 +120,11 @@ namespace IceInternal
         const bool _serialize;  // True if requests need to be serialized over the connection.
         const int _serverIdleTime;
         const int _threadIdleTime{0};
+        const int _reactorId; // The reactor index if this thread pool is a reactor of another thread pool, -1 otherwise.
+
+        // The reactors, each with its own selector and threads. Event handlers are pinned to a reactor on initialize.
+        std::vector<ThreadPoolPtr> _reactors;
+        std::atomic<size_t> _nextReactor{0};
 
         std::set<EventHandlerThreadPtr> _threads; // All threads, running or not.
         int _inUse{0};                            // Number of threads that are currently in use.
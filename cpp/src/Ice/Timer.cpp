@@ -3,6 +3,7 @@
 #include "Ice/Timer.h"
 #include "ConsoleUtil.h"
 #include "Ice/Exception.h"
+#include "TimingWheel.h"
 
 using namespace std;
 using namespace Ice;
@@ -12,6 +13,15 @@ TimerTask::~TimerTask() = default; // Out of line to avoid weak vtable
 
 Timer::Timer() : _wakeUpTime(chrono::steady_clock::time_point()), _worker(&Timer::run, this) {}
 
+Timer::Timer(chrono::nanoseconds wheelTick)
+    : _wheel(wheelTick > chrono::nanoseconds::zero() ? make_unique<TimingWheel>(wheelTick) : nullptr),
+      _wakeUpTime(chrono::steady_clock::time_point()),
+      _worker(&Timer::run, this)
+{
+}
+
+Timer::~Timer() = default; // Out of line, TimingWheel is incomplete in the header.
+
 void
 Timer::destroy()
 {
@@ -28,6 +38,10 @@ Timer::destroy()
         _destroyed = true;
         _tasks.clear();
         _tokens.clear();
+        if (_wheel)
+        {
+            _wheel->clear();
+        }
         _condition.notify_one();
     }
     _worker.join();
@@ -48,7 +62,7 @@ Timer::isScheduled(const TimerTaskPtr& task)
     {
         return false;
     }
-    return _tasks.find(task) != _tasks.end();
+    return _wheel ? _wheel->contains(task) : _tasks.find(task) != _tasks.end();
 }
 
 void
@@ -65,17 +79,24 @@ Timer::run()
                 // If the task we just ran is a repeated task, schedule it again for execution if it wasn't canceled.
                 if (token.delay)
                 {
-                    auto p = _tasks.find(token.task);
-                    if (p != _tasks.end())
+                    token.scheduledTime = chrono::steady_clock::now() + token.delay.value();
+                    if (_wheel)
                     {
-                        token.scheduledTime = chrono::steady_clock::now() + token.delay.value();
-                        p->second = token.scheduledTime;
-                        _tokens.insert(token);
+                        _wheel->rearm(token.task, token.scheduledTime);
+                    }
+                    else
+                    {
+                        auto p = _tasks.find(token.task);
+                        if (p != _tasks.end())
+                        {
+                            p->second = token.scheduledTime;
+                            _tokens.insert(token);
+                        }
                     }
                 }
                 token = {chrono::steady_clock::time_point(), nullopt, nullptr};
 
-                if (_tokens.empty())
+                if (emptyNoSync())
                 {
                     _wakeUpTime = chrono::steady_clock::time_point();
                     _condition.wait(lock);
@@ -87,23 +108,14 @@ Timer::run()
                 break;
             }
 
-            while (!_tokens.empty() && !_destroyed)
+            while (!emptyNoSync() && !_destroyed)
             {
                 const auto now = chrono::steady_clock::now();
-                const Token& first = *(_tokens.begin());
-                if (first.scheduledTime <= now)
+                if (popNoSync(token, now))
                 {
-                    token = first;
-                    _tokens.erase(_tokens.begin());
-                    if (!token.delay)
-                    {
-                        _tasks.erase(token.task);
-                    }
                     break;
                 }
-
-                _wakeUpTime = first.scheduledTime;
-                _condition.wait_for(lock, first.scheduledTime - now);
+                _condition.wait_for(lock, _wakeUpTime - now);
             }
 
             if (_destroyed)
@@ -142,6 +154,68 @@ Timer::run()
     }
 }
 
+void
+Timer::insertNoSync(const TimerTaskPtr& task, chrono::steady_clock::time_point time, optional<chrono::nanoseconds> delay)
+{
+    if (_wheel)
+    {
+        if (!_wheel->insert(task, time, delay))
+        {
+            throw std::invalid_argument("task is already scheduled");
+        }
+    }
+    else
+    {
+        bool inserted = _tasks.insert(make_pair(task, time)).second;
+        if (!inserted)
+        {
+            throw std::invalid_argument("task is already scheduled");
+        }
+        _tokens.insert({time, delay, task});
+    }
+
+    if (_wakeUpTime == chrono::steady_clock::time_point() || time < _wakeUpTime)
+    {
+        _condition.notify_one();
+    }
+}
+
+bool
+Timer::emptyNoSync() const
+{
+    return _wheel ? _wheel->empty() : _tokens.empty();
+}
+
+bool
+Timer::popNoSync(Token& token, chrono::steady_clock::time_point now)
+{
+    if (_wheel)
+    {
+        if (auto expired = _wheel->pop(now))
+        {
+            token = {now, expired->delay, expired->task};
+            return true;
+        }
+        _wakeUpTime = _wheel->nextExpiration();
+        return false;
+    }
+
+    const Token& first = *(_tokens.begin());
+    if (first.scheduledTime <= now)
+    {
+        token = first;
+        _tokens.erase(_tokens.begin());
+        if (!token.delay)
+        {
+            _tasks.erase(token.task);
+        }
+        return true;
+    }
+
+    _wakeUpTime = first.scheduledTime;
+    return false;
+}
+
 bool
 Timer::cancelNoSync(const TimerTaskPtr& task)
 {
@@ -150,6 +224,11 @@ Timer::cancelNoSync(const TimerTaskPtr& task)
         return false;
     }
 
+    if (_wheel)
+    {
+        return _wheel->erase(task);
+    }
+
     auto p = _tasks.find(task);
     if (p == _tasks.end())
     {
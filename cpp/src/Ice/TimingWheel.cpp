@@ -0,0 +1,233 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "TimingWheel.h"
+
+#include <limits>
+
+using namespace std;
+using namespace IceInternal;
+
+TimingWheel::TimingWheel(chrono::nanoseconds tick) : _tick(tick), _start(chrono::steady_clock::now())
+{
+    assert(_tick > chrono::nanoseconds::zero());
+}
+
+bool
+TimingWheel::insert(const TimerTaskPtr& task, chrono::steady_clock::time_point time, optional<chrono::nanoseconds> delay)
+{
+    if (_entries.find(task) != _entries.end())
+    {
+        return false;
+    }
+
+    Slot pending;
+    auto entry = pending.insert(pending.end(), Entry{task, delay, expirationTick(time), &pending});
+    place(pending, entry);
+    _entries.insert(make_pair(task, entry));
+    return true;
+}
+
+bool
+TimingWheel::rearm(const TimerTaskPtr& task, chrono::steady_clock::time_point time)
+{
+    auto p = _entries.find(task);
+    if (p == _entries.end() || p->second->slot != &_running)
+    {
+        // Cancelled, or cancelled and scheduled again while it was running.
+        return false;
+    }
+
+    p->second->expiration = expirationTick(time);
+    place(_running, p->second);
+    return true;
+}
+
+bool
+TimingWheel::erase(const TimerTaskPtr& task)
+{
+    auto p = _entries.find(task);
+    if (p == _entries.end())
+    {
+        return false;
+    }
+
+    p->second->slot->erase(p->second);
+    _entries.erase(p);
+    return true;
+}
+
+bool
+TimingWheel::contains(const TimerTaskPtr& task) const
+{
+    return _entries.find(task) != _entries.end();
+}
+
+bool
+TimingWheel::empty() const
+{
+    return _entries.size() == _running.size();
+}
+
+optional<TimingWheel::Expired>
+TimingWheel::pop(chrono::steady_clock::time_point now)
+{
+    if (_expired.empty())
+    {
+        // Round down, only the ticks which are entirely elapsed are processed.
+        auto elapsed = chrono::duration_cast<chrono::nanoseconds>(now - _start).count();
+        if (elapsed > 0)
+        {
+            advance(static_cast<uint64_t>(elapsed / _tick.count()));
+        }
+
+        if (_expired.empty())
+        {
+            return nullopt;
+        }
+    }
+
+    auto entry = _expired.begin();
+    Expired expired{entry->task, entry->delay};
+    if (entry->delay)
+    {
+        _running.splice(_running.end(), _expired, entry);
+        entry->slot = &_running;
+    }
+    else
+    {
+        _entries.erase(entry->task);
+        _expired.erase(entry);
+    }
+    return expired;
+}
+
+chrono::steady_clock::time_point
+TimingWheel::nextExpiration() const
+{
+    assert(!empty());
+    if (!_expired.empty())
+    {
+        return _start;
+    }
+
+    uint64_t tick = nextEventTick();
+    assert(tick != numeric_limits<uint64_t>::max());
+    return _start + _tick * static_cast<int64_t>(tick);
+}
+
+void
+TimingWheel::clear()
+{
+    for (auto& wheel : _wheels)
+    {
+        for (auto& slot : wheel)
+        {
+            slot.clear();
+        }
+    }
+    _expired.clear();
+    _running.clear();
+    _entries.clear();
+}
+
+uint64_t
+TimingWheel::expirationTick(chrono::steady_clock::time_point time) const
+{
+    // Round up, the task must not run before the requested time.
+    auto elapsed = chrono::duration_cast<chrono::nanoseconds>(time - _start).count();
+    return elapsed <= 0 ? 0 : static_cast<uint64_t>((elapsed - 1) / _tick.count() + 1);
+}
+
+void
+TimingWheel::place(Slot& from, Slot::iterator entry)
+{
+    Slot* to = &_expired;
+    if (entry->expiration > _current)
+    {
+        uint64_t remaining = entry->expiration - _current;
+        int level = 0;
+        while (level < levels - 1 && remaining >= (uint64_t{1} << (bits * (level + 1))))
+        {
+            ++level;
+        }
+
+        uint64_t expiration = entry->expiration;
+        if (remaining >= (uint64_t{1} << (bits * levels)))
+        {
+            // Beyond the range of the wheels: park the entry in the last slot visited by the upper wheel, it's placed
+            // again with its real expiration when this slot cascades.
+            expiration = _current + (uint64_t{1} << (bits * levels)) - 1;
+        }
+        to = &_wheels[static_cast<size_t>(level)][(expiration >> (bits * level)) & mask];
+    }
+
+    to->splice(to->end(), from, entry);
+    entry->slot = to;
+}
+
+void
+TimingWheel::cascade(Slot& slot)
+{
+    while (!slot.empty())
+    {
+        place(slot, slot.begin());
+    }
+}
+
+void
+TimingWheel::advance(uint64_t tick)
+{
+    while (_current < tick)
+    {
+        // Jump directly to the next tick at which a slot must be processed, there's nothing to do for the ticks in
+        // between.
+        uint64_t next = nextEventTick();
+        if (next > tick)
+        {
+            _current = tick;
+            break;
+        }
+        _current = next;
+
+        // Cascade the upper wheels first, their entries may end up in the current slot of a lower wheel.
+        for (int level = levels - 1; level > 0; --level)
+        {
+            if ((_current & ((uint64_t{1} << (bits * level)) - 1)) == 0)
+            {
+                cascade(_wheels[static_cast<size_t>(level)][(_current >> (bits * level)) & mask]);
+            }
+        }
+        cascade(_wheels[0][_current & mask]);
+    }
+}
+
+uint64_t
+TimingWheel::nextEventTick() const
+{
+    uint64_t next = numeric_limits<uint64_t>::max();
+
+    // The entries of the lower wheel expire within the next revolution.
+    for (uint64_t tick = _current + 1; tick < _current + slots; ++tick)
+    {
+        if (!_wheels[0][tick & mask].empty())
+        {
+            next = tick;
+            break;
+        }
+    }
+
+    // The slots of the upper wheels are processed when the lower wheel completes a revolution.
+    for (int level = 1; level < levels; ++level)
+    {
+        const uint64_t span = uint64_t{1} << (bits * level);
+        for (uint64_t tick = (_current / span + 1) * span, i = 0; i < slots && tick < next; tick += span, ++i)
+        {
+            if (!_wheels[static_cast<size_t>(level)][(tick >> (bits * level)) & mask].empty())
+            {
+                next = tick;
+                break;
+            }
+        }
+    }
+    return next;
+}
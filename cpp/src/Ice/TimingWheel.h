@@ -0,0 +1,85 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_TIMING_WHEEL_H
+#define ICE_TIMING_WHEEL_H
+
+#include "Ice/Timer.h"
+
+#include <array>
+#include <list>
+#include <unordered_map>
+
+namespace IceInternal
+{
+    // A hierarchical timing wheel (Varghese and Lauck) storing the tasks of a Timer. Time is divided in ticks and the
+    // tasks are hashed on their expiration tick into the 256 slots of 4 wheels: the slots of the wheel of level n span
+    // 256^n ticks. Inserting or cancelling a task is O(1). When the lower wheel completes a revolution, the tasks of
+    // the next slot of the upper wheel cascade down. Tasks never expire early: the expiration is rounded up to the next
+    // tick. The wheel is not thread-safe, the Timer calls it with its mutex locked.
+    class TimingWheel final
+    {
+    public:
+        struct Expired
+        {
+            TimerTaskPtr task;
+            std::optional<std::chrono::nanoseconds> delay;
+        };
+
+        TimingWheel(std::chrono::nanoseconds tick);
+
+        // Inserts a task, returns false if the task is already scheduled (or is a running repeated task).
+        bool insert(const TimerTaskPtr&, std::chrono::steady_clock::time_point, std::optional<std::chrono::nanoseconds>);
+
+        // Inserts again a repeated task returned by pop, returns false if the task was cancelled in the meantime.
+        bool rearm(const TimerTaskPtr&, std::chrono::steady_clock::time_point);
+
+        bool erase(const TimerTaskPtr&);
+        [[nodiscard]] bool contains(const TimerTaskPtr&) const;
+
+        // Returns true if no task is waiting for its expiration. Running repeated tasks are not waiting.
+        [[nodiscard]] bool empty() const;
+
+        // Advances the wheel to the given time and returns the next expired task, if any. Repeated tasks stay
+        // scheduled until rearm or erase is called.
+        std::optional<Expired> pop(std::chrono::steady_clock::time_point);
+
+        // Returns the time at which pop must be called next. It is either an expiration or the time at which the
+        // tasks of an upper wheel cascade down. The wheel must not be empty.
+        [[nodiscard]] std::chrono::steady_clock::time_point nextExpiration() const;
+
+        void clear();
+
+    private:
+        static constexpr int levels = 4;
+        static constexpr int bits = 8;
+        static constexpr std::uint64_t slots = 1 << bits;
+        static constexpr std::uint64_t mask = slots - 1;
+
+        struct Entry;
+        using Slot = std::list<Entry>;
+
+        struct Entry
+        {
+            TimerTaskPtr task;
+            std::optional<std::chrono::nanoseconds> delay;
+            std::uint64_t expiration;
+            Slot* slot;
+        };
+
+        [[nodiscard]] std::uint64_t expirationTick(std::chrono::steady_clock::time_point) const;
+        void place(Slot&, Slot::iterator);
+        void cascade(Slot&);
+        void advance(std::uint64_t);
+        [[nodiscard]] std::uint64_t nextEventTick() const;
+
+        const std::chrono::nanoseconds _tick;
+        const std::chrono::steady_clock::time_point _start;
+        std::uint64_t _current{0};
+        std::array<std::array<Slot, slots>, levels> _wheels;
+        Slot _expired;
+        Slot _running;
+        std::unordered_map<TimerTaskPtr, Slot::iterator> _entries;
+    };
+}
+
+#endif
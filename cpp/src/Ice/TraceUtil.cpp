@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "TraceUtil.h"
+#include "Compressor.h"
 #include "ConnectionI.h"
 #include "EndpointI.h"
 #include "Ice/InputStream.h"
@@ -172,9 +173,42 @@ printHeader(ostream& s, InputStream& stream)
             break;
         }
 
+        case 3:
+        {
+            s << "(compressed with lz4; compress response, if any)";
+            break;
+        }
+
+        case 4:
+        {
+            s << "(compressed with zstd; compress response, if any)";
+            break;
+        }
+
+        case 5:
+        {
+            s << "(compressed with zstd-stream; compress response, if any)";
+            break;
+        }
+
         default:
         {
-            s << "(unknown)";
+            if (type == validateConnectionMsg && (compress & codecAdvertisement))
+            {
+                s << "(supported codecs:";
+                for (uint8_t codec = bzip2Codec; codec < bzip2Codec + codecCount; ++codec)
+                {
+                    if (compress & codecBit(codec))
+                    {
+                        s << ' ' << codecName(codec);
+                    }
+                }
+                s << ")";
+            }
+            else
+            {
+                s << "(unknown)";
+            }
             break;
         }
     }
@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "Transceiver.h"
+#include "Ice/Buffer.h"
 
 using namespace std;
 using namespace Ice;
@@ -12,3 +13,43 @@ IceInternal::Transceiver::bind()
     assert(false);
     return nullptr;
 }
+
+void
+IceInternal::Transceiver::setReadAheadSize(size_t)
+{
+}
+
+bool
+IceInternal::Transceiver::setZeroCopyThreshold(size_t)
+{
+    return false;
+}
+
+uint32_t
+IceInternal::Transceiver::zeroCopySent() const
+{
+    return 0;
+}
+
+uint32_t
+IceInternal::Transceiver::zeroCopyCompleted() const
+{
+    return 0;
+}
+
+SocketOperation
+IceInternal::Transceiver::writev(const vector<Buffer*>& buffers)
+{
+    for (Buffer* buf : buffers)
+    {
+        if (buf->i != buf->b.end())
+        {
+            SocketOperation op = write(*buf);
+            if (op != SocketOperationNone)
+            {
+                return op;
+            }
+        }
+    }
+    return SocketOperationNone;
+}
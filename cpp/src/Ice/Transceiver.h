@@ -8,6 +8,9 @@
 #include "Network.h"
 #include "TransceiverF.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace IceInternal
 {
     class Buffer;
@@ -25,6 +28,14 @@ namespace IceInternal
         virtual SocketOperation write(Buffer&) = 0;
         virtual SocketOperation read(Buffer&) = 0;
 
+        /// Writes several buffers, in order, with as few system calls as the transport allows. The iterator of each
+        /// buffer is advanced by the number of bytes written from it. The default implementation calls write for each
+        /// buffer until one of them can't be fully written.
+        /// @param buffers The buffers to write.
+        /// @return SocketOperationNone if all the buffers were fully written, otherwise the socket operation to wait
+        /// for before writing the remainder.
+        virtual SocketOperation writev(const std::vector<Buffer*>& buffers);
+
 #if defined(ICE_USE_IOCP)
         virtual bool startWrite(Buffer&) = 0;
         virtual void finishWrite(Buffer&) = 0;
@@ -46,6 +57,29 @@ namespace IceInternal
 
         virtual void checkSendSize(const Buffer&) = 0;
         virtual void setBufferSize(int, int) = 0;
+
+        /// Enables buffering of the bytes received beyond what read() is asked for, so that several small messages
+        /// can be received with a single system call. This is only called on the transceiver used directly by the
+        /// connection, never on the delegate of another transceiver. The default implementation does nothing.
+        /// @param size The size of the read-ahead buffer in bytes.
+        virtual void setReadAheadSize(size_t size);
+
+        /// Enables zero-copy sends for writes of at least the given size. The kernel sends the data directly from the
+        /// caller's buffer, which must not be modified or released until zeroCopyCompleted() reaches the value
+        /// returned by zeroCopySent() once the data is written. Like setReadAheadSize, this is only called on the
+        /// transceiver used directly by the connection. The default implementation does nothing.
+        /// @param threshold The minimum number of bytes to write for a write to use zero-copy.
+        /// @return true if zero-copy sends are enabled, false if not supported by the transport or the platform.
+        virtual bool setZeroCopyThreshold(size_t threshold);
+
+        /// Returns the number of zero-copy sends performed so far.
+        /// @return The zero-copy send count, it wraps around once it reaches the maximum value.
+        virtual std::uint32_t zeroCopySent() const;
+
+        /// Returns the number of zero-copy sends for which the kernel released the buffer. The buffers of all the
+        /// sends up to this count can be reused.
+        /// @return The zero-copy completion count, it wraps around once it reaches the maximum value.
+        virtual std::uint32_t zeroCopyCompleted() const;
     };
 }
 
@@ -1,7 +1,9 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "UdpConnector.h"
+#include "HashUtil.h"
 #include "Ice/LocalExceptions.h"
+#include "Network.h"
 #include "ProtocolInstance.h"
 #include "UdpEndpointI.h"
 #include "UdpTransceiver.h"
@@ -28,6 +30,18 @@ IceInternal::UdpConnector::toString() const
     return addrToString(_addr);
 }
 
+size_t
+IceInternal::UdpConnector::hash() const noexcept
+{
+    size_t h = 5381;
+    hashAdd(h, hashAddress(_addr));
+    hashAdd(h, _connectionId);
+    hashAdd(h, _mcastTtl);
+    hashAdd(h, _mcastInterface);
+    hashAdd(h, hashAddress(_sourceAddr));
+    return h;
+}
+
 bool
 IceInternal::UdpConnector::operator==(const Connector& r) const
 {
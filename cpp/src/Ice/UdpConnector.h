@@ -23,6 +23,7 @@ namespace IceInternal
 
         bool operator==(const Connector&) const final;
         bool operator<(const Connector&) const final;
+        [[nodiscard]] std::size_t hash() const noexcept final;
 
     private:
         const ProtocolInstancePtr _instance;
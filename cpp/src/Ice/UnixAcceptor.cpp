@@ -0,0 +1,147 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Config.h"
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#    include "UnixAcceptor.h"
+#    include "Ice/LocalExceptions.h"
+#    include "Ice/Properties.h"
+#    include "ProtocolInstance.h"
+#    include "StreamSocket.h"
+#    include "UnixEndpointI.h"
+#    include "UnixTransceiver.h"
+
+#    include <sys/stat.h>
+#    include <utility>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+    // A socket file outlives the server that created it if the server didn't close its object adapter, for example
+    // if it crashed. Such a stale socket file prevents binding the path again: remove it if no server accepts
+    // connections on it anymore. A socket file that a server still listens on is kept, so the bind fails.
+    void removeStaleSocketFile(const string& path, const Address& addr)
+    {
+        struct stat st;
+        if (lstat(path.c_str(), &st) != 0 || !S_ISSOCK(st.st_mode))
+        {
+            return;
+        }
+
+        SOCKET fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd == INVALID_SOCKET)
+        {
+            return;
+        }
+        // Non-blocking, so the probe doesn't wait if the backlog of a live server is full.
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        int rc;
+        do
+        {
+            rc = ::connect(fd, &addr.sa, static_cast<socklen_t>(sizeof(sockaddr_un)));
+        } while (rc == SOCKET_ERROR && interrupted());
+        bool stale = rc == SOCKET_ERROR && connectionRefused();
+        closeSocketNoThrow(fd);
+
+        if (stale)
+        {
+            unlink(path.c_str());
+        }
+    }
+}
+
+NativeInfoPtr
+IceInternal::UnixAcceptor::getNativeInfo()
+{
+    return shared_from_this();
+}
+
+void
+IceInternal::UnixAcceptor::close()
+{
+    if (_fd != INVALID_SOCKET)
+    {
+        closeSocketNoThrow(_fd);
+        _fd = INVALID_SOCKET;
+    }
+
+    if (_bound)
+    {
+        unlink(_path.c_str());
+        _bound = false;
+    }
+}
+
+EndpointIPtr
+IceInternal::UnixAcceptor::listen()
+{
+    try
+    {
+        removeStaleSocketFile(_path, _addr);
+        doBind(_fd, _addr);
+        _bound = true;
+        doListen(_fd, _backlog);
+    }
+    catch (...)
+    {
+        _fd = INVALID_SOCKET;
+        if (_bound)
+        {
+            unlink(_path.c_str());
+            _bound = false;
+        }
+        throw;
+    }
+    return _endpoint;
+}
+
+TransceiverPtr
+IceInternal::UnixAcceptor::accept()
+{
+    return make_shared<UnixTransceiver>(_instance, make_shared<StreamSocket>(_instance, doAccept(_fd)), _path);
+}
+
+string
+IceInternal::UnixAcceptor::protocol() const
+{
+    return _instance->protocol();
+}
+
+string
+IceInternal::UnixAcceptor::toString() const
+{
+    return _path;
+}
+
+string
+IceInternal::UnixAcceptor::toDetailedString() const
+{
+    ostringstream os;
+    os << "local address = " << toString();
+    return os.str();
+}
+
+IceInternal::UnixAcceptor::UnixAcceptor(
+    UnixEndpointIPtr endpoint,
+    const ProtocolInstancePtr& instance,
+    const string& path)
+    : _endpoint(std::move(endpoint)),
+      _instance(instance),
+      _path(path),
+      _addr(getUnixAddress(path)),
+      _bound(false)
+{
+    // The Unix domain sockets share the backlog and buffer size configuration of the TCP sockets.
+    _backlog = instance->properties()->getIcePropertyAsInt("Ice.TCP.Backlog");
+    _fd = createSocket(false, _addr);
+    setBlock(_fd, false);
+    setTcpBufSize(_fd, _instance);
+}
+
+IceInternal::UnixAcceptor::~UnixAcceptor() { assert(_fd == INVALID_SOCKET); }
+
+#endif
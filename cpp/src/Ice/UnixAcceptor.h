@@ -0,0 +1,38 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_UNIX_ACCEPTOR_H
+#define ICE_UNIX_ACCEPTOR_H
+
+#include "Acceptor.h"
+#include "Network.h"
+#include "ProtocolInstanceF.h"
+#include "TransceiverF.h"
+
+namespace IceInternal
+{
+    class UnixAcceptor final : public Acceptor, public NativeInfo, public std::enable_shared_from_this<UnixAcceptor>
+    {
+    public:
+        UnixAcceptor(UnixEndpointIPtr, const ProtocolInstancePtr&, const std::string&);
+        ~UnixAcceptor() override;
+        NativeInfoPtr getNativeInfo() final;
+
+        void close() final;
+        EndpointIPtr listen() final;
+
+        TransceiverPtr accept() final;
+        [[nodiscard]] std::string protocol() const final;
+        [[nodiscard]] std::string toString() const final;
+        [[nodiscard]] std::string toDetailedString() const final;
+
+    private:
+        const UnixEndpointIPtr _endpoint;
+        const ProtocolInstancePtr _instance;
+        const std::string _path;
+        const Address _addr;
+
+        int _backlog;
+        bool _bound; // Whether or not this acceptor created the socket file, which it removes when closed.
+    };
+}
+#endif
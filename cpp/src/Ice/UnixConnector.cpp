@@ -0,0 +1,122 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Config.h"
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#    include "UnixConnector.h"
+#    include "HashUtil.h"
+#    include "Network.h"
+#    include "ProtocolInstance.h"
+#    include "StreamSocket.h"
+#    include "UnixTransceiver.h"
+
+#    include <utility>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+TransceiverPtr
+IceInternal::UnixConnector::connect()
+{
+    // Unix domain sockets don't support network proxies or source addresses. The connection is established
+    // synchronously, or fails, when the stream socket is created.
+    return make_shared<UnixTransceiver>(
+        _instance,
+        make_shared<StreamSocket>(_instance, nullptr, getUnixAddress(_path), Address{}),
+        _path);
+}
+
+int16_t
+IceInternal::UnixConnector::type() const
+{
+    return _instance->type();
+}
+
+string
+IceInternal::UnixConnector::toString() const
+{
+    return _path;
+}
+
+size_t
+IceInternal::UnixConnector::hash() const noexcept
+{
+    size_t h = 5381;
+    hashAdd(h, _path);
+    hashAdd(h, _timeout);
+    hashAdd(h, _connectionId);
+    return h;
+}
+
+bool
+IceInternal::UnixConnector::operator==(const Connector& r) const
+{
+    const auto* p = dynamic_cast<const UnixConnector*>(&r);
+    if (!p)
+    {
+        return false;
+    }
+
+    if (_path != p->_path)
+    {
+        return false;
+    }
+
+    if (_timeout != p->_timeout)
+    {
+        return false;
+    }
+
+    if (_connectionId != p->_connectionId)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool
+IceInternal::UnixConnector::operator<(const Connector& r) const
+{
+    const auto* p = dynamic_cast<const UnixConnector*>(&r);
+    if (!p)
+    {
+        return type() < r.type();
+    }
+
+    if (_timeout < p->_timeout)
+    {
+        return true;
+    }
+    else if (p->_timeout < _timeout)
+    {
+        return false;
+    }
+
+    if (_connectionId < p->_connectionId)
+    {
+        return true;
+    }
+    else if (p->_connectionId < _connectionId)
+    {
+        return false;
+    }
+    return _path < p->_path;
+}
+
+IceInternal::UnixConnector::UnixConnector(
+    ProtocolInstancePtr instance,
+    string path,
+    int32_t timeout,
+    string connectionId)
+    : _instance(std::move(instance)),
+      _path(std::move(path)),
+      _timeout(timeout),
+      _connectionId(std::move(connectionId))
+{
+}
+
+IceInternal::UnixConnector::~UnixConnector() = default;
+#endif
@@ -0,0 +1,35 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_UNIX_CONNECTOR_H
+#define ICE_UNIX_CONNECTOR_H
+
+#include "Connector.h"
+#include "Network.h"
+#include "ProtocolInstanceF.h"
+#include "TransceiverF.h"
+
+namespace IceInternal
+{
+    class UnixConnector final : public Connector
+    {
+    public:
+        UnixConnector(ProtocolInstancePtr, std::string, std::int32_t, std::string);
+        ~UnixConnector() override;
+        TransceiverPtr connect() final;
+
+        [[nodiscard]] std::int16_t type() const final;
+        [[nodiscard]] std::string toString() const final;
+
+        bool operator==(const Connector&) const final;
+        bool operator<(const Connector&) const final;
+        [[nodiscard]] std::size_t hash() const noexcept final;
+
+    private:
+        const ProtocolInstancePtr _instance;
+        const std::string _path;
+        const std::int32_t _timeout;
+        const std::string _connectionId;
+    };
+}
+
+#endif
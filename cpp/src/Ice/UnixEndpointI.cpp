@@ -0,0 +1,588 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Config.h"
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#    include "UnixEndpointI.h"
+#    include "Compressor.h"
+#    include "EndpointFactoryManager.h"
+#    include "HashUtil.h"
+#    include "Ice/Initialize.h"
+#    include "Ice/InputStream.h"
+#    include "Ice/LocalExceptions.h"
+#    include "Ice/OutputStream.h"
+#    include "Instance.h"
+#    include "Network.h"
+#    include "ProtocolInstance.h"
+#    include "ShmEndpoint.h"
+#    include "UnixAcceptor.h"
+#    include "UnixConnector.h"
+
+#    include <utility>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+    class UnixEndpointFactoryPlugin : public Plugin
+    {
+    public:
+        UnixEndpointFactoryPlugin(const CommunicatorPtr&);
+        void initialize() override;
+        void destroy() override;
+    };
+}
+
+extern "C"
+{
+    Plugin* createIceUnix(const CommunicatorPtr& c, const string&, const StringSeq&)
+    {
+        return new UnixEndpointFactoryPlugin(c);
+    }
+}
+
+namespace Ice
+{
+    ICE_API void registerIceUnix(bool loadOnInitialize)
+    {
+        Ice::registerPluginFactory("IceUnix", createIceUnix, loadOnInitialize);
+    }
+}
+
+UnixEndpointFactoryPlugin::UnixEndpointFactoryPlugin(const CommunicatorPtr& communicator)
+{
+    assert(communicator);
+
+    const EndpointFactoryManagerPtr efm = getInstance(communicator)->endpointFactoryManager();
+    efm->add(
+        make_shared<UnixEndpointFactory>(make_shared<ProtocolInstance>(communicator, UnixEndpointType, "unix", false)));
+
+    // The shm endpoints are Unix endpoints whose connections exchange the messages through shared memory.
+    efm->add(make_shared<ShmEndpointFactory>(
+        make_shared<ProtocolInstance>(communicator, ShmEndpointType, "shm", false),
+        UnixEndpointType));
+}
+
+void
+UnixEndpointFactoryPlugin::initialize()
+{
+}
+
+void
+UnixEndpointFactoryPlugin::destroy()
+{
+}
+
+namespace
+{
+    // The path, including its terminating null character, must fit in sockaddr_un::sun_path.
+    bool isValidPath(const string& path) { return !path.empty() && path.size() < sizeof(sockaddr_un::sun_path); }
+}
+
+IceInternal::UnixEndpointI::UnixEndpointI(
+    ProtocolInstancePtr instance,
+    string path,
+    int32_t timeout,
+    string connectionId,
+    bool compress,
+    uint8_t compressionCodec)
+    : _instance(std::move(instance)),
+      _path(std::move(path)),
+      _timeout(timeout),
+      _connectionId(std::move(connectionId)),
+      _compress(compress),
+      _compressionCodec(compressionCodec)
+{
+}
+
+IceInternal::UnixEndpointI::UnixEndpointI(ProtocolInstancePtr instance)
+    : _instance(std::move(instance)),
+      // Same default as TCP endpoints. This timeout is not used in Ice 3.8 and greater.
+      _timeout(60000),
+      _compress(false),
+      _compressionCodec(0)
+{
+}
+
+IceInternal::UnixEndpointI::UnixEndpointI(ProtocolInstancePtr instance, InputStream* s)
+    : _instance(std::move(instance)),
+      _timeout(-1),
+      _compress(false),
+      _compressionCodec(0)
+{
+    s->read(const_cast<string&>(_path), false);
+    s->read(const_cast<int32_t&>(_timeout));
+    s->read(const_cast<bool&>(_compress));
+}
+
+void
+IceInternal::UnixEndpointI::streamWriteImpl(OutputStream* s) const
+{
+    s->write(_path, false);
+    s->write(_timeout);
+    s->write(_compress);
+}
+
+EndpointInfoPtr
+IceInternal::UnixEndpointI::getInfo() const noexcept
+{
+    return make_shared<UnixEndpointInfo>(_timeout, _compress, _path, type());
+}
+
+int16_t
+IceInternal::UnixEndpointI::type() const
+{
+    return _instance->type();
+}
+
+const string&
+IceInternal::UnixEndpointI::protocol() const
+{
+    return _instance->protocol();
+}
+
+int32_t
+IceInternal::UnixEndpointI::timeout() const
+{
+    return _timeout;
+}
+
+EndpointIPtr
+IceInternal::UnixEndpointI::timeout(int32_t timeout) const
+{
+    if (timeout == _timeout)
+    {
+        return const_cast<UnixEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<UnixEndpointI>(_instance, _path, timeout, _connectionId, _compress, _compressionCodec);
+    }
+}
+
+const string&
+IceInternal::UnixEndpointI::connectionId() const
+{
+    return _connectionId;
+}
+
+EndpointIPtr
+IceInternal::UnixEndpointI::connectionId(const string& connectionId) const
+{
+    if (connectionId == _connectionId)
+    {
+        return const_cast<UnixEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<UnixEndpointI>(_instance, _path, _timeout, connectionId, _compress, _compressionCodec);
+    }
+}
+
+bool
+IceInternal::UnixEndpointI::compress() const
+{
+    return _compress;
+}
+
+EndpointIPtr
+IceInternal::UnixEndpointI::compress(bool compress) const
+{
+    if (compress == _compress)
+    {
+        return const_cast<UnixEndpointI*>(this)->shared_from_this();
+    }
+    else
+    {
+        return make_shared<UnixEndpointI>(_instance, _path, _timeout, _connectionId, compress, _compressionCodec);
+    }
+}
+
+uint8_t
+IceInternal::UnixEndpointI::compressionCodec() const
+{
+    return _compressionCodec;
+}
+
+bool
+IceInternal::UnixEndpointI::datagram() const
+{
+    return false;
+}
+
+bool
+IceInternal::UnixEndpointI::secure() const
+{
+    return _instance->secure();
+}
+
+TransceiverPtr
+IceInternal::UnixEndpointI::transceiver() const
+{
+    return nullptr;
+}
+
+void
+IceInternal::UnixEndpointI::connectorsAsync(
+    EndpointSelectionType,
+    function<void(vector<ConnectorPtr>)> response,
+    function<void(exception_ptr)> exception) const
+{
+    // The path of an endpoint unmarshaled from a peer isn't checked when the endpoint is read.
+    if (!isValidPath(_path))
+    {
+        exception(make_exception_ptr(ConnectFailedException(__FILE__, __LINE__, ENAMETOOLONG)));
+        return;
+    }
+
+    vector<ConnectorPtr> connectors;
+    connectors.emplace_back(make_shared<UnixConnector>(_instance, _path, _timeout, _connectionId));
+    response(std::move(connectors));
+}
+
+AcceptorPtr
+IceInternal::UnixEndpointI::acceptor(const string&, const optional<Ice::SSL::ServerAuthenticationOptions>&) const
+{
+    return make_shared<UnixAcceptor>(
+        dynamic_pointer_cast<UnixEndpointI>(const_cast<UnixEndpointI*>(this)->shared_from_this()),
+        _instance,
+        _path);
+}
+
+vector<EndpointIPtr>
+IceInternal::UnixEndpointI::expandHost() const
+{
+    return {const_cast<UnixEndpointI*>(this)->shared_from_this()};
+}
+
+bool
+IceInternal::UnixEndpointI::isLoopbackOrMulticast() const
+{
+    return false;
+}
+
+shared_ptr<EndpointI>
+IceInternal::UnixEndpointI::toPublishedEndpoint(string) const
+{
+    // The published host doesn't apply to Unix endpoints.
+    return const_cast<UnixEndpointI*>(this)->shared_from_this();
+}
+
+bool
+IceInternal::UnixEndpointI::equivalent(const EndpointIPtr& endpoint) const
+{
+    auto unixEndpointI = dynamic_pointer_cast<UnixEndpointI>(endpoint);
+    if (!unixEndpointI)
+    {
+        return false;
+    }
+    return unixEndpointI->type() == type() && unixEndpointI->_path == _path;
+}
+
+string
+IceInternal::UnixEndpointI::options() const
+{
+    //
+    // WARNING: Certain features, such as proxy validation in Glacier2,
+    // depend on the format of proxy strings. Changes to toString() and
+    // methods called to generate parts of the reference string could break
+    // these features. Please review for all features that depend on the
+    // format of proxyToString() before changing this and related code.
+    //
+    ostringstream s;
+
+    if (!_path.empty())
+    {
+        s << " -p ";
+        bool addQuote = _path.find_first_of(": \t\n\r") != string::npos;
+        if (addQuote)
+        {
+            s << "\"";
+        }
+        s << _path;
+        if (addQuote)
+        {
+            s << "\"";
+        }
+    }
+
+    if (_timeout == -1)
+    {
+        s << " -t infinite";
+    }
+    else
+    {
+        s << " -t " << to_string(_timeout);
+    }
+
+    if (_compress)
+    {
+        s << " -z";
+    }
+
+    if (_compressionCodec)
+    {
+        s << " --codec " << codecName(_compressionCodec);
+    }
+
+    return s.str();
+}
+
+bool
+IceInternal::UnixEndpointI::operator==(const Endpoint& r) const
+{
+    const auto* p = dynamic_cast<const UnixEndpointI*>(&r);
+    if (!p)
+    {
+        return false;
+    }
+
+    if (this == p)
+    {
+        return true;
+    }
+
+    if (_path != p->_path)
+    {
+        return false;
+    }
+
+    if (_timeout != p->_timeout)
+    {
+        return false;
+    }
+
+    if (_connectionId != p->_connectionId)
+    {
+        return false;
+    }
+
+    if (_compress != p->_compress)
+    {
+        return false;
+    }
+
+    if (_compressionCodec != p->_compressionCodec)
+    {
+        return false;
+    }
+    return true;
+}
+
+bool
+IceInternal::UnixEndpointI::operator<(const Endpoint& r) const
+{
+    const auto* p = dynamic_cast<const UnixEndpointI*>(&r);
+    if (!p)
+    {
+        const auto* e = dynamic_cast<const EndpointI*>(&r);
+        if (!e)
+        {
+            return false;
+        }
+        return type() < e->type();
+    }
+
+    if (this == p)
+    {
+        return false;
+    }
+
+    if (_path < p->_path)
+    {
+        return true;
+    }
+    else if (p->_path < _path)
+    {
+        return false;
+    }
+
+    if (_timeout < p->_timeout)
+    {
+        return true;
+    }
+    else if (p->_timeout < _timeout)
+    {
+        return false;
+    }
+
+    if (_connectionId < p->_connectionId)
+    {
+        return true;
+    }
+    else if (p->_connectionId < _connectionId)
+    {
+        return false;
+    }
+
+    if (!_compress && p->_compress)
+    {
+        return true;
+    }
+    else if (p->_compress < _compress)
+    {
+        return false;
+    }
+
+    return _compressionCodec < p->_compressionCodec;
+}
+
+size_t
+IceInternal::UnixEndpointI::hash() const noexcept
+{
+    size_t h = 5381;
+    hashAdd(h, type());
+    hashAdd(h, _path);
+    hashAdd(h, _connectionId);
+    hashAdd(h, _timeout);
+    hashAdd(h, _compress);
+    hashAdd(h, _compressionCodec);
+    return h;
+}
+
+void
+IceInternal::UnixEndpointI::initWithOptions(vector<string>& args)
+{
+    EndpointI::initWithOptions(args);
+
+    if (_path.empty())
+    {
+        throw ParseException(__FILE__, __LINE__, "a path must be specified using the -p option");
+    }
+    else if (!isValidPath(_path))
+    {
+        throw ParseException(
+            __FILE__,
+            __LINE__,
+            "the path '" + _path + "' is too long for a Unix domain socket in endpoint '" + toString() + "'");
+    }
+}
+
+bool
+IceInternal::UnixEndpointI::checkOption(const string& option, const string& argument, const string& endpoint)
+{
+    if (option == "--codec")
+    {
+        if (argument.empty())
+        {
+            throw ParseException(
+                __FILE__,
+                __LINE__,
+                "no argument provided for --codec option in endpoint '" + endpoint + "'");
+        }
+
+        const_cast<uint8_t&>(_compressionCodec) = codecFromName(argument);
+        if (!_compressionCodec)
+        {
+            throw ParseException(
+                __FILE__,
+                __LINE__,
+                "invalid compression codec '" + argument + "' in endpoint '" + endpoint + "'");
+        }
+        return true;
+    }
+
+    switch (option[1])
+    {
+        case 'p':
+        {
+            if (argument.empty())
+            {
+                throw ParseException(
+                    __FILE__,
+                    __LINE__,
+                    "no argument provided for -p option in endpoint '" + endpoint + "'");
+            }
+            const_cast<string&>(_path) = argument;
+            return true;
+        }
+
+        case 't':
+        {
+            if (argument.empty())
+            {
+                throw ParseException(
+                    __FILE__,
+                    __LINE__,
+                    "no argument provided for -t option in endpoint '" + endpoint + "'");
+            }
+
+            if (argument == "infinite")
+            {
+                const_cast<int32_t&>(_timeout) = -1;
+            }
+            else
+            {
+                istringstream t(argument);
+                if (!(t >> const_cast<int32_t&>(_timeout)) || !t.eof() || _timeout < 1)
+                {
+                    throw ParseException(
+                        __FILE__,
+                        __LINE__,
+                        "invalid timeout value '" + argument + "' in endpoint '" + endpoint + "'");
+                }
+            }
+            return true;
+        }
+
+        case 'z':
+        {
+            if (!argument.empty())
+            {
+                throw ParseException(
+                    __FILE__,
+                    __LINE__,
+                    "unexpected argument '" + argument + "' provided for -z option in endpoint '" + endpoint + "'");
+            }
+            const_cast<bool&>(_compress) = true;
+            return true;
+        }
+
+        default:
+        {
+            return false;
+        }
+    }
+}
+
+IceInternal::UnixEndpointFactory::UnixEndpointFactory(ProtocolInstancePtr instance) : _instance(std::move(instance))
+{
+}
+
+IceInternal::UnixEndpointFactory::~UnixEndpointFactory() = default;
+
+int16_t
+IceInternal::UnixEndpointFactory::type() const
+{
+    return _instance->type();
+}
+
+string
+IceInternal::UnixEndpointFactory::protocol() const
+{
+    return _instance->protocol();
+}
+
+EndpointIPtr
+IceInternal::UnixEndpointFactory::create(vector<string>& args, bool) const
+{
+    auto endpt = make_shared<UnixEndpointI>(_instance);
+    endpt->initWithOptions(args);
+    return endpt;
+}
+
+EndpointIPtr
+IceInternal::UnixEndpointFactory::read(InputStream* s) const
+{
+    return make_shared<UnixEndpointI>(_instance, s);
+}
+
+EndpointFactoryPtr
+IceInternal::UnixEndpointFactory::clone(const ProtocolInstancePtr& instance) const
+{
+    return make_shared<UnixEndpointFactory>(instance);
+}
+#endif
@@ -0,0 +1,92 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_UNIX_ENDPOINT_I_H
+#define ICE_UNIX_ENDPOINT_I_H
+
+#include "EndpointFactory.h"
+#include "EndpointI.h"
+#include "Ice/Config.h"
+#include "ProtocolInstanceF.h"
+
+namespace IceInternal
+{
+    // An endpoint for a Unix domain stream socket, such as `unix -p /run/app.sock`. The socket file is local to the
+    // host: a Unix endpoint is published as is, and the peers on other hosts fail to connect to it.
+    class UnixEndpointI final : public EndpointI, public std::enable_shared_from_this<UnixEndpointI>
+    {
+    public:
+        UnixEndpointI(ProtocolInstancePtr, std::string, std::int32_t, std::string, bool, std::uint8_t);
+        UnixEndpointI(ProtocolInstancePtr);
+        UnixEndpointI(ProtocolInstancePtr, Ice::InputStream*);
+
+        void streamWriteImpl(Ice::OutputStream*) const final;
+
+        [[nodiscard]] Ice::EndpointInfoPtr getInfo() const noexcept final;
+        [[nodiscard]] std::int16_t type() const final;
+        [[nodiscard]] const std::string& protocol() const final;
+        [[nodiscard]] std::int32_t timeout() const final;
+        [[nodiscard]] EndpointIPtr timeout(std::int32_t) const final;
+        [[nodiscard]] const std::string& connectionId() const final;
+        [[nodiscard]] EndpointIPtr connectionId(const std::string&) const final;
+        [[nodiscard]] bool compress() const final;
+        [[nodiscard]] EndpointIPtr compress(bool) const final;
+        [[nodiscard]] std::uint8_t compressionCodec() const final;
+        [[nodiscard]] bool datagram() const final;
+        [[nodiscard]] bool secure() const final;
+
+        [[nodiscard]] TransceiverPtr transceiver() const final;
+        void connectorsAsync(
+            Ice::EndpointSelectionType,
+            std::function<void(std::vector<ConnectorPtr>)>,
+            std::function<void(std::exception_ptr)>) const final;
+        [[nodiscard]] AcceptorPtr
+        acceptor(const std::string&, const std::optional<Ice::SSL::ServerAuthenticationOptions>&) const final;
+        [[nodiscard]] std::vector<EndpointIPtr> expandHost() const final;
+        [[nodiscard]] bool isLoopbackOrMulticast() const final;
+        [[nodiscard]] std::shared_ptr<EndpointI> toPublishedEndpoint(std::string publishedHost) const final;
+        [[nodiscard]] bool equivalent(const EndpointIPtr&) const final;
+
+        bool operator==(const Ice::Endpoint&) const final;
+        bool operator<(const Ice::Endpoint&) const final;
+
+        [[nodiscard]] std::size_t hash() const noexcept final;
+        [[nodiscard]] std::string options() const final;
+
+        [[nodiscard]] const std::string& path() const { return _path; }
+
+        void initWithOptions(std::vector<std::string>&);
+
+    protected:
+        bool checkOption(const std::string&, const std::string&, const std::string&) final;
+
+    private:
+        //
+        // All members are const, because endpoints are immutable.
+        //
+        const ProtocolInstancePtr _instance;
+        const std::string _path;
+        const std::int32_t _timeout;
+        const std::string _connectionId;
+        const bool _compress;
+        const std::uint8_t _compressionCodec; // Not marshaled, like with TCP endpoints.
+    };
+
+    class UnixEndpointFactory final : public EndpointFactory
+    {
+    public:
+        UnixEndpointFactory(ProtocolInstancePtr);
+        ~UnixEndpointFactory() override;
+
+        [[nodiscard]] std::int16_t type() const final;
+        [[nodiscard]] std::string protocol() const final;
+        EndpointIPtr create(std::vector<std::string>&, bool) const final;
+        EndpointIPtr read(Ice::InputStream*) const final;
+
+        [[nodiscard]] EndpointFactoryPtr clone(const ProtocolInstancePtr&) const final;
+
+    private:
+        const ProtocolInstancePtr _instance;
+    };
+}
+
+#endif
@@ -0,0 +1,167 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Config.h"
+
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+
+#    include "UnixTransceiver.h"
+#    include "Ice/Buffer.h"
+#    include "Ice/Connection.h"
+#    include "Ice/LocalExceptions.h"
+#    include "ProtocolInstance.h"
+
+#    include <utility>
+
+using namespace std;
+using namespace Ice;
+using namespace IceInternal;
+
+namespace
+{
+    // Retrieves the credentials of the process connected to the other end of the socket, as recorded by the kernel
+    // when the connection was established. The values are left unchanged if not available.
+    void getPeerCredentials(SOCKET fd, int& pid, int& uid, int& gid)
+    {
+#    if defined(__linux__)
+        ucred credentials;
+        auto len = static_cast<socklen_t>(sizeof(credentials));
+        if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials, &len) == 0)
+        {
+            pid = static_cast<int>(credentials.pid);
+            uid = static_cast<int>(credentials.uid);
+            gid = static_cast<int>(credentials.gid);
+        }
+#    else
+        uid_t peerUid;
+        gid_t peerGid;
+        if (getpeereid(fd, &peerUid, &peerGid) == 0)
+        {
+            uid = static_cast<int>(peerUid);
+            gid = static_cast<int>(peerGid);
+        }
+#        if defined(LOCAL_PEERPID)
+        pid_t peerPid;
+        auto len = static_cast<socklen_t>(sizeof(peerPid));
+        if (getsockopt(fd, SOL_LOCAL, LOCAL_PEERPID, &peerPid, &len) == 0)
+        {
+            pid = static_cast<int>(peerPid);
+        }
+#        endif
+#    endif
+    }
+}
+
+NativeInfoPtr
+IceInternal::UnixTransceiver::getNativeInfo()
+{
+    return _stream;
+}
+
+SocketOperation
+IceInternal::UnixTransceiver::initialize(Buffer& readBuffer, Buffer& writeBuffer)
+{
+    return _stream->connect(readBuffer, writeBuffer);
+}
+
+SocketOperation
+IceInternal::UnixTransceiver::closing(bool initiator, exception_ptr)
+{
+    // If we are initiating the connection closure, wait for the peer
+    // to close the connection. Otherwise, close immediately.
+    return initiator ? SocketOperationRead : SocketOperationNone;
+}
+
+void
+IceInternal::UnixTransceiver::close()
+{
+    _stream->close();
+}
+
+SocketOperation
+IceInternal::UnixTransceiver::write(Buffer& buf)
+{
+    return _stream->write(buf);
+}
+
+SocketOperation
+IceInternal::UnixTransceiver::read(Buffer& buf)
+{
+    return _stream->read(buf);
+}
+
+SocketOperation
+IceInternal::UnixTransceiver::writev(const vector<Buffer*>& buffers)
+{
+    return _stream->writev(buffers);
+}
+
+string
+IceInternal::UnixTransceiver::protocol() const
+{
+    return _instance->protocol();
+}
+
+string
+IceInternal::UnixTransceiver::toString() const
+{
+    return _stream->toString();
+}
+
+string
+IceInternal::UnixTransceiver::toDetailedString() const
+{
+    return toString();
+}
+
+Ice::ConnectionInfoPtr
+IceInternal::UnixTransceiver::getInfo(bool incoming, string adapterName, string connectionId) const
+{
+    if (_stream->fd() == INVALID_SOCKET)
+    {
+        return make_shared<UnixConnectionInfo>(incoming, std::move(adapterName), std::move(connectionId), _path);
+    }
+    else
+    {
+        int pid = -1;
+        int uid = -1;
+        int gid = -1;
+        getPeerCredentials(_stream->fd(), pid, uid, gid);
+        return make_shared<UnixConnectionInfo>(
+            incoming,
+            std::move(adapterName),
+            std::move(connectionId),
+            _path,
+            pid,
+            uid,
+            gid,
+            getRecvBufferSize(_stream->fd()),
+            getSendBufferSize(_stream->fd()));
+    }
+}
+
+void
+IceInternal::UnixTransceiver::checkSendSize(const Buffer&)
+{
+}
+
+void
+IceInternal::UnixTransceiver::setBufferSize(int rcvSize, int sndSize)
+{
+    _stream->setBufferSize(rcvSize, sndSize);
+}
+
+void
+IceInternal::UnixTransceiver::setReadAheadSize(size_t size)
+{
+    _stream->setReadAheadSize(size);
+}
+
+IceInternal::UnixTransceiver::UnixTransceiver(ProtocolInstancePtr instance, StreamSocketPtr stream, string path)
+    : _instance(std::move(instance)),
+      _stream(std::move(stream)),
+      _path(std::move(path))
+{
+}
+
+IceInternal::UnixTransceiver::~UnixTransceiver() = default;
+#endif
@@ -0,0 +1,44 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef ICE_UNIX_TRANSCEIVER_H
+#define ICE_UNIX_TRANSCEIVER_H
+
+#include "Network.h"
+#include "ProtocolInstanceF.h"
+#include "StreamSocket.h"
+#include "Transceiver.h"
+
+namespace IceInternal
+{
+    class UnixTransceiver final : public Transceiver
+    {
+    public:
+        UnixTransceiver(ProtocolInstancePtr, StreamSocketPtr, std::string);
+        ~UnixTransceiver();
+        NativeInfoPtr getNativeInfo() final;
+
+        SocketOperation initialize(Buffer&, Buffer&) final;
+        SocketOperation closing(bool, std::exception_ptr) final;
+
+        void close() final;
+        SocketOperation write(Buffer&) final;
+        SocketOperation read(Buffer&) final;
+        SocketOperation writev(const std::vector<Buffer*>&) final;
+
+        [[nodiscard]] std::string protocol() const final;
+        [[nodiscard]] std::string toString() const final;
+        [[nodiscard]] std::string toDetailedString() const final;
+        [[nodiscard]] Ice::ConnectionInfoPtr
+        getInfo(bool incoming, std::string adapterName, std::string connectionId) const final;
+        void checkSendSize(const Buffer&) final;
+        void setBufferSize(int rcvSize, int sndSize) final;
+        void setReadAheadSize(size_t size) final;
+
+    private:
+        const ProtocolInstancePtr _instance;
+        const StreamSocketPtr _stream;
+        const std::string _path;
+    };
+}
+
+#endif
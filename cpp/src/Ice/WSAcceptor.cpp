@@ -35,6 +35,12 @@ IceInternal::WSAcceptor::listen()
     return _endpoint;
 }
 
+bool
+IceInternal::WSAcceptor::setReusePort()
+{
+    return _delegate->setReusePort();
+}
+
 #if defined(ICE_USE_IOCP)
 void
 IceInternal::WSAcceptor::startAccept()
@@ -25,6 +25,7 @@ namespace IceInternal
 
         void close() final;
         EndpointIPtr listen() final;
+        bool setReusePort() final;
 #if defined(ICE_USE_IOCP)
         void startAccept() final;
         void finishAccept() final;
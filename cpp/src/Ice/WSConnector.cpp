@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "WSConnector.h"
+#include "HashUtil.h"
 #include "HttpParser.h"
 #include "WSEndpoint.h"
 #include "WSTransceiver.h"
@@ -27,6 +28,14 @@ IceInternal::WSConnector::toString() const
     return _delegate->toString();
 }
 
+size_t
+IceInternal::WSConnector::hash() const noexcept
+{
+    size_t h = _delegate->hash();
+    hashAdd(h, _resource);
+    return h;
+}
+
 bool
 IceInternal::WSConnector::operator==(const Connector& r) const
 {
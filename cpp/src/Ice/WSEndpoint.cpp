@@ -185,6 +185,12 @@ IceInternal::WSEndpoint::compress(bool compress) const
     }
 }
 
+uint8_t
+IceInternal::WSEndpoint::compressionCodec() const
+{
+    return _delegate->compressionCodec();
+}
+
 bool
 IceInternal::WSEndpoint::datagram() const
 {
@@ -34,6 +34,7 @@ namespace IceInternal
         [[nodiscard]] EndpointIPtr connectionId(const std::string&) const final;
         [[nodiscard]] bool compress() const final;
         [[nodiscard]] EndpointIPtr compress(bool) const final;
+        [[nodiscard]] std::uint8_t compressionCodec() const final;
         [[nodiscard]] bool datagram() const final;
         [[nodiscard]] bool secure() const final;
 
@@ -4,6 +4,7 @@
 
 #if TARGET_OS_IPHONE != 0
 
+#    include "../HashUtil.h"
 #    include "../Network.h"
 #    include "../NetworkProxy.h"
 #    include "../UniqueRef.h"
@@ -52,6 +53,17 @@ IceObjC::StreamConnector::toString() const
     return os.str();
 }
 
+size_t
+IceObjC::StreamConnector::hash() const noexcept
+{
+    size_t h = 5381;
+    IceInternal::hashAdd(h, _timeout);
+    IceInternal::hashAdd(h, _connectionId);
+    IceInternal::hashAdd(h, _host);
+    IceInternal::hashAdd(h, _port);
+    return h;
+}
+
 bool
 IceObjC::StreamConnector::operator==(const IceInternal::Connector& r) const
 {
@@ -29,6 +29,7 @@ namespace IceObjC
 
         bool operator==(const IceInternal::Connector&) const final;
         bool operator<(const IceInternal::Connector&) const final;
+        [[nodiscard]] std::size_t hash() const noexcept final;
 
     private:
         friend class StreamEndpointI;
@@ -36,6 +36,7 @@ namespace IceObjC
 
         bool operator==(const IceInternal::Connector&) const final;
         bool operator<(const IceInternal::Connector&) const final;
+        [[nodiscard]] std::size_t hash() const noexcept final;
 
     private:
         const IceInternal::ProtocolInstancePtr _instance;
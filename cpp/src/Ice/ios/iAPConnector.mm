@@ -4,6 +4,7 @@
 
 #if TARGET_OS_IPHONE != 0
 
+#    include "../HashUtil.h"
 #    include "../ProtocolInstance.h"
 #    include "iAPConnector.h"
 #    include "iAPEndpointI.h"
@@ -45,6 +46,17 @@ IceObjC::iAPConnector::toString() const
     return os.str();
 }
 
+size_t
+IceObjC::iAPConnector::hash() const noexcept
+{
+    size_t h = 5381;
+    IceInternal::hashAdd(h, _timeout);
+    IceInternal::hashAdd(h, _connectionId);
+    IceInternal::hashAdd(h, static_cast<size_t>([_accessory hash]));
+    IceInternal::hashAdd(h, static_cast<size_t>([_protocol hash]));
+    return h;
+}
+
 bool
 IceObjC::iAPConnector::operator==(const IceInternal::Connector& r) const
 {
@@ -1,6 +1,7 @@
 // Copyright (c) ZeroC, Inc.
 
 #include "ConnectorI.h"
+#include "../Ice/HashUtil.h"
 #include "Ice/LocalExceptions.h"
 #include "Instance.h"
 #include "TransceiverI.h"
@@ -38,6 +39,17 @@ IceBT::ConnectorI::toString() const
     return _addr;
 }
 
+size_t
+IceBT::ConnectorI::hash() const noexcept
+{
+    size_t h = 5381;
+    IceInternal::hashAdd(h, _addr);
+    IceInternal::hashAdd(h, _uuid);
+    IceInternal::hashAdd(h, _timeout);
+    IceInternal::hashAdd(h, _connectionId);
+    return h;
+}
+
 bool
 IceBT::ConnectorI::operator==(const IceInternal::Connector& r) const
 {
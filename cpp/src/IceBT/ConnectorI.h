@@ -22,6 +22,7 @@ namespace IceBT
 
         bool operator==(const IceInternal::Connector&) const final;
         bool operator<(const IceInternal::Connector&) const final;
+        [[nodiscard]] std::size_t hash() const noexcept final;
 
     private:
         const InstancePtr _instance;
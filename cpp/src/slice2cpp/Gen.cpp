@@ -11,6 +11,8 @@
 #include <algorithm>
 #include <cassert>
 #include <limits>
+#include <map>
+#include <set>
 #include <string>
 
 using namespace std;
@@ -609,6 +611,156 @@ namespace
         out << "std::function<void" << spar << createOutgoingAsyncParams(p, "", typeContext) << epar << ">";
         return os.str();
     }
+
+    /// Gets the position of the character that takes the most distinct values in the given operation names, which
+    /// all have the same length.
+    size_t discriminatingPosition(const list<pair<string, string>>& opNamesList)
+    {
+        assert(!opNamesList.empty());
+        size_t length = opNamesList.front().first.size();
+        size_t position = 0;
+        size_t maxCount = 0;
+        for (size_t i = 0; i < length; ++i)
+        {
+            set<char> chars;
+            for (const auto& opNames : opNamesList)
+            {
+                chars.insert(opNames.first[i]);
+            }
+            if (chars.size() > maxCount)
+            {
+                maxCount = chars.size();
+                position = i;
+            }
+        }
+        return position;
+    }
+
+    /// Writes the dispatch of an operation, provided the operation name of the current object matches its name.
+    void writeDispatchCase(Output& C, const pair<string, string>& opNames)
+    {
+        C << nl << "if (current.operation == \"" << opNames.first << "\")";
+        C << sb;
+        C << nl << "_iceD_" << opNames.second << "(request, std::move(sendResponse));";
+        C << nl << "return;";
+        C << eb;
+    }
+
+    /// Checks if the synchronous invocations of an operation can call a collocated servant directly (see the
+    /// cpp:direct-call metadata and IceInternal::DirectCall).
+    bool canCallDirectly(const OperationPtr& p, TypeContext typeContext)
+    {
+        const InterfaceDefPtr container = p->interface();
+        if (!container->hasMetadata("cpp:direct-call") && !p->hasMetadata("cpp:direct-call"))
+        {
+            return false;
+        }
+
+        // The servant of an AMD operation or of an operation with a marshaled result doesn't return the results to
+        // the caller. With classes, the caller and the servant would share the same instances.
+        if (container->hasMetadata("amd") || p->hasMetadata("amd") || p->hasMarshaledResult() || p->sendsClasses() ||
+            p->returnsClasses())
+        {
+            return false;
+        }
+
+        // The zero-copy mapping of an in parameter of the servant may not be constructible from the mapping of this
+        // parameter for the proxy.
+        const string scope = container->mappedScope();
+        for (const auto& param : p->inParameters())
+        {
+            const TypePtr type = param->type();
+            const MetadataList metadata = param->getMetadata();
+            const TypeContext zeroCopyContext = typeContext | TypeContext::UnmarshalParamZeroCopy;
+            if (typeToString(type, param->optional(), scope, metadata, typeContext) !=
+                typeToString(type, param->optional(), scope, metadata, zeroCopyContext))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Writes the direct call of a collocated servant for the synchronous invocation of an operation.
+    void writeDirectCall(Output& C, const OperationPtr& p, TypeContext typeContext)
+    {
+        const InterfaceDefPtr container = p->interface();
+        const string scope = container->mappedScope();
+
+        // The in parameters are converted to the mapping of the servant, for example from std::string_view to
+        // std::string. The out parameters are written to temporaries, and moved to the caller's variables only if
+        // the servant doesn't throw: like with the marshaled path, the caller's variables are left untouched when
+        // the invocation fails.
+        vector<string> args;
+        vector<pair<string, string>> outParams;
+        for (const auto& param : p->parameters())
+        {
+            const string prefixedParamName = paramPrefix + param->mappedName();
+            string typeString =
+                typeToString(param->type(), param->optional(), scope, param->getMetadata(), typeContext);
+            if (param->isOutParam())
+            {
+                outParams.emplace_back(typeString, param->mappedName());
+                args.push_back("iceO_" + param->mappedName());
+            }
+            else
+            {
+                args.push_back(typeString + "(" + prefixedParamName + ")");
+            }
+        }
+        args.emplace_back("directCall.current()");
+
+        C << sb;
+        C << nl << "IceInternal::DirectCall directCall{*this, \"" << p->name() << "\", "
+          << operationModeToString(p->mode()) << ", context};";
+        C << nl << "if (auto servant = directCall.servant<" << container->mappedScoped() << ">())";
+        C << sb;
+        C << nl << "try";
+        C << sb;
+        for (const auto& [typeString, paramName] : outParams)
+        {
+            C << nl << typeString << " iceO_" << paramName << ";";
+        }
+        C << nl;
+        if (p->returnType() && !outParams.empty())
+        {
+            C << "auto result = ";
+        }
+        else if (p->returnType())
+        {
+            C << "return ";
+        }
+        C << "servant->" << p->mappedName() << spar << args << epar << ";";
+        for (const auto& [typeString, paramName] : outParams)
+        {
+            C << nl << paramPrefix << paramName << " = std::move(iceO_" << paramName << ");";
+        }
+        if (p->returnType() && !outParams.empty())
+        {
+            C << nl << "return result;";
+        }
+        else if (!p->returnType())
+        {
+            C << nl << "return;";
+        }
+        C << eb;
+
+        ExceptionList throws = p->throws();
+        throws.sort(Slice::DerivedToBaseCompare());
+        for (const auto& ex : throws)
+        {
+            C << nl << "catch (const " << ex->mappedScoped() << "&)";
+            C << sb;
+            C << nl << "throw;";
+            C << eb;
+        }
+        C << nl << "catch (...)";
+        C << sb;
+        C << nl << "directCall.rethrow(std::current_exception());";
+        C << eb;
+        C << eb;
+        C << eb;
+    }
 }
 
 Slice::Gen::Gen(
@@ -787,6 +939,14 @@ Slice::Gen::generate(const UnitPtr& p)
         }
     }
 
+    // The coroutine-based asynchronous operations of the proxies are defined inline in the header.
+    if (p->contains<InterfaceDef>())
+    {
+        H << "\n#ifdef ICE_HAS_COROUTINES";
+        H << "\n#   include <Ice/OutgoingAsync.h>";
+        H << "\n#endif";
+    }
+
     // Include Ice.h since it was not included in the header.
     if (dc->hasMetadata("cpp:no-default-include"))
     {
@@ -795,10 +955,9 @@ Slice::Gen::generate(const UnitPtr& p)
 
     // For simplicity, we include these extra headers all the time.
     C << "\n#include <Ice/AsyncResponseHandler.h>"; // for async dispatches
+    C << "\n#include <Ice/DirectCall.h>";           // for direct calls to collocated servants
     C << "\n#include <Ice/FactoryTable.h>";         // for class and exception factories
     C << "\n#include <Ice/OutgoingAsync.h>";        // for proxies
-    C << "\n#include <algorithm>";                  // for the dispatch implementation
-    C << "\n#include <array>";                      // for the dispatch implementation
 
     // Disable shadow and deprecation warnings in .cpp file
     C << sp;
@@ -917,6 +1076,13 @@ Slice::Gen::validateMetadata(const UnitPtr& u)
         }};
     knownMetadata.emplace("cpp:ice_print", std::move(icePrintInfo));
 
+    // "cpp:direct-call"
+    MetadataInfo directCallInfo = {
+        .validOn = {typeid(InterfaceDecl), typeid(Operation)},
+        .acceptedArgumentKind = MetadataArgumentKind::NoArguments,
+    };
+    knownMetadata.emplace("cpp:direct-call", std::move(directCallInfo));
+
     // "cpp:dll-export"
     MetadataInfo dllExportInfo = {
         .validOn = {typeid(Unit)},
@@ -1638,6 +1804,7 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
     vector<string> inParamsDecl;
     vector<string> inParamsImplDecl;
     vector<string> inParamsImpl;
+    vector<string> inParamsNames;
 
     vector<string> futureOutParams = createOutgoingAsyncParams(p, interfaceScope, _useWstring);
     vector<string> lambdaOutParams =
@@ -1674,6 +1841,7 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
             inParamsDecl.push_back(typeString + ' ' + paramName);
             inParamsImplDecl.push_back(typeString + ' ' + prefixedParamName);
             inParamsImpl.push_back(prefixedParamName);
+            inParamsNames.push_back(paramName);
         }
     }
 
@@ -1726,6 +1894,10 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
     C << nl << retSImpl << nl << prxScopedOpName << spar << paramsImplDecl << "const Ice::Context& context" << epar
       << " const";
     C << sb;
+    if (canCallDirectly(p, _useWstring))
+    {
+        writeDirectCall(C, p, _useWstring);
+    }
     C << nl;
     if (futureOutParams.size() == 1)
     {
@@ -1869,6 +2041,43 @@ Slice::Gen::ProxyVisitor::visitOperation(const OperationPtr& p)
     C << "context" << epar << ";";
     C << eb;
 
+    //
+    // Coroutine-based asynchronous operation, only available with C++20 coroutines. It's defined inline in the
+    // header: the Slice files of the Ice libraries are compiled as C++17 and their generated source files would not
+    // define it.
+    //
+    H << sp;
+    H.zeroIndent();
+    H << nl << "#ifdef ICE_HAS_COROUTINES";
+    H.restoreIndent();
+    if (comment)
+    {
+        StringList postParams, returns;
+        postParams.push_back(contextDoc);
+        returns.emplace_back("The awaitable object for the invocation.");
+        writeOpDocSummary(
+            H,
+            p,
+            *comment,
+            OpDocInParams,
+            false,
+            GenerateDeprecated::Yes,
+            StringList(),
+            postParams,
+            returns);
+    }
+    H << nl << deprecatedAttribute << "Ice::InvocationAwaitable<" << futureT << "> " << opName << "Coro" << spar
+      << inParamsDecl << contextDecl << epar << " const";
+    H << sb;
+    H << nl << "return IceInternal::makeCoroutineOutgoing<" << futureT << ">" << spar;
+    H << "this" << string("&" + prxFutureImplScopedOpName);
+    H << inParamsNames;
+    H << contextParam << epar << ";";
+    H << eb;
+    H.zeroIndent();
+    H << nl << "#endif";
+    H.restoreIndent();
+
     // Implementation
 
     emitOperationImpl(p, futureImplPrefix, futureOutParams);
@@ -2857,49 +3066,66 @@ Slice::Gen::InterfaceVisitor::visitInterfaceDefEnd(const InterfaceDefPtr& p)
              "sendResponse)";
         C << sb;
 
-        C << sp;
-        C << nl << "static constexpr std::array<std::string_view, " << allOpNames.size() << "> allOperations";
-        C.spar('{');
+        // Group the operations by the length of their name.
+        map<size_t, list<pair<string, string>>> opNamesByLength;
         for (const auto& opNames : allOpNames)
         {
-            C << '"' + opNames.first + '"';
+            opNamesByLength[opNames.first.size()].push_back(opNames);
         }
-        C.epar('}');
-        C << ";";
 
         C << sp;
         C << nl << "const Ice::Current& current = request.current();";
-        C << nl << "auto r = std::equal_range(allOperations.begin(), allOperations.end(), current.operation);";
-        // range is a C++ 20 feature and we want to keep the generated code C++17 compatible and lint-free.
-        C << " // NOLINT(modernize-use-ranges)";
-        C << nl << "if (r.first == r.second)";
-        C << sb;
-        C << nl
-          << "sendResponse(Ice::makeOutgoingResponse(std::make_exception_ptr(Ice::OperationNotExistException{__"
-             "FILE__, __LINE__}), current));";
-        C << nl << "return;";
-        C << eb;
-        C << sp;
-        C << nl << "switch (r.first - allOperations.begin())";
+        C << nl << "switch (current.operation.size())";
         C << sb;
-        int i = 0;
-        for (const auto& opNames : allOpNames)
+        for (const auto& [length, opNamesList] : opNamesByLength)
         {
-            C << nl << "case " << i++ << ':';
+            C << nl << "case " << length << ':';
             C << sb;
-            C << nl << "_iceD_" << opNames.second << "(request, std::move(sendResponse));";
+            if (opNamesList.size() == 1)
+            {
+                writeDispatchCase(C, opNamesList.front());
+            }
+            else
+            {
+                // Then by the character that best discriminates the names of this length.
+                size_t position = discriminatingPosition(opNamesList);
+                map<char, list<pair<string, string>>> opNamesByChar;
+                for (const auto& opNames : opNamesList)
+                {
+                    opNamesByChar[opNames.first[position]].push_back(opNames);
+                }
+
+                C << nl << "switch (current.operation[" << position << "])";
+                C << sb;
+                for (const auto& [c, opNamesSubList] : opNamesByChar)
+                {
+                    C << nl << "case '" << c << "':";
+                    C << sb;
+                    for (const auto& opNames : opNamesSubList)
+                    {
+                        writeDispatchCase(C, opNames);
+                    }
+                    C << nl << "break;";
+                    C << eb;
+                }
+                C << nl << "default:";
+                C << sb;
+                C << nl << "break;";
+                C << eb;
+                C << eb;
+            }
             C << nl << "break;";
             C << eb;
         }
         C << nl << "default:";
         C << sb;
-        C << nl << "assert(false);";
+        C << nl << "break;";
+        C << eb;
+        C << eb;
         C << nl
           << "sendResponse(Ice::makeOutgoingResponse(std::make_exception_ptr(Ice::OperationNotExistException{__"
              "FILE__, __LINE__}), current));";
         C << eb;
-        C << eb;
-        C << eb;
     }
 
     H << eb << ';';
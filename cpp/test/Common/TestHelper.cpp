@@ -133,6 +133,9 @@ Test::TestHelper::TestHelper(bool registerPlugins)
     {
         Ice::registerIceWS(true);
         Ice::registerIceUDP(true);
+#if !defined(_WIN32) && (!defined(__APPLE__) || TARGET_OS_IPHONE == 0)
+        Ice::registerIceUnix(true);
+#endif
 #ifdef ICE_HAS_BT
         Ice::registerIceBT(false);
 #endif
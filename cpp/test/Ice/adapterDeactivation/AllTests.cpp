@@ -4,6 +4,9 @@
 #include "Test.h"
 #include "TestHelper.h"
 
+#include <algorithm>
+#include <mutex>
+#include <set>
 #include <stdexcept>
 #include <thread>
 
@@ -17,6 +20,43 @@ namespace
     {
         return info->underlying ? getUnderlying(info->underlying) : info;
     }
+
+    // Records the acceptors which listen for or accept connections, from the network traces of the acceptors
+    // sharing an endpoint with SO_REUSEPORT.
+    class AcceptorLogger final : public Logger, public enable_shared_from_this<AcceptorLogger>
+    {
+    public:
+        void print(const string&) final {}
+        void trace(const string&, const string& message) final
+        {
+            lock_guard lock(_mutex);
+            _traces.push_back(message);
+        }
+        void warning(const string&) final {}
+        void error(const string&) final {}
+        string getPrefix() final { return "AcceptorLogger"; }
+        LoggerPtr cloneWithPrefix(string) final { return shared_from_this(); }
+
+        // Returns the acceptors of the traces starting with the given prefix.
+        set<string> acceptors(const string& prefix)
+        {
+            lock_guard lock(_mutex);
+            set<string> result;
+            for (const auto& trace : _traces)
+            {
+                size_t pos = trace.find("(acceptor ");
+                if (trace.find(prefix) == 0 && pos != string::npos)
+                {
+                    result.insert(trace.substr(pos, trace.find(')', pos) - pos));
+                }
+            }
+            return result;
+        }
+
+    private:
+        mutex _mutex;
+        vector<string> _traces;
+    };
 }
 
 void
@@ -326,6 +366,49 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing object adapter with SO_REUSEPORT acceptors... " << flush;
+    {
+        auto logger = make_shared<AcceptorLogger>();
+        InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.Trace.Network", "2");
+        initData.properties->setProperty("Sharded.Acceptors", "3");
+        initData.logger = logger;
+        CommunicatorHolder ich(initData);
+
+        ObjectAdapterPtr adapter = ich->createObjectAdapterWithEndpoints("Sharded", helper->getTestEndpoint(11));
+        ObjectPrx prx = adapter->add(make_shared<Ice::Object>(), stringToIdentity("test"));
+        prx = prx->ice_collocationOptimized(false);
+        adapter->activate();
+
+        // The acceptors share the same endpoint.
+        test(adapter->getEndpoints().size() == 1);
+
+        const int connectionCount = 30;
+        for (int i = 0; i < connectionCount; ++i)
+        {
+            prx->ice_connectionId("connection-" + to_string(i))->ice_ping();
+        }
+
+        set<string> listening = logger->acceptors("listening for ");
+        set<string> accepting = logger->acceptors("trying to accept ");
+        if (listening.empty())
+        {
+            // SO_REUSEPORT isn't supported by the platform or the transport, the adapter has a single acceptor.
+            test(accepting.empty());
+        }
+        else
+        {
+            test(listening.size() == 3);
+            test(includes(listening.begin(), listening.end(), accepting.begin(), accepting.end()));
+#ifdef __linux__
+            // The kernel spreads the connections across the acceptors.
+            test(accepting.size() > 1);
+#endif
+        }
+    }
+    cout << "ok" << endl;
+
     cout << "deactivating object adapter in the server... " << flush;
     obj->deactivate();
     cout << "ok" << endl;
@@ -5,8 +5,11 @@
 #include "Test.h"
 #include "TestHelper.h"
 
+#include <atomic>
 #include <chrono>
 #include <future>
+#include <mutex>
+#include <set>
 #include <thread>
 
 using namespace std;
@@ -1088,6 +1091,93 @@ allTests(TestHelper* helper, bool collocated)
         }
         cout << "ok" << endl;
 
+        if (p->ice_getConnection())
+        {
+            cout << "testing cancel of coalesced requests... " << flush;
+            {
+                // The server doesn't read the requests while the adapter is on hold: once the small socket buffers
+                // are full, the queued requests are coalesced and written with partial writes. Canceling a request
+                // which is partially written must not corrupt the request stream.
+                Ice::ConnectionPtr connection = p->ice_getConnection();
+                testController->holdAdapter();
+
+                const int count = 40;
+                Ice::ByteSeq seq(10 * 1024);
+                vector<function<void()>> cancels;
+                vector<shared_ptr<promise<void>>> promises;
+                atomic<int> sentCount{0};
+                for (int i = 0; i < count; ++i)
+                {
+                    auto promise = make_shared<std::promise<void>>();
+                    cancels.push_back(p->opWithPayloadAsync(
+                        seq,
+                        [promise]() { promise->set_value(); },
+                        [promise](exception_ptr ex) { promise->set_exception(ex); },
+                        [&sentCount](bool) { ++sentCount; }));
+                    promises.push_back(promise);
+                }
+                for (int i = 1; i < count; i += 2)
+                {
+                    cancels[static_cast<size_t>(i)]();
+                }
+                testController->resumeAdapter();
+
+                for (int i = 0; i < count; ++i)
+                {
+                    try
+                    {
+                        promises[static_cast<size_t>(i)]->get_future().get();
+                        test(i % 2 == 0);
+                    }
+                    catch (const InvocationCanceledException&)
+                    {
+                        test(i % 2 == 1);
+                    }
+                }
+                test(sentCount >= count / 2);
+                test(p->opWithResult() == 15);
+                test(p->ice_getConnection() == connection);
+            }
+            cout << "ok" << endl;
+        }
+
+        int reactors = communicator->getProperties()->getPropertyAsInt("Ice.ThreadPool.Client.Reactors");
+        if (p->ice_getConnection() && reactors > 1)
+        {
+            cout << "testing reactors... " << flush;
+            {
+                // The connections are pinned to the reactors in turn, and each reactor gets one of the threads of the
+                // client thread pool: the replies received over 2 * reactors connections are dispatched by one thread
+                // of each reactor.
+                mutex threadsMutex;
+                set<thread::id> threads;
+                vector<future<void>> futures;
+                for (int i = 0; i < 2 * reactors; ++i)
+                {
+                    auto promise = make_shared<std::promise<void>>();
+                    futures.push_back(promise->get_future());
+                    p->ice_connectionId("reactor-" + to_string(i))
+                        ->opWithResultAsync(
+                            [promise, &threadsMutex, &threads](int result)
+                            {
+                                test(result == 15);
+                                {
+                                    lock_guard lock(threadsMutex);
+                                    threads.insert(this_thread::get_id());
+                                }
+                                promise->set_value();
+                            },
+                            [promise](exception_ptr ex) { promise->set_exception(ex); });
+                }
+                for (auto& f : futures)
+                {
+                    f.get();
+                }
+                test(threads.size() == static_cast<size_t>(reactors));
+            }
+            cout << "ok" << endl;
+        }
+
         if (p->ice_getConnection() && protocol != "bt")
         {
             cout << "testing connection close... " << flush;
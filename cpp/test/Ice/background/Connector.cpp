@@ -29,6 +29,12 @@ Connector::toString() const
     return _connector->toString();
 }
 
+size_t
+Connector::hash() const noexcept
+{
+    return _connector->hash();
+}
+
 bool
 Connector::operator==(const IceInternal::Connector& r) const
 {
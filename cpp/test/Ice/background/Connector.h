@@ -13,6 +13,7 @@ public:
 
     [[nodiscard]] std::int16_t type() const override;
     [[nodiscard]] std::string toString() const override;
+    [[nodiscard]] std::size_t hash() const noexcept override;
 
     bool operator==(const IceInternal::Connector&) const override;
     bool operator<(const IceInternal::Connector&) const override;
@@ -4,13 +4,88 @@
 #include "Ice/Ice.h"
 #include "Test.h"
 #include "TestHelper.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
 #include <set>
+#include <thread>
 
 #include <functional>
 
 using namespace std;
 using namespace Test;
 
+namespace
+{
+    // Counts the connection establishment failures traced with Ice.Trace.Network=2.
+    class FailureCountLogger final : public Ice::Logger, public enable_shared_from_this<FailureCountLogger>
+    {
+    public:
+        void print(const string&) final {}
+        void trace(const string&, const string& message) final
+        {
+            if (message.find("connection to endpoint failed") == 0)
+            {
+                ++_failures;
+            }
+        }
+        void warning(const string&) final {}
+        void error(const string&) final {}
+        string getPrefix() final { return "FailureCountLogger"; }
+        Ice::LoggerPtr cloneWithPrefix(string) final { return shared_from_this(); }
+
+        [[nodiscard]] int failures() const { return _failures; }
+
+    private:
+        atomic<int> _failures{0};
+    };
+
+    // Records the traces of the connection establishments, with Ice.Trace.Network=2.
+    class ConnectTraceLogger final : public Ice::Logger, public enable_shared_from_this<ConnectTraceLogger>
+    {
+    public:
+        void print(const string&) final {}
+        void trace(const string&, const string& message) final
+        {
+            if (message.find("trying to establish ") == 0 || message.find("established ") == 0 ||
+                message.find("failed to establish ") == 0 || message.find("connection to endpoint failed") == 0)
+            {
+                lock_guard lock(_mutex);
+                _traces.push_back(message);
+            }
+        }
+        void warning(const string&) final {}
+        void error(const string&) final {}
+        string getPrefix() final { return "ConnectTraceLogger"; }
+        Ice::LoggerPtr cloneWithPrefix(string) final { return shared_from_this(); }
+
+        vector<string> traces()
+        {
+            lock_guard lock(_mutex);
+            return _traces;
+        }
+
+    private:
+        mutex _mutex;
+        vector<string> _traces;
+    };
+
+    // Gets the port of an IP endpoint, including the underlying endpoint of a WS or SSL endpoint.
+    int
+    getPort(const Ice::EndpointPtr& endpoint)
+    {
+        for (Ice::EndpointInfoPtr info = endpoint->getInfo(); info; info = info->underlying)
+        {
+            if (auto ipInfo = dynamic_pointer_cast<Ice::IPEndpointInfo>(info))
+            {
+                return ipInfo->port;
+            }
+        }
+        test(false);
+        return 0;
+    }
+}
+
 string
 getAdapterNameWithAMI(const TestIntfPrx& test)
 {
@@ -40,6 +115,21 @@ deactivate(const RemoteCommunicatorPrx& com, vector<optional<RemoteObjectAdapter
     }
 }
 
+class SleepTestIntfI final : public TestIntf
+{
+public:
+    SleepTestIntfI(chrono::milliseconds delay) : _delay(delay) {}
+
+    string getAdapterName(const Ice::Current& current) final
+    {
+        this_thread::sleep_for(_delay);
+        return current.adapter->getName();
+    }
+
+private:
+    const chrono::milliseconds _delay;
+};
+
 void
 allTests(Test::TestHelper* helper)
 {
@@ -772,6 +862,184 @@ allTests(Test::TestHelper* helper)
     }
     cout << "ok" << endl;
 
+    cout << "testing staggered connection establishment... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.ConnectAttemptDelay", "50");
+        initData.properties->setProperty("Ice.Trace.Network", "2");
+        auto logger = make_shared<ConnectTraceLogger>();
+        initData.logger = logger;
+        Ice::CommunicatorHolder ich(initData);
+
+        // This adapter is never activated: the connections to its endpoint are accepted by the system but never
+        // validated, like connections to an unreachable host.
+        Ice::ObjectAdapterPtr blackhole =
+            communicator->createObjectAdapterWithEndpoints("Blackhole", "tcp -h 127.0.0.1");
+
+        optional<RemoteObjectAdapterPrx> adapter = com->createObjectAdapter("Adapter101", "default");
+        TestIntfPrx test = TestIntfPrx(ich.communicator(), adapter->getTestIntf()->ice_toString());
+        Ice::EndpointSeq endpoints = blackhole->getEndpoints();
+        Ice::EndpointSeq edpts = test->ice_getEndpoints();
+        endpoints.insert(endpoints.end(), edpts.begin(), edpts.end());
+        test = test->ice_endpoints(endpoints)->ice_endpointSelection(Ice::EndpointSelectionType::Ordered);
+        test(test->getAdapterName() == "Adapter101");
+
+        // The connection to the second endpoint is tried once the attempt delay elapsed, while the connection to the
+        // first endpoint is still pending. Without the attempt delay, it's only tried after the connect timeout of the
+        // first connection, which is traced as a failure.
+        const string blackholePort = ":" + to_string(getPort(blackhole->getEndpoints()[0]));
+        const string adapterPort = ":" + to_string(getPort(edpts[0]));
+        vector<string> traces = logger->traces();
+        test(traces.size() >= 3);
+        test(traces[0].find("trying to establish ") == 0);
+        test(traces[0].rfind(blackholePort) == traces[0].size() - blackholePort.size());
+        test(traces[1].find("trying to establish ") == 0);
+        test(traces[1].rfind(adapterPort) == traces[1].size() - adapterPort.size());
+        test(traces[2].find("established ") == 0);
+        test(traces[2].find(adapterPort, traces[2].find("remote address = ")) != string::npos);
+
+        com->deactivateObjectAdapter(adapter);
+        blackhole->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing latency endpoint selection... " << flush;
+    {
+        Ice::InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        Ice::CommunicatorHolder ich(initData);
+
+        // The adapters are in the main communicator, the invocations from the new communicator aren't collocated.
+        Ice::ObjectAdapterPtr fast = communicator->createObjectAdapterWithEndpoints("LatencyFast", "default");
+        Ice::ObjectAdapterPtr slow = communicator->createObjectAdapterWithEndpoints("LatencySlow", "default");
+        fast->add(make_shared<SleepTestIntfI>(0ms), Ice::stringToIdentity("test"));
+        slow->add(make_shared<SleepTestIntfI>(50ms), Ice::stringToIdentity("test"));
+        fast->activate();
+        slow->activate();
+
+        Ice::EndpointSeq endpoints = slow->getEndpoints();
+        Ice::EndpointSeq edpts = fast->getEndpoints();
+        endpoints.insert(endpoints.end(), edpts.begin(), edpts.end());
+        TestIntfPrx test = TestIntfPrx(ich.communicator(), "test")
+                               ->ice_endpoints(endpoints)
+                               ->ice_endpointSelection(Ice::EndpointSelectionType::Latency);
+        test(test->ice_getEndpointSelection() == Ice::EndpointSelectionType::Latency);
+
+        // The endpoints without latency are tried first, the invocations use both adapters before they prefer the
+        // fastest one.
+        set<string> names;
+        for (int i = 0; i < 2; ++i)
+        {
+            names.insert(test->getAdapterName());
+            test->ice_getConnection()->close().get();
+        }
+        test(names.size() == 2);
+
+        for (int i = 0; i < 5; ++i)
+        {
+            test(test->getAdapterName() == "LatencyFast");
+            test->ice_getConnection()->close().get();
+        }
+
+        // An existing connection to the slowest endpoint isn't used, a connection to the fastest endpoint is
+        // established instead.
+        TestIntfPrx slowTest = test->ice_endpoints(slow->getEndpoints());
+        test(slowTest->getAdapterName() == "LatencySlow");
+        test(test->getAdapterName() == "LatencyFast");
+        test(test->ice_getConnection() != slowTest->ice_getConnection());
+
+        // A failed endpoint is tried last, even once the exploration interval elapsed, until the backoff of twice the
+        // exploration interval elapsed.
+        Ice::InitializationData failureInitData;
+        failureInitData.properties = communicator->getProperties()->clone();
+        failureInitData.properties->setProperty("Ice.LatencyExplorationInterval", "1");
+        failureInitData.properties->setProperty("Ice.RetryIntervals", "-1");
+        failureInitData.properties->setProperty("Ice.Trace.Network", "2");
+        auto logger = make_shared<FailureCountLogger>();
+        failureInitData.logger = logger;
+        Ice::CommunicatorHolder failureIch(failureInitData);
+
+        Ice::ObjectAdapterPtr dead = communicator->createObjectAdapterWithEndpoints("LatencyDead", "default");
+        endpoints = dead->getEndpoints();
+        dead->destroy();
+        TestIntfPrx failureTest = TestIntfPrx(failureIch.communicator(), "test")
+                                      ->ice_endpoints(endpoints)
+                                      ->ice_endpointSelection(Ice::EndpointSelectionType::Latency);
+        try
+        {
+            failureTest->ice_ping();
+            test(false);
+        }
+        catch (const Ice::ConnectFailedException&)
+        {
+        }
+        auto failed = chrono::steady_clock::now();
+        test(logger->failures() == 1);
+
+        edpts = fast->getEndpoints();
+        endpoints.insert(endpoints.end(), edpts.begin(), edpts.end());
+        failureTest = failureTest->ice_endpoints(endpoints);
+        while (logger->failures() == 1)
+        {
+            test(chrono::steady_clock::now() - failed < 10s);
+            test(failureTest->getAdapterName() == "LatencyFast");
+            failureTest->ice_getConnection()->close().get();
+            this_thread::sleep_for(100ms);
+        }
+        test(chrono::steady_clock::now() - failed > 1900ms);
+        test(logger->failures() == 2);
+
+        fast->destroy();
+        slow->destroy();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing connection pool... " << flush;
+    {
+        optional<RemoteObjectAdapterPrx> adapter = com->createObjectAdapter("Adapter91", "default");
+
+        TestIntfPrx test1 = adapter->getTestIntf()->ice_connectionPoolSize(3);
+        test(test1->ice_getConnectionPoolSize() == 3);
+
+        // The connections of the pool are idle, they are selected in turn.
+        set<Ice::ConnectionPtr> connections;
+        for (int i = 0; i < 9; i++)
+        {
+            connections.insert(test1->ice_getConnection());
+        }
+        test(connections.size() == 3);
+
+        // Proxies with the same endpoints and pool size share the connections of the pool.
+        TestIntfPrx test2 = adapter->getTestIntf()->ice_connectionPoolSize(3);
+        for (int i = 0; i < 3; i++)
+        {
+            test(connections.find(test2->ice_getConnection()) != connections.end());
+        }
+        test(connections.find(adapter->getTestIntf()->ice_getConnection()) != connections.end());
+
+        vector<future<string>> results;
+        for (int i = 0; i < 30; i++)
+        {
+            results.push_back(test1->getAdapterNameAsync());
+        }
+        for (auto& result : results)
+        {
+            test(result.get() == "Adapter91");
+        }
+
+        // The pool establishes new connections once its connections are closed.
+        for (const auto& connection : connections)
+        {
+            connection->close().get();
+        }
+        test(test1->getAdapterName() == "Adapter91");
+        test(connections.find(test1->ice_getConnection()) == connections.end());
+
+        com->deactivateObjectAdapter(adapter);
+    }
+    cout << "ok" << endl;
+
     cout << "testing endpoint mode filtering... " << flush;
     {
         vector<optional<RemoteObjectAdapterPrx>> adapters;
@@ -3,8 +3,59 @@
 #include "Ice/Ice.h"
 #include "TestHelper.h"
 
+#include <chrono>
+#include <random>
+
 using namespace std;
 
+namespace
+{
+    // Measures the connection lookup performed by proxies which don't have a cached connection yet, with a growing
+    // number of established connections. The connections are opened to a local adapter, each one with a different
+    // connection ID.
+    void benchmark(const Ice::CommunicatorPtr& communicator, size_t count, size_t lookups)
+    {
+        auto adapter = communicator->createObjectAdapterWithEndpoints("Benchmark", "tcp -h 127.0.0.1");
+        adapter->activate();
+        auto prx = adapter->createProxy(Ice::stringToIdentity("benchmark"))->ice_collocationOptimized(false);
+
+        vector<Ice::ObjectPrx> proxies;
+        proxies.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            proxies.push_back(prx->ice_connectionId("c" + to_string(i)));
+            proxies.back()->ice_getConnection();
+        }
+
+        mt19937 rng(static_cast<uint32_t>(count));
+        uniform_int_distribution<size_t> dist(0, count - 1);
+        vector<Ice::ObjectPrx> fresh;
+        fresh.reserve(lookups);
+        for (size_t i = 0; i < lookups; ++i)
+        {
+            // A copy of the proxy with a different context doesn't share the cached connection of the original.
+            fresh.push_back(proxies[dist(rng)]->ice_context({{"i", to_string(i)}}));
+        }
+
+        auto start = chrono::steady_clock::now();
+        for (const auto& p : fresh)
+        {
+            p->ice_getConnection();
+        }
+        auto elapsed = chrono::steady_clock::now() - start;
+
+        cout << "  " << count << " connections: "
+             << chrono::duration_cast<chrono::nanoseconds>(elapsed).count() / static_cast<int64_t>(lookups)
+             << "ns per lookup" << endl;
+
+        for (const auto& p : proxies)
+        {
+            p->ice_getCachedConnection()->close().get();
+        }
+        adapter->destroy();
+    }
+}
+
 class Client : public Test::TestHelper
 {
 public:
@@ -18,6 +69,14 @@ Client::run(int argc, char** argv)
     // Speed-up connection establishment failure on Windows.
     properties->setProperty("Ice.Connection.Client.ConnectTimeout", "1");
     Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+    if (argc > 1 && string(argv[1]) == "--benchmark")
+    {
+        for (size_t count : {size_t{1}, size_t{10}, size_t{100}, size_t{1000}})
+        {
+            benchmark(communicator.communicator(), count, 10000);
+        }
+        return;
+    }
     void allTests(Test::TestHelper*);
     allTests(this);
 }
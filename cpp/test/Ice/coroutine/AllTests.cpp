@@ -0,0 +1,167 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "Task.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+using namespace std;
+using namespace Ice;
+using namespace Test;
+
+namespace
+{
+    Task
+    awaitOperations(TestIntfPrx prx)
+    {
+        co_await prx->opVoidCoro();
+        test(co_await prx->opIntCoro(5) == 5);
+
+        auto [r, s2] = co_await prx->opStringCoro("hello");
+        test(r == "hello");
+        test(s2 == "olleh");
+
+        Context ctx{{"one", "1"}};
+        test(co_await prx->opIntCoro(6, ctx) == 6);
+    }
+
+    Task
+    awaitExceptions(TestIntfPrx prx)
+    {
+        try
+        {
+            co_await prx->opExceptionCoro("user");
+            test(false);
+        }
+        catch (const TestException& ex)
+        {
+            test(ex.message == "user");
+        }
+
+        try
+        {
+            co_await prx->ice_facet<TestIntfPrx>("missing")->opVoidCoro();
+            test(false);
+        }
+        catch (const FacetNotExistException&)
+        {
+        }
+
+        try
+        {
+            // Operations with results require a twoway proxy.
+            co_await prx->ice_oneway()->opIntCoro(1);
+            test(false);
+        }
+        catch (const TwowayOnlyException&)
+        {
+        }
+    }
+
+    Task
+    awaitCompleted(TestIntfPrx prx)
+    {
+        // A oneway invocation is completed once sent: the coroutine isn't suspended.
+        auto awaitable = prx->ice_oneway()->opVoidCoro();
+        test(awaitable.await_ready());
+        co_await awaitable;
+
+        // The invocation is sent before it's awaited.
+        auto opInt = prx->opIntCoro(7);
+        auto opString = prx->opStringCoro("world");
+        test(co_await opInt == 7);
+        test(get<1>(co_await opString) == "dlrow");
+    }
+
+    Task
+    awaitSequence(TestIntfPrx prx, int32_t count)
+    {
+        for (int32_t i = 0; i < count; ++i)
+        {
+            test(co_await prx->opIntCoro(i) == i);
+        }
+    }
+
+    Task
+    awaitBuiltInProxy(PropertiesAdminPrx prx)
+    {
+        // The proxies generated for the Slice files of the Ice library also provide the coroutine operations.
+        test(co_await prx->getPropertyCoro("Test.Coroutine") == "1");
+        PropertyDict properties = co_await prx->getPropertiesForPrefixCoro("Test.");
+        test(properties.size() == 1 && properties["Test.Coroutine"] == "1");
+    }
+
+    Task
+    awaitAmd(TestIntfPrx prx)
+    {
+        test(co_await prx->opAwaitCoro(8) == 8);
+        try
+        {
+            co_await prx->opAwaitCoro(-1);
+            test(false);
+        }
+        catch (const TestException& ex)
+        {
+            test(ex.message == "negative");
+        }
+    }
+}
+
+TestIntfPrx
+allTests(TestHelper* helper)
+{
+    CommunicatorPtr communicator = helper->communicator();
+    TestIntfPrx prx(communicator, "test:" + helper->getTestEndpoint());
+
+    cout << "testing coroutine invocations... " << flush;
+    {
+        awaitOperations(prx).future.get();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing coroutine invocations with exceptions... " << flush;
+    {
+        awaitExceptions(prx).future.get();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing coroutine invocations completed before being awaited... " << flush;
+    {
+        awaitCompleted(prx).future.get();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing concurrent coroutines... " << flush;
+    {
+        vector<Task> tasks;
+        for (int i = 0; i < 200; ++i)
+        {
+            tasks.push_back(awaitSequence(prx, 10));
+        }
+        for (auto& task : tasks)
+        {
+            task.future.get();
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing coroutine invocations with built-in proxies... " << flush;
+    {
+        InitializationData initData;
+        initData.properties = communicator->getProperties()->clone();
+        initData.properties->setProperty("Ice.Admin.Enabled", "1");
+        initData.properties->setProperty("Test.Coroutine", "1");
+        CommunicatorHolder admin = initialize(initData);
+        ObjectPrx adminPrx = admin->createAdmin(admin->createObjectAdapter(""), stringToIdentity("admin"));
+        awaitBuiltInProxy(adminPrx->ice_facet<PropertiesAdminPrx>("Properties")).future.get();
+    }
+    cout << "ok" << endl;
+
+    cout << "testing coroutine AMD dispatch... " << flush;
+    {
+        awaitAmd(prx).future.get();
+    }
+    cout << "ok" << endl;
+
+    return prx;
+}
@@ -0,0 +1,5 @@
+# Copyright (c) ZeroC, Inc.
+
+$(project)_cppflags += -std=c++20
+
+tests += $(project)
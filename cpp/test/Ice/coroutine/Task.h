@@ -0,0 +1,27 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef TASK_H
+#define TASK_H
+
+#include <coroutine>
+#include <exception>
+#include <future>
+
+// A minimal coroutine type: the coroutine starts eagerly and reports its completion through a future.
+struct Task
+{
+    struct promise_type
+    {
+        std::promise<void> promise;
+
+        Task get_return_object() { return Task{promise.get_future()}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() { promise.set_value(); }
+        void unhandled_exception() { promise.set_exception(std::current_exception()); }
+    };
+
+    std::future<void> future;
+};
+
+#endif
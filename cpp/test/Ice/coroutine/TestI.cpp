@@ -0,0 +1,77 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "TestI.h"
+#include "Ice/Ice.h"
+#include "Task.h"
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+    // The parameters are copied into the coroutine frame, the coroutine can safely outlive the dispatch.
+    Task
+    awaitOpInt(
+        TestIntfPrx self,
+        int32_t i,
+        function<void(int32_t)> response,
+        function<void(exception_ptr)> exception)
+    {
+        try
+        {
+            if (i < 0)
+            {
+                co_await self->opExceptionCoro("negative");
+            }
+            response(co_await self->opIntCoro(i));
+        }
+        catch (...)
+        {
+            exception(current_exception());
+        }
+    }
+}
+
+void
+TestIntfI::opVoid(const Ice::Current&)
+{
+}
+
+int32_t
+TestIntfI::opInt(int32_t i, const Ice::Current&)
+{
+    return i;
+}
+
+string
+TestIntfI::opString(string s1, string& s2, const Ice::Current&)
+{
+    s2 = string{s1.rbegin(), s1.rend()};
+    return s1;
+}
+
+void
+TestIntfI::opException(string message, const Ice::Current&)
+{
+    throw TestException{std::move(message)};
+}
+
+void
+TestIntfI::opAwaitAsync(
+    int32_t i,
+    function<void(int32_t)> response,
+    function<void(exception_ptr)> exception,
+    const Ice::Current& current)
+{
+    awaitOpInt(
+        current.adapter->createProxy<TestIntfPrx>(current.id),
+        i,
+        std::move(response),
+        std::move(exception));
+}
+
+void
+TestIntfI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
@@ -0,0 +1,28 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include "Test.h"
+
+class TestIntfI final : public Test::TestIntf
+{
+public:
+    void opVoid(const Ice::Current&) final;
+
+    std::int32_t opInt(std::int32_t i, const Ice::Current&) final;
+
+    std::string opString(std::string s1, std::string& s2, const Ice::Current&) final;
+
+    void opException(std::string message, const Ice::Current&) final;
+
+    void opAwaitAsync(
+        std::int32_t i,
+        std::function<void(std::int32_t)> response,
+        std::function<void(std::exception_ptr)> exception,
+        const Ice::Current&) final;
+
+    void shutdown(const Ice::Current&) final;
+};
+
+#endif
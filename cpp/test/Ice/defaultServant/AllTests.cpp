@@ -4,6 +4,8 @@
 #include "TestHelper.h"
 #include "TestI.h"
 
+#include <thread>
+
 using namespace std;
 using namespace Test;
 
@@ -151,4 +153,79 @@ allTests(Test::TestHelper* helper)
     }
 
     cout << "ok" << endl;
+
+    cout << "testing many servants... " << flush;
+
+    oa->removeDefaultServant("");
+    {
+        // The servants are spread over the shards of the servant map. Several threads dispatch requests to them
+        // while another thread adds and removes other servants.
+        const int servantCount = 1000;
+        for (int i = 0; i < servantCount; ++i)
+        {
+            oa->add(servant, Ice::Identity{to_string(i), "many"});
+        }
+
+        const int threadCount = 4;
+        vector<thread> threads;
+        for (int i = 0; i < threadCount; ++i)
+        {
+            threads.emplace_back(
+                [oa, first = i]
+                {
+                    for (int j = first; j < servantCount; j += threadCount)
+                    {
+                        auto p = oa->createProxy<MyObjectPrx>(Ice::Identity{to_string(j), "many"});
+                        test(p->getName() == to_string(j));
+                    }
+                });
+        }
+        threads.emplace_back(
+            [oa, servant]
+            {
+                for (int i = 0; i < 200; ++i)
+                {
+                    Ice::Identity id{"other" + to_string(i), "many"};
+                    oa->add(servant, id);
+                    test(oa->find(id) == servant);
+                    oa->remove(id);
+                    test(!oa->find(id));
+                }
+            });
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        for (int i = 1; i < servantCount; i += 2)
+        {
+            oa->remove(Ice::Identity{to_string(i), "many"});
+        }
+        for (int i = 0; i < servantCount; i += 25)
+        {
+            for (int j : {i, i + 1})
+            {
+                auto p = oa->createProxy<MyObjectPrx>(Ice::Identity{to_string(j), "many"});
+                if (j % 2 == 0)
+                {
+                    test(oa->find(Ice::Identity{to_string(j), "many"}) == servant);
+                    test(p->getName() == to_string(j));
+                }
+                else
+                {
+                    test(!oa->find(Ice::Identity{to_string(j), "many"}));
+                    try
+                    {
+                        p->ice_ping();
+                        test(false);
+                    }
+                    catch (const Ice::ObjectNotExistException&)
+                    {
+                    }
+                }
+            }
+        }
+    }
+
+    cout << "ok" << endl;
 }
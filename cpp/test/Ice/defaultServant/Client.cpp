@@ -3,9 +3,54 @@
 #include "Ice/Ice.h"
 #include "TestHelper.h"
 
+#include <chrono>
+#include <random>
+
 using namespace std;
 using namespace Test;
 
+namespace
+{
+    // Measures the servant lookup of an object adapter with a growing number of servants. ObjectAdapter::find also
+    // locks the adapter mutex, so the lookups are performed from a single thread.
+    void benchmark(const Ice::CommunicatorPtr& communicator, size_t count, size_t lookups)
+    {
+        auto adapter = communicator->createObjectAdapter("");
+        auto servant = make_shared<Ice::Object>();
+
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i)
+        {
+            adapter->add(servant, Ice::Identity{"s" + to_string(i), ""});
+        }
+        auto addElapsed = chrono::steady_clock::now() - start;
+
+        mt19937 rng(static_cast<uint32_t>(count));
+        uniform_int_distribution<size_t> dist(0, count - 1);
+        vector<Ice::Identity> identities;
+        identities.reserve(lookups);
+        for (size_t i = 0; i < lookups; ++i)
+        {
+            identities.push_back(Ice::Identity{"s" + to_string(dist(rng)), ""});
+        }
+
+        start = chrono::steady_clock::now();
+        for (const auto& id : identities)
+        {
+            test(adapter->find(id));
+        }
+        auto findElapsed = chrono::steady_clock::now() - start;
+
+        cout << "  " << count << " servants: "
+             << chrono::duration_cast<chrono::nanoseconds>(addElapsed).count() / static_cast<int64_t>(count)
+             << "ns per add, "
+             << chrono::duration_cast<chrono::nanoseconds>(findElapsed).count() / static_cast<int64_t>(lookups)
+             << "ns per lookup" << endl;
+
+        adapter->destroy();
+    }
+}
+
 class Client : public Test::TestHelper
 {
 public:
@@ -16,6 +61,14 @@ void
 Client::run(int argc, char** argv)
 {
     Ice::CommunicatorHolder communicator = initialize(argc, argv);
+    if (argc > 1 && string(argv[1]) == "--benchmark")
+    {
+        for (size_t count : {size_t{1000}, size_t{100000}, size_t{1000000}})
+        {
+            benchmark(communicator.communicator(), count, 1000000);
+        }
+        return;
+    }
     void allTests(Test::TestHelper*);
     allTests(this);
 }
@@ -0,0 +1,171 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "TestHelper.h"
+#include "TestI.h"
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+    // A middleware that doesn't do anything: direct calls are disabled for the object adapters with middleware.
+    class Middleware final : public Ice::Object
+    {
+    public:
+        Middleware(Ice::ObjectPtr next) : _next(std::move(next)) {}
+
+        void dispatch(Ice::IncomingRequest& request, std::function<void(Ice::OutgoingResponse)> sendResponse) final
+        {
+            _next->dispatch(request, std::move(sendResponse));
+        }
+
+    private:
+        Ice::ObjectPtr _next;
+    };
+
+    // Returns the message of the exception raised by the given exception kind.
+    string throwException(const TestIntfPrx& p, ExceptionKind kind)
+    {
+        try
+        {
+            p->throwException(kind);
+            test(false);
+        }
+        catch (const DerivedException& ex)
+        {
+            test(kind == ExceptionKind::Derived);
+            return ex.message;
+        }
+        catch (const TestException& ex)
+        {
+            test(kind == ExceptionKind::Declared);
+            return ex.message;
+        }
+        catch (const Ice::UnknownUserException& ex)
+        {
+            test(kind == ExceptionKind::Undeclared);
+            return ex.what();
+        }
+        catch (const Ice::ObjectNotExistException& ex)
+        {
+            test(kind == ExceptionKind::ObjectNotExist);
+            test(ex.id() == Ice::stringToIdentity("test"));
+            test(ex.operation() == "throwException");
+            return ex.what();
+        }
+        catch (const Ice::UnknownLocalException& ex)
+        {
+            test(kind == ExceptionKind::Local);
+            return ex.what();
+        }
+        catch (const Ice::UnknownException& ex)
+        {
+            test(kind == ExceptionKind::Std);
+            return ex.what();
+        }
+        return "";
+    }
+}
+
+void
+allTests(Test::TestHelper* helper)
+{
+    Ice::CommunicatorPtr communicator = helper->communicator();
+
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("");
+    adapter->add(make_shared<TestIntfI>(), Ice::stringToIdentity("test"));
+    TestIntfPrx direct(communicator, "test");
+
+    Ice::ObjectAdapterPtr middlewareAdapter = communicator->createObjectAdapter("");
+    middlewareAdapter->use([](Ice::ObjectPtr next) { return make_shared<Middleware>(std::move(next)); });
+    middlewareAdapter->add(make_shared<TestIntfI>(), Ice::stringToIdentity("test2"));
+    TestIntfPrx marshaled(communicator, "test2");
+
+    cout << "testing direct calls... " << flush;
+    {
+        // The direct dispatches all have the same request ID, the requests dispatched by the collocated request
+        // handler get a new request ID.
+        test(direct->getRequestId() == 1);
+        test(direct->getRequestId() == 1);
+        test(marshaled->getRequestId() != marshaled->getRequestId());
+
+        // The asynchronous invocations are not dispatched directly.
+        test(direct->getRequestIdAsync().get() != direct->getRequestIdAsync().get());
+    }
+    cout << "ok" << endl;
+
+    cout << "testing direct call parameters... " << flush;
+    {
+        for (const auto& p : {direct, marshaled})
+        {
+            string s2;
+            test(p->opString("hello", s2) == "hello");
+            test(s2 == "olleh");
+        }
+
+        // The out parameters are left untouched when the servant throws.
+        for (const auto& p : {direct, marshaled})
+        {
+            string s = "caller";
+            int32_t i = 1;
+            try
+            {
+                p->opOutException(s, i);
+                test(false);
+            }
+            catch (const TestException& ex)
+            {
+                test(ex.message == "out");
+            }
+            test(s == "caller");
+            test(i == 1);
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing direct call context... " << flush;
+    {
+        for (const auto& p : {direct, marshaled})
+        {
+            Ice::Context ctx{{"one", "1"}};
+            test(p->opContext().empty());
+            test(p->opContext(ctx) == ctx);
+            test(p->ice_context(ctx)->opContext() == ctx);
+
+            communicator->getImplicitContext()->put("two", "2");
+            Ice::Context combined{{"one", "1"}, {"two", "2"}};
+            test(p->ice_context(ctx)->opContext() == combined);
+            test(p->opContext(ctx) == ctx);
+            communicator->getImplicitContext()->setContext({});
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing direct call exceptions... " << flush;
+    {
+        for (ExceptionKind kind :
+             {ExceptionKind::Declared,
+              ExceptionKind::Derived,
+              ExceptionKind::Undeclared,
+              ExceptionKind::Local,
+              ExceptionKind::Std})
+        {
+            test(throwException(direct, kind) == throwException(marshaled, kind));
+        }
+        throwException(direct, ExceptionKind::ObjectNotExist);
+
+        // The missing servants are handled by the regular dispatch.
+        try
+        {
+            direct->ice_facet<TestIntfPrx>("missing")->getRequestId();
+            test(false);
+        }
+        catch (const Ice::FacetNotExistException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    adapter->destroy();
+    middlewareAdapter->destroy();
+}
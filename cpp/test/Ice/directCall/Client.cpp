@@ -0,0 +1,25 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Test.h"
+#include "TestHelper.h"
+
+using namespace std;
+using namespace Test;
+
+class Client : public Test::TestHelper
+{
+public:
+    void run(int, char**) override;
+};
+
+void
+Client::run(int argc, char** argv)
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+    properties->setProperty("Ice.ImplicitContext", "Shared");
+    Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+    void allTests(Test::TestHelper*);
+    allTests(this);
+}
+
+DEFINE_TEST(Client)
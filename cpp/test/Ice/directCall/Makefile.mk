@@ -0,0 +1,5 @@
+# Copyright (c) ZeroC, Inc.
+
+$(project)_client_sources = Client.cpp AllTests.cpp Test.ice TestI.cpp
+
+tests += $(project)
@@ -0,0 +1,55 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "TestI.h"
+
+#include <stdexcept>
+
+using namespace std;
+using namespace Test;
+
+int32_t
+TestIntfI::getRequestId(const Ice::Current& current)
+{
+    return current.requestId;
+}
+
+string
+TestIntfI::opString(string s1, string& s2, const Ice::Current&)
+{
+    s2 = string{s1.rbegin(), s1.rend()};
+    return s1;
+}
+
+int32_t
+TestIntfI::opOutException(string& s, int32_t& i, const Ice::Current&)
+{
+    s = "servant";
+    i = 42;
+    throw TestException{"out"};
+}
+
+Ice::Context
+TestIntfI::opContext(const Ice::Current& current)
+{
+    return current.ctx;
+}
+
+void
+TestIntfI::throwException(ExceptionKind kind, const Ice::Current&)
+{
+    switch (kind)
+    {
+        case ExceptionKind::Declared:
+            throw TestException{"declared"};
+        case ExceptionKind::Derived:
+            throw DerivedException{"derived"};
+        case ExceptionKind::Undeclared:
+            throw UndeclaredException{};
+        case ExceptionKind::ObjectNotExist:
+            throw Ice::ObjectNotExistException{__FILE__, __LINE__};
+        case ExceptionKind::Local:
+            throw Ice::TimeoutException{__FILE__, __LINE__, "local"};
+        case ExceptionKind::Std:
+            throw runtime_error{"std"};
+    }
+}
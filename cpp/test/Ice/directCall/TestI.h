@@ -0,0 +1,18 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include "Test.h"
+
+class TestIntfI final : public Test::TestIntf
+{
+public:
+    std::int32_t getRequestId(const Ice::Current&) final;
+    std::string opString(std::string, std::string&, const Ice::Current&) final;
+    std::int32_t opOutException(std::string&, std::int32_t&, const Ice::Current&) final;
+    Ice::Context opContext(const Ice::Current&) final;
+    void throwException(Test::ExceptionKind, const Ice::Current&) final;
+};
+
+#endif
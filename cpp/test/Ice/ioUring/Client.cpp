@@ -0,0 +1,158 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "TestHelper.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <linux/filter.h>
+#include <linux/seccomp.h>
+#include <mutex>
+#include <sys/prctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace
+{
+    // Records the traces of the thread pool creations.
+    class ThreadPoolLogger final : public Ice::Logger, public enable_shared_from_this<ThreadPoolLogger>
+    {
+    public:
+        void print(const string&) final {}
+        void trace(const string& category, const string& message) final
+        {
+            if (category == "ThreadPool" && message.find("creating ") == 0)
+            {
+                lock_guard lock(_mutex);
+                _traces.push_back(message);
+            }
+        }
+        void warning(const string&) final {}
+        void error(const string&) final {}
+        string getPrefix() final { return "ThreadPoolLogger"; }
+        Ice::LoggerPtr cloneWithPrefix(string) final { return shared_from_this(); }
+
+        vector<string> traces()
+        {
+            lock_guard lock(_mutex);
+            return _traces;
+        }
+
+    private:
+        mutex _mutex;
+        vector<string> _traces;
+    };
+
+    // Creates a communicator whose client and server thread pools are configured to use io_uring, and checks
+    // invocations over several connections succeed. Returns true if the thread pools use io_uring, false if they fell
+    // back to epoll.
+    bool
+    checkThreadPools(const Ice::PropertiesPtr& properties)
+    {
+        auto logger = make_shared<ThreadPoolLogger>();
+        Ice::InitializationData initData;
+        initData.properties = properties->clone();
+        initData.properties->setProperty("Ice.ThreadPool.Client.IoUring", "1");
+        initData.properties->setProperty("Ice.ThreadPool.Server.IoUring", "1");
+        initData.properties->setProperty("Ice.Trace.ThreadPool", "1");
+        initData.properties->setProperty("Ice.Warn.Connections", "0");
+        initData.logger = logger;
+        Ice::CommunicatorHolder communicator(initData);
+
+        Ice::ObjectAdapterPtr adapter =
+            communicator->createObjectAdapterWithEndpoints("TestAdapter", "tcp -h 127.0.0.1");
+        Ice::ObjectPrx prx = adapter->add(make_shared<Ice::Object>(), Ice::stringToIdentity("test"));
+        prx = prx->ice_collocationOptimized(false);
+        adapter->activate();
+
+        for (int i = 0; i < 5; ++i)
+        {
+            Ice::ObjectPrx p = prx->ice_connectionId("connection-" + to_string(i));
+            for (int j = 0; j < 10; ++j)
+            {
+                p->ice_ping();
+            }
+            p->ice_getCachedConnection()->close().get();
+        }
+
+        int clientPools = 0;
+        int serverPools = 0;
+        int ioUringPools = 0;
+        for (const auto& trace : logger->traces())
+        {
+            if (trace.find("creating Ice.ThreadPool.Client") == 0)
+            {
+                ++clientPools;
+            }
+            else if (trace.find("creating Ice.ThreadPool.Server") == 0)
+            {
+                ++serverPools;
+            }
+            else
+            {
+                continue;
+            }
+
+            if (trace.find(", IoUring = 1") != string::npos)
+            {
+                ++ioUringPools;
+            }
+        }
+        test(clientPools > 0 && serverPools > 0);
+
+        // Either all the thread pools use io_uring or none of them does.
+        test(ioUringPools == 0 || ioUringPools == clientPools + serverPools);
+        return ioUringPools > 0;
+    }
+}
+
+class Client final : public Test::TestHelper
+{
+public:
+    void run(int, char**) final;
+};
+
+void
+Client::run(int argc, char** argv)
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+
+    cout << "testing thread pools with io_uring... " << flush;
+    if (checkThreadPools(properties))
+    {
+        cout << "ok" << endl;
+    }
+    else
+    {
+        cout << "ok (io_uring is not available, the thread pools use epoll)" << endl;
+    }
+
+    cout << "testing fallback to epoll... " << flush;
+    {
+        // Make io_uring_setup fail with ENOSYS for this thread and the threads it creates, as the seccomp profiles of
+        // container runtimes do. This can't be undone, so this must be the last test.
+        struct sock_filter filter[] = {
+            BPF_STMT(BPF_LD | BPF_W | BPF_ABS, static_cast<uint32_t>(offsetof(struct seccomp_data, nr))),
+            BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, __NR_io_uring_setup, 0, 1),
+            BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ERRNO | (ENOSYS & SECCOMP_RET_DATA)),
+            BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW),
+        };
+        struct sock_fprog program;
+        program.len = static_cast<unsigned short>(sizeof(filter) / sizeof(filter[0]));
+        program.filter = filter;
+        if (prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) != 0 || prctl(PR_SET_SECCOMP, SECCOMP_MODE_FILTER, &program) != 0)
+        {
+            cout << "skipped (seccomp filters are not supported)" << endl;
+            return;
+        }
+        test(syscall(__NR_io_uring_setup, 1, nullptr) == -1 && errno == ENOSYS);
+
+        test(!checkThreadPools(properties));
+    }
+    cout << "ok" << endl;
+}
+
+DEFINE_TEST(Client)
@@ -0,0 +1,6 @@
+# Copyright (c) ZeroC, Inc.
+
+# The io_uring selector is only available on Linux.
+ifeq ($(os),Linux)
+    tests += $(project)
+endif
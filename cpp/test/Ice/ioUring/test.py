@@ -0,0 +1,7 @@
+# Copyright (c) ZeroC, Inc.
+
+from Util import ClientTestCase, Linux, TestSuite, platform
+
+# The io_uring selector is only available on Linux.
+if isinstance(platform, Linux):
+    TestSuite(__file__, [ClientTestCase()], options={"protocol": ["tcp"]})
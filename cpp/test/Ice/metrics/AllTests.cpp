@@ -426,6 +426,56 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
         view["Thread"][0]->total == threadCount);
     cout << "ok" << endl;
 
+    cout << "testing buffer pool metrics..." << flush;
+    for (int i = 0; i < 10; ++i)
+    {
+        metrics->op();
+    }
+    view = clientMetrics->getMetricsView("View", timestamp);
+    test(!view["BufferPool"].empty());
+    int64_t hits = 0;
+    for (const auto& m : view["BufferPool"])
+    {
+        auto bm = dynamic_pointer_cast<IceMX::BufferPoolMetrics>(m);
+        test(bm && bm->total >= bm->hits && bm->current >= 0);
+        hits += bm->hits;
+    }
+    test(hits > 0);
+
+    // An allocation only misses the caches, and allocates a new block, when the pool doesn't hold enough blocks yet.
+    // Once the pool is warmed up, a loop of invocations reuses the released blocks and doesn't add any miss. A miss can
+    // still occasionally add a block when the blocks are kept by the caches of other threads, so the loop is repeated
+    // until it doesn't add any miss, at most 10 times.
+    auto misses = [&clientMetrics, &timestamp]
+    {
+        IceMX::MetricsView metricsView = clientMetrics->getMetricsView("View", timestamp);
+        int64_t count = 0;
+        for (const auto& m : metricsView["BufferPool"])
+        {
+            count += m->total - dynamic_pointer_cast<IceMX::BufferPoolMetrics>(m)->hits;
+        }
+        return count;
+    };
+
+    int64_t warmedUp = misses();
+    int loops = 0;
+    while (true)
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            metrics->op();
+            metrics->opAsync().get();
+        }
+        int64_t current = misses();
+        if (current == warmedUp)
+        {
+            break;
+        }
+        warmedUp = current;
+        test(++loops < 10);
+    }
+    cout << "ok" << endl;
+
     cout << "testing group by id..." << flush;
 
     props["IceMX.Metrics.View.GroupBy"] = "id";
@@ -791,6 +841,49 @@ allTests(Test::TestHelper* helper, const CommunicatorObserverIPtr& obsv)
         testAttribute(clientMetrics, clientProps, update.get(), "EndpointLookup", "endpointPort", port, c);
 
         cout << "ok" << endl;
+
+        cout << "testing endpoint lookup cache... " << flush;
+        {
+            Ice::InitializationData initData;
+            initData.properties = communicator->getProperties()->clone();
+            initData.properties->setProperty("Ice.HostResolver.Size", "2");
+            initData.properties->setProperty("Ice.HostResolver.CacheTTL", "60");
+            initData.properties->setProperty("Ice.HostResolver.NegativeCacheTTL", "60");
+            initData.properties->setProperty("Ice.HostResolver.PreResolve", "localhost");
+            CommunicatorObserverIPtr cacheObserver = make_shared<CommunicatorObserverI>();
+            initData.observer = cacheObserver;
+            Ice::CommunicatorHolder ich(initData);
+
+            // localhost is resolved when the communicator is initialized, the connections don't wait for a lookup.
+            for (int i = 0; i < 3; ++i)
+            {
+                Ice::ObjectPrx localhostPrx(
+                    ich.communicator(),
+                    "metrics:" + protocol + " -h localhost -t 500 -p " + port);
+                localhostPrx->ice_ping();
+                localhostPrx->ice_getConnection()->close().get();
+            }
+            test(!cacheObserver->endpointLookupObserver);
+
+            // The lookup failure (or success, with some DNS servers) is cached: the retry and the next invocation
+            // don't do a lookup.
+            for (int i = 0; i < 2; ++i)
+            {
+                try
+                {
+                    Ice::ObjectPrx unknownPrx(
+                        ich.communicator(),
+                        "test:tcp -t 500 -h unknownfoo.zeroc.com -p " + port);
+                    unknownPrx->ice_ping();
+                    test(false);
+                }
+                catch (const Ice::LocalException&)
+                {
+                }
+            }
+            test(cacheObserver->endpointLookupObserver && cacheObserver->endpointLookupObserver->getTotal() == 1);
+        }
+        cout << "ok" << endl;
 #endif
     }
 
@@ -22,6 +22,7 @@ Client::run(int argc, char** argv)
     initData.properties->setProperty("Ice.Admin.Endpoints", "default");
     initData.properties->setProperty("Ice.Admin.InstanceName", "client");
     initData.properties->setProperty("Ice.Admin.DelayCreation", "1");
+    initData.properties->setProperty("Ice.BufferPool", "1");
     initData.properties->setProperty("Ice.Warn.Connections", "0");
     initData.properties->setProperty(
         "Ice.Connection.Client.ConnectTimeout",
@@ -49,5 +49,16 @@ allTests(Test::TestHelper* helper)
     batchOnewaysAMI(derived);
     cout << "ok" << endl;
 
+    cout << "testing compression... " << flush;
+    bool compression(const Test::MyClassPrx&);
+    if (compression(cl))
+    {
+        cout << "ok" << endl;
+    }
+    else
+    {
+        cout << "ok (zstd-stream is not supported by this build, the dictionary mismatch test is skipped)" << endl;
+    }
+
     return cl;
 }
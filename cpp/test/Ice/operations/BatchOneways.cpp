@@ -115,6 +115,23 @@ batchOneways(const MyClassPrx& p)
         batch2->ice_ping();
     }
 
+    {
+        // Time-based auto-flush: the requests are sent once the interval of the first one expires.
+        MyClassPrx batch5 = batch->ice_batchAutoFlushInterval(chrono::milliseconds(50));
+        test(batch5->ice_getBatchAutoFlushInterval() == chrono::milliseconds(50));
+        batch5->ice_flushBatchRequests();
+        p->opByteSOnewayCallCount(); // Reset the call count
+        batch5->opByteSOneway(bs1);
+        batch5->opByteSOneway(bs1);
+        count = 0;
+        for (i = 0; i < 500 && count < 2; ++i)
+        {
+            count += p->opByteSOnewayCallCount();
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+        test(count == 2);
+    }
+
     Identity identity;
     identity.name = "invalid";
     {
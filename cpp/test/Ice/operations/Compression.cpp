@@ -0,0 +1,224 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "../../src/Ice/RequestId.h"
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <thread>
+
+using namespace std;
+
+namespace
+{
+    // The identity of the test object, which is part of the dictionaries: the identity is compressed as a reference to
+    // the dictionary.
+    const string identity = "zstd-stream-compression-dictionary-0123456789abcdefghijklmnopqrstuvwxyz";
+
+    // Records whether a message compressed with zstd-stream was traced. The client only compresses its requests with
+    // zstd-stream if the build supports Zstd.
+    class CodecLogger final : public Ice::Logger, public enable_shared_from_this<CodecLogger>
+    {
+    public:
+        void print(const string&) final {}
+        void trace(const string&, const string& message) final
+        {
+            if (message.find("compressed with zstd-stream") != string::npos)
+            {
+                _zstdStream = true;
+            }
+        }
+        void warning(const string&) final {}
+        void error(const string&) final {}
+        string getPrefix() final { return "CodecLogger"; }
+        Ice::LoggerPtr cloneWithPrefix(string) final { return shared_from_this(); }
+
+        [[nodiscard]] bool zstdStream() const { return _zstdStream; }
+
+    private:
+        atomic<bool> _zstdStream{false};
+    };
+
+    Ice::CommunicatorPtr
+    createCommunicator(const string& dictionary, const Ice::LoggerPtr& logger = nullptr)
+    {
+        Ice::InitializationData initData;
+        initData.properties = Ice::createProperties();
+        initData.properties->setProperty("Ice.Compression.Codec", "zstd-stream");
+        initData.properties->setProperty("Ice.Compression.Dictionary", dictionary);
+        initData.properties->setProperty("Ice.Compression.Threshold", "0");
+        initData.properties->setProperty("Ice.Override.Compress", "1");
+        initData.properties->setProperty("Ice.Default.InvocationTimeout", "10000");
+        initData.properties->setProperty("Ice.Warn.Connections", "0");
+        if (logger)
+        {
+            initData.properties->setProperty("Ice.Trace.Protocol", "1");
+            initData.logger = logger;
+        }
+        return Ice::initialize(initData);
+    }
+
+    // Writes a dictionary with the identity at its beginning or at its end.
+    void
+    writeDictionary(const string& path, bool identityFirst)
+    {
+        ofstream out(path, ios::binary);
+        if (identityFirst)
+        {
+            out << identity;
+        }
+        for (int i = 0; i < 16; ++i)
+        {
+            out << string{identity.rbegin(), identity.rend()};
+        }
+        if (!identityFirst)
+        {
+            out << identity;
+        }
+        test(out.good());
+    }
+}
+
+bool
+compression(const Test::MyClassPrx& proxy)
+{
+    {
+        // The request IDs wrap around to 1, including when several threads get a request ID concurrently.
+        atomic<int32_t> counter{INT32_MAX};
+        test(IceInternal::nextRequestId(counter) == INT32_MAX);
+        test(IceInternal::nextRequestId(counter) == 1);
+        test(IceInternal::nextRequestId(counter) == 2);
+
+        const int threadCount = 4;
+        const int requestCount = 100;
+        counter = INT32_MAX - requestCount;
+        vector<vector<int32_t>> requestIds(threadCount);
+        vector<thread> threads;
+        for (auto& ids : requestIds)
+        {
+            threads.emplace_back(
+                [&counter, &ids]
+                {
+                    for (int i = 0; i < requestCount; ++i)
+                    {
+                        ids.push_back(IceInternal::nextRequestId(counter));
+                    }
+                });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+        set<int32_t> allIds;
+        for (const auto& ids : requestIds)
+        {
+            for (int32_t id : ids)
+            {
+                test(id > 0);
+                allIds.insert(id);
+            }
+        }
+        test(allIds.size() == static_cast<size_t>(threadCount * requestCount));
+    }
+
+    {
+        // Compressed twoway requests sent concurrently over the same connection: each thread gets the replies of its
+        // own requests.
+        Test::MyClassPrx p = proxy->ice_compress(true);
+        vector<thread> threads;
+        for (int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back(
+                [p, i]
+                {
+                    for (int j = 0; j < 50; ++j)
+                    {
+                        Test::ByteS p1(1024, static_cast<byte>(i));
+                        Test::ByteS p2(1024, static_cast<byte>(j));
+                        Test::ByteS p3;
+                        Test::ByteS r = p->opByteS(p1, p2, p3);
+                        test(r.size() == p1.size() + p2.size());
+                        test(equal(p1.begin(), p1.end(), r.begin()));
+                        test(equal(p2.begin(), p2.end(), r.begin() + static_cast<ptrdiff_t>(p1.size())));
+                        test(p3.size() == p1.size() && equal(p1.rbegin(), p1.rend(), p3.begin()));
+                    }
+                });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    }
+
+    const string dictionary = "zstd-stream.dict";
+    const string otherDictionary = "zstd-stream-other.dict";
+    writeDictionary(dictionary, false);
+    writeDictionary(otherDictionary, true);
+
+    try
+    {
+        Ice::CommunicatorPtr communicator = createCommunicator("zstd-stream-missing.dict");
+        communicator->destroy();
+        test(false);
+    }
+    catch (const Ice::FileException&)
+    {
+    }
+
+    Ice::CommunicatorPtr server = createCommunicator(dictionary);
+    Ice::ObjectAdapterPtr adapter = server->createObjectAdapterWithEndpoints("Compression", "tcp -h 127.0.0.1");
+    Ice::ObjectPrx prx = adapter->add(make_shared<Ice::Object>(), Ice::stringToIdentity(identity));
+    adapter->activate();
+
+    bool zstdStream = false;
+    {
+        // Both peers use the same dictionary. Each new connection starts with new compression contexts, which
+        // are in sync with the contexts of the new server connection.
+        auto logger = make_shared<CodecLogger>();
+        Ice::CommunicatorPtr client = createCommunicator(dictionary, logger);
+        Ice::ObjectPrx p(client, prx->ice_toString());
+        Ice::Context ctx{{"key", identity}};
+        Ice::ConnectionPtr previous;
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 10; ++j)
+            {
+                p->ice_ping(ctx);
+            }
+            Ice::ConnectionPtr connection = p->ice_getCachedConnection();
+            test(connection && connection != previous);
+            connection->close().get();
+            previous = connection;
+        }
+        zstdStream = logger->zstdStream();
+        client->destroy();
+    }
+
+    if (zstdStream)
+    {
+        // The client uses a different dictionary: the server decompresses the reference to the identity in the
+        // client dictionary to other bytes of its own dictionary.
+        Ice::CommunicatorPtr client = createCommunicator(otherDictionary);
+        Ice::ObjectPrx p(client, prx->ice_toString());
+        try
+        {
+            p->ice_ping();
+            test(false);
+        }
+        catch (const Ice::LocalException&)
+        {
+        }
+        client->destroy();
+    }
+
+    server->destroy();
+    remove(dictionary.c_str());
+    remove(otherDictionary.c_str());
+    return zstdStream;
+}
@@ -8,6 +8,7 @@ $(project)_client_sources  = Test.ice \
                           TwowaysAMI.cpp \
                           OnewaysAMI.cpp \
                           BatchOneways.cpp \
-                          BatchOnewaysAMI.cpp
+                          BatchOnewaysAMI.cpp \
+                          Compression.cpp
 
 tests += $(project)
@@ -4,6 +4,9 @@
 #include "Test.h"
 #include "TestHelper.h"
 
+#include <chrono>
+#include <thread>
+
 using namespace std;
 
 void
@@ -68,4 +71,29 @@ oneways(const Ice::CommunicatorPtr&, const Test::MyClassPrx& proxy)
         {
         }
     }
+
+    {
+        // Large oneway requests are sent with MSG_ZEROCOPY when Ice.TCP.ZeroCopyThreshold is set: the connection keeps
+        // their buffers until the kernel releases them, which can be after the connection is closed.
+        proxy->opByteSOnewayCallCount(); // Reset the call count
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 20; ++j)
+            {
+                p->opByteSOneway(Test::ByteS(64 * 1024, static_cast<byte>(j)));
+            }
+            if (Ice::ConnectionPtr connection = p->ice_getCachedConnection())
+            {
+                connection->close().get();
+            }
+        }
+
+        int count = 0;
+        while (count < 60)
+        {
+            count += proxy->opByteSOnewayCallCount();
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+        test(count == 60);
+    }
 }
@@ -1661,6 +1661,44 @@ twoways(const Ice::CommunicatorPtr& communicator, Test::TestHelper*, const Test:
             }
         }
 
+        {
+            // The server reuses the memory of the context entries of the previous requests dispatched by the same
+            // thread: the contexts must not retain entries or values of the previous requests, whatever their number
+            // and size.
+            Ice::Context large;
+            for (int i = 0; i < 32; ++i)
+            {
+                large["key" + to_string(i)] = string(static_cast<size_t>(i % 2 == 0 ? 10 : 4 * 1024), 'a');
+            }
+            Ice::Context small{{"key0", "b"}, {"key1", "c"}};
+            for (const auto& ctx : {large, small, Ice::Context{}, large, large, small, small})
+            {
+                test(p->opContext(ctx) == ctx);
+            }
+
+            // Large identities and facets aren't kept for reuse either.
+            string name(4 * 1024, 'x');
+            try
+            {
+                p->ice_identity<MyClassPrx>(Ice::Identity{name, name})->ice_ping();
+                test(false);
+            }
+            catch (const Ice::ObjectNotExistException& ex)
+            {
+                test(ex.id().name == name && ex.id().category == name);
+            }
+            try
+            {
+                p->ice_facet<MyClassPrx>(name)->ice_ping();
+                test(false);
+            }
+            catch (const Ice::FacetNotExistException& ex)
+            {
+                test(ex.facet() == name);
+            }
+            test(p->opContext(small) == small);
+        }
+
         if (p->ice_getConnection() && communicator->getProperties()->getIceProperty("Ice.Default.Protocol") != "bt")
         {
             //
@@ -1796,4 +1834,33 @@ twoways(const Ice::CommunicatorPtr& communicator, Test::TestHelper*, const Test:
         p3 = p->opMDict2(p1, p2);
         test(p2 == p1 && p3 == p1);
     }
+
+    {
+        // The dispatch selects the candidate operations with the length of the operation name and one of its
+        // characters before comparing the full name. Names which share the length or the selecting character of
+        // existing operations must still be rejected.
+        const vector<byte> inParams;
+        vector<byte> outParams;
+        for (const string_view operation :
+             {"opVoid", "opMSeq1", "opMDict1", "opMStruct1", "ice_id", "ice_ids", "ice_ping"})
+        {
+            test(p->ice_invoke(operation, Ice::OperationMode::Normal, inParams, outParams));
+        }
+
+        const string longName(1024, 'o');
+        for (const string_view operation :
+             {"opVoie", "opBytd", "opInt2", "opIntX", "OpVoid", "ice_ie", "ice_idS", "ice_pin", "ice_pings", "", "o",
+              longName.c_str()})
+        {
+            try
+            {
+                p->ice_invoke(operation, Ice::OperationMode::Normal, inParams, outParams);
+                test(false);
+            }
+            catch (const Ice::OperationNotExistException& ex)
+            {
+                test(ex.operation() == operation);
+            }
+        }
+    }
 }
@@ -262,6 +262,41 @@ allTests(TestHelper* helper)
     b1 = communicator->stringToProxy(R"(test:udp --sourceAddress "::1" --interface "0:0:0:0:0:0:0:1%lo")");
     test(b1 == communicator->stringToProxy(b1->ice_toString()));
 
+    b1 = communicator->stringToProxy("test:tcp -h localhost -p 10000 --codec lz4");
+    test(b1 == communicator->stringToProxy(b1->ice_toString()));
+    test(b1->ice_toString().find("--codec lz4") != string::npos);
+
+    // The codec is a local setting which isn't marshaled: endpoints which only differ by their codec are equal.
+    test(b1 == communicator->stringToProxy("test:tcp -h localhost -p 10000"));
+    test(b1 == communicator->stringToProxy("test:tcp -h localhost -p 10000 --codec zstd"));
+
+    try
+    {
+        communicator->stringToProxy("test:tcp -h localhost -p 10000 --codec");
+        test(false);
+    }
+    catch (const Ice::ParseException&)
+    {
+    }
+
+    try
+    {
+        communicator->stringToProxy("test:tcp -h localhost -p 10000 --codec gzip");
+        test(false);
+    }
+    catch (const Ice::ParseException&)
+    {
+    }
+
+    try
+    {
+        communicator->stringToProxy("test:udp -h localhost -p 10000 --codec lz4");
+        test(false);
+    }
+    catch (const Ice::ParseException&)
+    {
+    }
+
     try
     {
         communicator->stringToProxy("test:tcp@adapterId");
@@ -514,6 +549,24 @@ allTests(TestHelper* helper)
     test(b1->ice_getInvocationTimeout() == 1s);
     prop->setProperty(property, "");
 
+    property = propertyPrefix + ".BatchAutoFlushInterval";
+    test(b1->ice_getBatchAutoFlushInterval() == 0us);
+    prop->setProperty(property, "500");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getBatchAutoFlushInterval() == 500us);
+    test(communicator->proxyToProperty(b1, "Test")["Test.BatchAutoFlushInterval"] == "500");
+    prop->setProperty(property, "");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+
+    property = propertyPrefix + ".ConnectionPoolSize";
+    test(b1->ice_getConnectionPoolSize() == 1);
+    prop->setProperty(property, "4");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getConnectionPoolSize() == 4);
+    test(communicator->proxyToProperty(b1, "Test")["Test.ConnectionPoolSize"] == "4");
+    prop->setProperty(property, "");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+
     property = propertyPrefix + ".EndpointSelection";
     test(b1->ice_getEndpointSelection() == Ice::EndpointSelectionType::Random);
     prop->setProperty(property, "Random");
@@ -522,6 +575,10 @@ allTests(TestHelper* helper)
     prop->setProperty(property, "Ordered");
     b1 = communicator->propertyToProxy(propertyPrefix);
     test(b1->ice_getEndpointSelection() == Ice::EndpointSelectionType::Ordered);
+    prop->setProperty(property, "Latency");
+    b1 = communicator->propertyToProxy(propertyPrefix);
+    test(b1->ice_getEndpointSelection() == Ice::EndpointSelectionType::Latency);
+    test(communicator->proxyToProperty(b1, "Test")["Test.EndpointSelection"] == "Latency");
     prop->setProperty(property, "");
 
     property = propertyPrefix + ".CollocationOptimized";
@@ -646,6 +703,21 @@ allTests(TestHelper* helper)
     test(base->ice_invocationTimeout(-2)->ice_getInvocationTimeout() == -2ms);
     test(base->ice_invocationTimeout(-2ms)->ice_getInvocationTimeout() == -2ms);
 
+    test(base->ice_batchAutoFlushInterval(2ms)->ice_getBatchAutoFlushInterval() == 2000us);
+    test(base->ice_batchAutoFlushInterval(0s)->ice_getBatchAutoFlushInterval() == 0us);
+
+    test(base->ice_connectionPoolSize(3)->ice_getConnectionPoolSize() == 3);
+    test(base->ice_connectionPoolSize(1) == base);
+    try
+    {
+        base = base->ice_connectionPoolSize(0);
+        test(false);
+    }
+    catch (const invalid_argument&)
+    {
+        // expected
+    }
+
     test(base->ice_locatorCacheTimeout(10)->ice_getLocatorCacheTimeout() == 10s);
 
     test(base->ice_locatorCacheTimeout(0)->ice_getLocatorCacheTimeout() == 0s);
@@ -782,6 +854,15 @@ allTests(TestHelper* helper)
     test(compObj1->ice_invocationTimeout(10) < compObj1->ice_invocationTimeout(20));
     test(compObj1->ice_invocationTimeout(20) >= compObj1->ice_invocationTimeout(10));
 
+    test(compObj1->ice_batchAutoFlushInterval(20us) == compObj1->ice_batchAutoFlushInterval(20us));
+    test(compObj1->ice_batchAutoFlushInterval(10us) != compObj1->ice_batchAutoFlushInterval(20us));
+    test(compObj1->ice_batchAutoFlushInterval(10us) < compObj1->ice_batchAutoFlushInterval(20us));
+    test(compObj1->ice_batchAutoFlushInterval(0us) == compObj1);
+
+    test(compObj1->ice_connectionPoolSize(2) == compObj1->ice_connectionPoolSize(2));
+    test(compObj1->ice_connectionPoolSize(2) != compObj1->ice_connectionPoolSize(3));
+    test(compObj1->ice_connectionPoolSize(2) < compObj1->ice_connectionPoolSize(3));
+
     compObj1 = communicator->stringToProxy("foo:tcp -h 127.0.0.1 -p 1000");
     compObj2 = communicator->stringToProxy("foo@MyAdapter1");
     test(compObj1 != compObj2);
@@ -0,0 +1,141 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+#include <thread>
+#include <unistd.h>
+
+using namespace std;
+using namespace Test;
+
+namespace
+{
+    ByteSeq makeBytes(size_t size)
+    {
+        ByteSeq seq(size);
+        for (size_t i = 0; i < size; ++i)
+        {
+            seq[i] = static_cast<byte>(i * 7 + size);
+        }
+        return seq;
+    }
+}
+
+void
+allTests(TestHelper* helper)
+{
+    Ice::CommunicatorPtr communicator = helper->communicator();
+    // The socket file is named after the test port, like the server computes it.
+    const string path = "/tmp/ice-test-shm-" + to_string(helper->getTestPort(0)) + ".sock";
+
+    cout << "testing shm endpoint parsing... " << flush;
+    {
+        Ice::ObjectPrx prx(communicator, "test:shm -p /run/app.sock -z");
+        test(prx->ice_toString() == "test -t -e 1.1:shm -p /run/app.sock -t 60000 -z");
+        test(Ice::ObjectPrx(communicator, prx->ice_toString()) == prx);
+        test(prx != Ice::ObjectPrx(communicator, "test:unix -p /run/app.sock -z"));
+
+        auto info = dynamic_pointer_cast<Ice::UnixEndpointInfo>(prx->ice_getEndpoints()[0]->getInfo());
+        test(info);
+        test(info->path == "/run/app.sock");
+        test(info->type() == Ice::ShmEndpointType);
+        test(info->compress);
+        test(!info->datagram() && !info->secure());
+
+        Ice::OutputStream out(communicator);
+        out.write(optional<Ice::ObjectPrx>(prx));
+        Ice::ByteSeq data;
+        out.finished(data);
+        Ice::InputStream in(communicator, data);
+        optional<Ice::ObjectPrx> prx2;
+        in.read(prx2);
+        test(prx2 == prx);
+    }
+    cout << "ok" << endl;
+
+    TestIntfPrx testIntf(communicator, "test:shm -p " + path);
+
+    cout << "testing invocation... " << flush;
+    {
+        testIntf->ice_ping();
+        ByteSeq seq = makeBytes(1024);
+        test(testIntf->echo(seq) == seq);
+        test(testIntf->echo(ByteSeq()).empty());
+    }
+    cout << "ok" << endl;
+
+    cout << "testing messages larger than the rings... " << flush;
+    {
+        for (size_t size :
+             {size_t{65536 - 100}, size_t{65536}, size_t{65536 + 1}, size_t{200 * 1024}, size_t{1000 * 1000}})
+        {
+            ByteSeq seq = makeBytes(size);
+            test(testIntf->echo(seq) == seq);
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing concurrent invocations... " << flush;
+    {
+        vector<future<ByteSeq>> results;
+        vector<ByteSeq> sent;
+        for (size_t i = 0; i < 50; ++i)
+        {
+            sent.push_back(makeBytes(i * 5000));
+            results.push_back(testIntf->echoAsync(sent.back()));
+        }
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            test(results[i].get() == sent[i]);
+        }
+
+        // Oneway invocations are sent back to back, and the server can't keep up with the client.
+        auto oneway = testIntf->ice_oneway();
+        int received = testIntf->getReceived();
+        ByteSeq seq = makeBytes(10000);
+        for (int i = 0; i < 500; ++i)
+        {
+            oneway->sink(seq);
+        }
+        // The oneway invocations can be dispatched concurrently with getReceived, wait for all of them.
+        int expected = received + 500 * static_cast<int>(seq.size());
+        for (int i = 0; i < 100 && testIntf->getReceived() != expected; ++i)
+        {
+            this_thread::sleep_for(chrono::milliseconds(50));
+        }
+        test(testIntf->getReceived() == expected);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing connection information... " << flush;
+    {
+        Ice::ConnectionPtr connection = testIntf->ice_getConnection();
+        test(connection->type() == "shm");
+        auto info = dynamic_pointer_cast<Ice::UnixConnectionInfo>(connection->getInfo());
+        test(info);
+        test(!info->incoming);
+        test(info->path == path);
+        test(info->peerUid == static_cast<int>(::getuid()));
+        test(connection->getEndpoint()->getInfo()->type() == Ice::ShmEndpointType);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing connection closure... " << flush;
+    {
+        Ice::ConnectionPtr connection = testIntf->ice_getConnection();
+        connection->close().get();
+        ByteSeq seq = makeBytes(100000);
+        test(testIntf->echo(seq) == seq);
+        test(testIntf->ice_getConnection() != connection);
+
+        connection = testIntf->ice_getConnection();
+        connection->abort();
+        test(testIntf->echo(seq) == seq);
+        test(testIntf->ice_getConnection() != connection);
+    }
+    cout << "ok" << endl;
+
+    testIntf->shutdown();
+}
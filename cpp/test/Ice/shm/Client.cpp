@@ -0,0 +1,28 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+using namespace std;
+
+class Client : public Test::TestHelper
+{
+public:
+    void run(int, char**) override;
+};
+
+void
+Client::run(int argc, char** argv)
+{
+    Ice::PropertiesPtr properties = createTestProperties(argc, argv);
+
+    // Use small rings, so that the messages sent by the test wrap around and fill the rings.
+    properties->setProperty("Ice.Shm.RingSize", "65536");
+
+    Ice::CommunicatorHolder communicator = initialize(argc, argv, properties);
+    void allTests(Test::TestHelper*);
+    allTests(this);
+}
+
+DEFINE_TEST(Client)
@@ -0,0 +1,30 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "TestHelper.h"
+#include "TestI.h"
+
+using namespace std;
+
+class Server : public Test::TestHelper
+{
+public:
+    void run(int, char**) override;
+};
+
+void
+Server::run(int argc, char** argv)
+{
+    Ice::CommunicatorHolder communicator = initialize(argc, argv);
+
+    // The socket file is named after the test port, like the client computes it.
+    string path = "/tmp/ice-test-shm-" + to_string(getTestPort(0)) + ".sock";
+    communicator->getProperties()->setProperty("TestAdapter.Endpoints", "shm -p " + path);
+    Ice::ObjectAdapterPtr adapter = communicator->createObjectAdapter("TestAdapter");
+    adapter->add(std::make_shared<TestI>(), Ice::stringToIdentity("test"));
+    adapter->activate();
+    serverReady();
+    communicator->waitForShutdown();
+}
+
+DEFINE_TEST(Server)
@@ -0,0 +1,30 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "TestI.h"
+#include "Ice/Ice.h"
+
+using namespace std;
+
+Test::ByteSeq
+TestI::echo(Test::ByteSeq seq, const Ice::Current&)
+{
+    return seq;
+}
+
+void
+TestI::sink(Test::ByteSeq seq, const Ice::Current&)
+{
+    _received += static_cast<int>(seq.size());
+}
+
+int
+TestI::getReceived(const Ice::Current&)
+{
+    return _received;
+}
+
+void
+TestI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
@@ -0,0 +1,22 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include "Test.h"
+
+#include <atomic>
+
+class TestI final : public Test::TestIntf
+{
+public:
+    Test::ByteSeq echo(Test::ByteSeq, const Ice::Current&) final;
+    void sink(Test::ByteSeq, const Ice::Current&) final;
+    int getReceived(const Ice::Current&) final;
+    void shutdown(const Ice::Current&) final;
+
+private:
+    std::atomic<int> _received{0};
+};
+
+#endif
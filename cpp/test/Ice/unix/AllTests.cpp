@@ -0,0 +1,116 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "Ice/Ice.h"
+#include "Test.h"
+#include "TestHelper.h"
+
+#include <unistd.h>
+
+using namespace std;
+using namespace Test;
+
+void
+allTests(TestHelper* helper)
+{
+    Ice::CommunicatorPtr communicator = helper->communicator();
+    // The socket file is named after the test port, like the server computes it.
+    const string path = "/tmp/ice-test-unix-" + to_string(helper->getTestPort(0)) + ".sock";
+
+    cout << "testing Unix endpoint parsing... " << flush;
+    {
+        Ice::ObjectPrx prx(communicator, "test:unix -p /run/app.sock");
+        test(prx->ice_toString() == "test -t -e 1.1:unix -p /run/app.sock -t 60000");
+        test(Ice::ObjectPrx(communicator, prx->ice_toString()) == prx);
+
+        auto info = dynamic_pointer_cast<Ice::UnixEndpointInfo>(prx->ice_getEndpoints()[0]->getInfo());
+        test(info);
+        test(info->path == "/run/app.sock");
+        test(info->type() == Ice::UnixEndpointType);
+        test(!info->datagram() && !info->secure());
+
+        // Paths with spaces or colons are quoted.
+        prx = Ice::ObjectPrx(communicator, "test:unix -p \"/run/my app:1.sock\" -t infinite -z");
+        test(prx->ice_toString() == "test -t -e 1.1:unix -p \"/run/my app:1.sock\" -t infinite -z");
+        test(Ice::ObjectPrx(communicator, prx->ice_toString()) == prx);
+
+        try
+        {
+            Ice::ObjectPrx(communicator, "test:unix");
+            test(false);
+        }
+        catch (const Ice::ParseException&)
+        {
+        }
+
+        try
+        {
+            Ice::ObjectPrx(communicator, "test:unix -p /" + string(200, 'a'));
+            test(false);
+        }
+        catch (const Ice::ParseException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing Unix endpoint marshaling... " << flush;
+    {
+        optional<Ice::ObjectPrx> prx =
+            Ice::ObjectPrx(communicator, "test:unix -p /run/app.sock -z:tcp -h 127.0.0.1 -p 10000");
+        Ice::OutputStream out(communicator);
+        out.write(prx);
+        Ice::ByteSeq data;
+        out.finished(data);
+        Ice::InputStream in(communicator, data);
+        optional<Ice::ObjectPrx> prx2;
+        in.read(prx2);
+        test(prx2 == prx);
+    }
+    cout << "ok" << endl;
+
+    TestIntfPrx testIntf(communicator, "test:unix -p " + path);
+
+    cout << "testing invocation... " << flush;
+    {
+        testIntf->ice_ping();
+        test(testIntf->getPid() != static_cast<int>(::getpid()));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing connection information... " << flush;
+    {
+        auto info = dynamic_pointer_cast<Ice::UnixConnectionInfo>(testIntf->ice_getConnection()->getInfo());
+        test(info);
+        test(!info->incoming);
+        test(info->path == path);
+        test(info->peerUid == static_cast<int>(::getuid()));
+        test(info->peerGid == static_cast<int>(::getgid()));
+#if defined(__linux__)
+        test(info->peerPid == testIntf->getPid());
+#endif
+        test(info->rcvSize > 0 && info->sndSize > 0);
+
+        test(testIntf->getPeerUid() == static_cast<int>(::getuid()));
+#if defined(__linux__)
+        test(testIntf->getPeerPid() == static_cast<int>(::getpid()));
+#endif
+
+        test(testIntf->ice_getConnection()->toString().find(path) != string::npos);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing connection refused... " << flush;
+    {
+        try
+        {
+            TestIntfPrx(communicator, "test:unix -p " + path + ".missing")->ice_ping();
+            test(false);
+        }
+        catch (const Ice::ConnectionRefusedException&)
+        {
+        }
+    }
+    cout << "ok" << endl;
+
+    testIntf->shutdown();
+}
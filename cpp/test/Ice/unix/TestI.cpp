@@ -0,0 +1,43 @@
+// Copyright (c) ZeroC, Inc.
+
+#include "TestI.h"
+#include "Ice/Ice.h"
+#include "TestHelper.h"
+
+#include <unistd.h>
+
+using namespace std;
+
+namespace
+{
+    Ice::UnixConnectionInfoPtr getUnixConnectionInfo(const Ice::Current& current)
+    {
+        auto info = dynamic_pointer_cast<Ice::UnixConnectionInfo>(current.con->getInfo());
+        test(info && info->incoming);
+        return info;
+    }
+}
+
+int
+TestI::getPid(const Ice::Current&)
+{
+    return static_cast<int>(::getpid());
+}
+
+int
+TestI::getPeerPid(const Ice::Current& current)
+{
+    return getUnixConnectionInfo(current)->peerPid;
+}
+
+int
+TestI::getPeerUid(const Ice::Current& current)
+{
+    return getUnixConnectionInfo(current)->peerUid;
+}
+
+void
+TestI::shutdown(const Ice::Current& current)
+{
+    current.adapter->getCommunicator()->shutdown();
+}
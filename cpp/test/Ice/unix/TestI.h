@@ -0,0 +1,17 @@
+// Copyright (c) ZeroC, Inc.
+
+#ifndef TEST_I_H
+#define TEST_I_H
+
+#include "Test.h"
+
+class TestI final : public Test::TestIntf
+{
+public:
+    int getPid(const Ice::Current&) final;
+    int getPeerPid(const Ice::Current&) final;
+    int getPeerUid(const Ice::Current&) final;
+    void shutdown(const Ice::Current&) final;
+};
+
+#endif
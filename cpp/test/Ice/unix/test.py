@@ -0,0 +1,7 @@
+# Copyright (c) ZeroC, Inc.
+
+from Util import TestSuite, Windows, platform
+
+# The test only uses Unix endpoints, which are not available on Windows.
+if not isinstance(platform, Windows):
+    TestSuite(__file__, options={"protocol": ["tcp"]})
@@ -132,18 +132,10 @@ private:
 };
 using DestroyTaskPtr = std::shared_ptr<DestroyTask>;
 
-class Client : public Test::TestHelper
-{
-public:
-    void run(int argc, char* argv[]) override;
-};
-
-void
-Client::run(int, char*[])
+namespace
 {
-    cout << "testing timer... " << flush;
+    void testTimer(const IceInternal::TimerPtr& timer)
     {
-        auto timer = make_shared<IceInternal::Timer>();
         {
             TestTaskPtr task = make_shared<TestTask>();
             timer->schedule(task, chrono::seconds::zero());
@@ -223,6 +215,124 @@ Client::run(int, char*[])
 
         timer->destroy();
     }
+
+    // Schedules and cancels tasks over a few seconds with a fine tick, the tasks cascade through the upper wheels.
+    void testTimingWheel()
+    {
+        auto timer = make_shared<IceInternal::Timer>(chrono::microseconds(100));
+        vector<TestTaskPtr> tasks;
+        vector<chrono::steady_clock::time_point> times;
+        for (int i = 0; i < 400; ++i)
+        {
+            auto delay = chrono::milliseconds(IceInternal::random(2000));
+            tasks.push_back(make_shared<TestTask>(delay));
+            times.push_back(chrono::steady_clock::now() + delay);
+            timer->schedule(tasks.back(), delay);
+        }
+
+        // Tasks with a small delay might run before they are cancelled.
+        vector<bool> cancelled(tasks.size(), false);
+        for (size_t i = 0; i < tasks.size(); i += 2)
+        {
+            cancelled[i] = timer->cancel(tasks[i]);
+            test(!timer->isScheduled(tasks[i]));
+        }
+
+        for (size_t i = 1; i < tasks.size(); i += 2)
+        {
+            tasks[i]->waitForRun();
+            test(tasks[i]->getRunTime() >= times[i]);
+        }
+        this_thread::sleep_for(chrono::milliseconds(100));
+
+        for (size_t i = 0; i < tasks.size(); i += 2)
+        {
+            test(!cancelled[i] || !tasks[i]->hasRun());
+        }
+
+        // Rescheduling a repeated task turns it into a one-time task.
+        TestTaskPtr task = make_shared<TestTask>();
+        timer->scheduleRepeated(task, chrono::milliseconds(10));
+        timer->reschedule(task, chrono::milliseconds(20));
+        task->waitForRun();
+        this_thread::sleep_for(chrono::milliseconds(50));
+        test(task->getCount() == 1);
+        test(!timer->cancel(task));
+
+        timer->destroy();
+    }
+
+    // Measures the cost of scheduling and cancelling tasks, which is what connections do for their inactivity and
+    // idle check timers. The tasks are never run, their delays are spread over a minute.
+    void benchmark(const IceInternal::TimerPtr& timer, size_t count)
+    {
+        vector<TimerTaskPtr> tasks;
+        vector<chrono::milliseconds> delays;
+        tasks.reserve(count);
+        delays.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            tasks.push_back(make_shared<TestTask>());
+            delays.emplace_back(1000 + IceInternal::random(60000));
+        }
+
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i)
+        {
+            timer->schedule(tasks[i], delays[i]);
+        }
+        auto scheduled = chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i)
+        {
+            timer->reschedule(tasks[i], delays[count - i - 1]);
+        }
+        auto rescheduled = chrono::steady_clock::now();
+        for (size_t i = 0; i < count; ++i)
+        {
+            timer->cancel(tasks[i]);
+        }
+        auto cancelled = chrono::steady_clock::now();
+
+        auto perTask = [count](chrono::steady_clock::duration d)
+        { return chrono::duration_cast<chrono::nanoseconds>(d).count() / static_cast<int64_t>(count); };
+        cout << "  " << count << " tasks: schedule " << perTask(scheduled - start) << "ns, reschedule "
+             << perTask(rescheduled - scheduled) << "ns, cancel " << perTask(cancelled - rescheduled) << "ns" << endl;
+    }
+}
+
+class Client : public Test::TestHelper
+{
+public:
+    void run(int argc, char* argv[]) override;
+};
+
+void
+Client::run(int argc, char* argv[])
+{
+    if (argc > 1 && string(argv[1]) == "--benchmark")
+    {
+        for (size_t count : {size_t{1000}, size_t{10000}, size_t{100000}, size_t{1000000}})
+        {
+            cout << "ordered set timer:" << endl;
+            auto timer = make_shared<IceInternal::Timer>();
+            benchmark(timer, count);
+            timer->destroy();
+
+            cout << "timing wheel timer:" << endl;
+            timer = make_shared<IceInternal::Timer>(chrono::milliseconds(1));
+            benchmark(timer, count);
+            timer->destroy();
+        }
+        return;
+    }
+
+    cout << "testing timer... " << flush;
+    testTimer(make_shared<IceInternal::Timer>());
+    cout << "ok" << endl;
+
+    cout << "testing timing wheel timer... " << flush;
+    testTimer(make_shared<IceInternal::Timer>(chrono::milliseconds(1)));
+    testTimingWheel();
     cout << "ok" << endl;
 
     cout << "testing timer destroy... " << flush;
@@ -5,6 +5,8 @@
 % EndpointSelectionType Properties:
 %   Random - Random causes the endpoints to be arranged in a random order.
 %   Ordered - Ordered forces the Ice run time to use the endpoints in the order they appeared in the proxy.
+%   Latency - Latency causes the endpoints to be arranged from the fastest to the slowest, based on the latency of the
+%     previous connection establishments and invocations.
 
 % Copyright (c) ZeroC, Inc.
 
@@ -14,6 +16,9 @@ classdef EndpointSelectionType < uint8
         Random (0)
         % Ordered forces the Ice run time to use the endpoints in the order they appeared in the proxy.
         Ordered (1)
+        % Latency causes the endpoints to be arranged from the fastest to the slowest, based on the latency of the
+        % previous connection establishments and invocations.
+        Latency (2)
     end
     methods(Static)
         function r = ice_getValue(v)
@@ -22,6 +27,8 @@ classdef EndpointSelectionType < uint8
                     r = Ice.EndpointSelectionType.Random;
                 case 1
                     r = Ice.EndpointSelectionType.Ordered;
+                case 2
+                    r = Ice.EndpointSelectionType.Latency;
                 otherwise
                     throw(Ice.MarshalException(sprintf('enumerator value %d is out of range', v)));
             end
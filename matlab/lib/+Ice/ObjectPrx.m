@@ -54,7 +54,7 @@ classdef ObjectPrx < IceInternal.WrapperObject
     %   ice_connectionCached - Returns a proxy that is identical to this
     %     proxy, except for connection caching.
     %   ice_getEndpointSelection - Returns how this proxy selects
-    %     endpoints (randomly or ordered).
+    %     endpoints (randomly, ordered or by latency).
     %   ice_endpointSelection - Returns a proxy that is identical to
     %     this proxy, except for the endpoint selection policy.
     %   ice_getEncodingVersion - Returns the encoding version used to
@@ -528,7 +528,7 @@ classdef ObjectPrx < IceInternal.WrapperObject
 
         function r = ice_getEndpointSelection(obj)
             % ice_getEndpointSelection - Returns how this proxy selects
-            %   endpoints (randomly or ordered).
+            %   endpoints (randomly, ordered or by latency).
             %
             % Returns (Ice.EndpointSelectionType) - The endpoint selection
             %   policy.
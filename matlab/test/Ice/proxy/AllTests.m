@@ -297,6 +297,12 @@ classdef AllTests
             prop.setProperty(property, 'Ordered');
             b1 = communicator.propertyToProxy(propertyPrefix);
             assert(b1.ice_getEndpointSelection() == Ice.EndpointSelectionType.Ordered);
+            prop.setProperty(property, 'Latency');
+            b1 = communicator.propertyToProxy(propertyPrefix);
+            assert(b1.ice_getEndpointSelection() == Ice.EndpointSelectionType.Latency);
+            b1 = b1.ice_endpointSelection(Ice.EndpointSelectionType.Ordered);
+            b1 = b1.ice_endpointSelection(Ice.EndpointSelectionType.Latency);
+            assert(b1.ice_getEndpointSelection() == Ice.EndpointSelectionType.Latency);
             prop.setProperty(property, '');
 
             fprintf('ok\n');
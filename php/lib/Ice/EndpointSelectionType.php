@@ -7,6 +7,7 @@ class EndpointSelectionType
 {
     const Random = 0;
     const Ordered = 1;
+    const Latency = 2;
 }
 
 ?>
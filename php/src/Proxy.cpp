@@ -543,7 +543,7 @@ ZEND_METHOD(Ice_ObjectPrx, ice_getEndpointSelection)
     try
     {
         Ice::EndpointSelectionType type = _this->proxy->ice_getEndpointSelection();
-        ZVAL_LONG(return_value, type == Ice::EndpointSelectionType::Random ? 0 : 1);
+        ZVAL_LONG(return_value, static_cast<zend_long>(type));
     }
     catch (...)
     {
@@ -567,15 +567,15 @@ ZEND_METHOD(Ice_ObjectPrx, ice_endpointSelection)
         RETURN_NULL();
     }
 
-    if (l < 0 || l > 1)
+    if (l < 0 || l > 2)
     {
-        runtimeError("expecting Random or Ordered");
+        runtimeError("expecting Random, Ordered or Latency");
         RETURN_NULL();
     }
 
     try
     {
-        auto type = l == 0 ? Ice::EndpointSelectionType::Random : Ice::EndpointSelectionType::Ordered;
+        auto type = static_cast<Ice::EndpointSelectionType>(l);
         if (!_this->clone(return_value, _this->proxy->ice_endpointSelection(type)))
         {
             RETURN_NULL();
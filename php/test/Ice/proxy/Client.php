@@ -271,6 +271,12 @@ function allTests($helper)
     $communicator->getProperties()->setProperty($property, "Ordered");
     $b1 = $communicator->propertyToProxy($propertyPrefix);
     test($b1->ice_getEndpointSelection() == Ice\EndpointSelectionType::Ordered);
+    $communicator->getProperties()->setProperty($property, "Latency");
+    $b1 = $communicator->propertyToProxy($propertyPrefix);
+    test($b1->ice_getEndpointSelection() == Ice\EndpointSelectionType::Latency);
+    test($b1->ice_endpointSelection(Ice\EndpointSelectionType::Ordered)->
+         ice_endpointSelection(Ice\EndpointSelectionType::Latency)->ice_getEndpointSelection() ==
+         Ice\EndpointSelectionType::Latency);
     $communicator->getProperties()->setProperty($property, "");
 
     //$property = $propertyPrefix . ".CollocationOptimized";
@@ -772,8 +772,10 @@ proxyIceGetEndpointSelection(ProxyObject* self, PyObject* /*args*/)
 
     PyObjectHandle rnd{getAttr(cls, "Random", false)};
     PyObjectHandle ord{getAttr(cls, "Ordered", false)};
+    PyObjectHandle lat{getAttr(cls, "Latency", false)};
     assert(rnd.get());
     assert(ord.get());
+    assert(lat.get());
 
     assert(self->proxy);
 
@@ -785,10 +787,14 @@ proxyIceGetEndpointSelection(ProxyObject* self, PyObject* /*args*/)
         {
             type = rnd.get();
         }
-        else
+        else if (val == Ice::EndpointSelectionType::Ordered)
         {
             type = ord.get();
         }
+        else
+        {
+            type = lat.get();
+        }
     }
     catch (...)
     {
@@ -814,8 +820,10 @@ proxyIceEndpointSelection(ProxyObject* self, PyObject* args)
     Ice::EndpointSelectionType val;
     PyObjectHandle rnd{getAttr(cls, "Random", false)};
     PyObjectHandle ord{getAttr(cls, "Ordered", false)};
+    PyObjectHandle lat{getAttr(cls, "Latency", false)};
     assert(rnd.get());
     assert(ord.get());
+    assert(lat.get());
     if (rnd.get() == type)
     {
         val = Ice::EndpointSelectionType::Random;
@@ -824,9 +832,13 @@ proxyIceEndpointSelection(ProxyObject* self, PyObject* args)
     {
         val = Ice::EndpointSelectionType::Ordered;
     }
+    else if (lat.get() == type)
+    {
+        val = Ice::EndpointSelectionType::Latency;
+    }
     else
     {
-        PyErr_Format(PyExc_ValueError, "ice_endpointSelection requires Random or Ordered");
+        PyErr_Format(PyExc_ValueError, "ice_endpointSelection requires Random, Ordered or Latency");
         return nullptr;
     }
 
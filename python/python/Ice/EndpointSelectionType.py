@@ -12,6 +12,9 @@ class EndpointSelectionType(EnumBase):
         Random causes the endpoints to be arranged in a random order.
     Ordered : EndpointSelectionType
         Ordered forces the Ice runtime to use the endpoints in the order they appeared in the proxy.
+    Latency : EndpointSelectionType
+        Latency causes the endpoints to be arranged from the fastest to the slowest, based on the latency of the
+        previous connection establishments and invocations.
     """
 
     def __init__(self, _n, _v):
@@ -37,7 +40,9 @@ class EndpointSelectionType(EnumBase):
 
 EndpointSelectionType.Random = EndpointSelectionType("Random", 0)
 EndpointSelectionType.Ordered = EndpointSelectionType("Ordered", 1)
+EndpointSelectionType.Latency = EndpointSelectionType("Latency", 2)
 EndpointSelectionType._enumerators = {
     0: EndpointSelectionType.Random,
     1: EndpointSelectionType.Ordered,
+    2: EndpointSelectionType.Latency,
 }
@@ -312,7 +312,7 @@ class ObjectPrx(IcePy.ObjectPrx):
 
     def ice_getEndpointSelection(self):
         """
-        Returns how this proxy selects endpoints (randomly or ordered).
+        Returns how this proxy selects endpoints (randomly, ordered or by latency).
 
         Returns
         -------
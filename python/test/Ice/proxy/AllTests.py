@@ -379,6 +379,12 @@ def allTests(helper, communicator, collocated):
     prop.setProperty(property, "Ordered")
     b1 = communicator.propertyToProxy(propertyPrefix)
     test(b1.ice_getEndpointSelection() == Ice.EndpointSelectionType.Ordered)
+    prop.setProperty(property, "Latency")
+    b1 = communicator.propertyToProxy(propertyPrefix)
+    test(b1.ice_getEndpointSelection() == Ice.EndpointSelectionType.Latency)
+    test(
+        b1.ice_endpointSelection(Ice.EndpointSelectionType.Ordered).ice_endpointSelection(
+            Ice.EndpointSelectionType.Latency).ice_getEndpointSelection() == Ice.EndpointSelectionType.Latency)
     prop.setProperty(property, "")
     property = propertyPrefix + ".CollocationOptimized"
     test(b1.ice_isCollocationOptimized())
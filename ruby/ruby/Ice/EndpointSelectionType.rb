@@ -37,8 +37,9 @@ module Ice
 
         Random = EndpointSelectionType.new("Random", 0)
         Ordered = EndpointSelectionType.new("Ordered", 1)
+        Latency = EndpointSelectionType.new("Latency", 2)
 
-        @@_enumerators = {0=>Random, 1=>Ordered}
+        @@_enumerators = {0=>Random, 1=>Ordered, 2=>Latency}
 
         def self._enumerators
             @@_enumerators
@@ -271,6 +271,11 @@ def allTests(helper, communicator)
     prop.setProperty(property, "Ordered")
     b1 = communicator.propertyToProxy(propertyPrefix)
     test(b1.ice_getEndpointSelection() == Ice::EndpointSelectionType::Ordered)
+    prop.setProperty(property, "Latency")
+    b1 = communicator.propertyToProxy(propertyPrefix)
+    test(b1.ice_getEndpointSelection() == Ice::EndpointSelectionType::Latency)
+    test(b1.ice_endpointSelection(Ice::EndpointSelectionType::Ordered).ice_endpointSelection(
+        Ice::EndpointSelectionType::Latency).ice_getEndpointSelection() == Ice::EndpointSelectionType::Latency)
     prop.setProperty(property, "")
 
     #
@@ -1,12 +1,42 @@
 # Copyright (c) ZeroC, Inc.
 
 # Enable some tracing to allow investigating test failures
-from Util import ClientServerTestCase, CollocatedTestCase, Mapping, TestSuite
+from Util import ClientServerTestCase, CollocatedTestCase, CppMapping, Linux, Mapping, TestSuite, platform
 
 
 traceProps = {"Ice.Trace.Network": 2, "Ice.Trace.Retry": 1, "Ice.Trace.Protocol": 1}
 
 testcases = [ClientServerTestCase(traceProps=traceProps)]
+if isinstance(Mapping.getByPath(__name__), CppMapping):
+    testcases += [
+        ClientServerTestCase(
+            "client/server with reactors and SO_REUSEPORT acceptors",
+            props={
+                "Ice.ThreadPool.Client.Reactors": 2,
+                "Ice.ThreadPool.Server.Reactors": 3,
+                "TestAdapter.Acceptors": 3,
+            },
+            traceProps=traceProps,
+        )
+    ]
+    # A small read-ahead buffer with an odd size splits the headers and bodies of the messages across the buffer
+    # boundary. Zero-copy sends are only used on Linux, other platforms ignore the threshold.
+    testcases += [
+        ClientServerTestCase(
+            "client/server with read-ahead", props={"Ice.TCP.ReadAheadSize": 31}, traceProps=traceProps
+        ),
+        ClientServerTestCase(
+            "client/server with zero-copy sends", props={"Ice.TCP.ZeroCopyThreshold": 1024}, traceProps=traceProps
+        ),
+    ]
+    if isinstance(platform, Linux):
+        testcases += [
+            ClientServerTestCase(
+                "client/server with io_uring",
+                props={"Ice.ThreadPool.Client.IoUring": 1, "Ice.ThreadPool.Server.IoUring": 1},
+                traceProps=traceProps,
+            )
+        ]
 if Mapping.getByPath(__name__).hasSource("Ice/ami", "collocated"):
     testcases += [CollocatedTestCase()]
 
@@ -1,10 +1,18 @@
 # Copyright (c) ZeroC, Inc.
 
-from Util import ClientServerTestCase, TestSuite
+from Util import ClientServerTestCase, CppMapping, Linux, Mapping, TestSuite, platform
 
 # Enable some tracing to allow investigating test failures
 traceProps = {"Ice.Trace.Network": 2, "Ice.Trace.Protocol": 1}
 
 testcases = [ClientServerTestCase(traceProps=traceProps)]
+if isinstance(Mapping.getByPath(__name__), CppMapping) and isinstance(platform, Linux):
+    testcases += [
+        ClientServerTestCase(
+            "client/server with io_uring",
+            props={"Ice.ThreadPool.Client.IoUring": 1, "Ice.ThreadPool.Server.IoUring": 1},
+            traceProps=traceProps,
+        )
+    ]
 
 TestSuite(__name__, testcases, libDirs=["testtransport"], options={"mx": [False]})
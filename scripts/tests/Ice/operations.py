@@ -1,13 +1,54 @@
 # Copyright (c) ZeroC, Inc.
 
-# Enable some tracing to allow investigating test failures
-from Util import ClientServerTestCase, CollocatedTestCase, Mapping, TestSuite
+import shutil
+import subprocess
 
+from Util import ClientServerTestCase, CollocatedTestCase, CppMapping, Linux, Mapping, TestSuite, platform
 
+# Enable some tracing to allow investigating test failures
 traceProps = {"Ice.Trace.Retry": 1, "Ice.Trace.Protocol": 1}
 
+
+class CodecTestCase(ClientServerTestCase):
+    def __init__(self, codec):
+        ClientServerTestCase.__init__(
+            self,
+            f"client/server with {codec} compression",
+            props={"Ice.Override.Compress": 1, "Ice.Compression.Codec": codec, "Ice.Compression.Threshold": 0},
+            traceProps=traceProps,
+        )
+        self.library = "liblz4" if codec == "lz4" else "libzstd"
+
+    def canRun(self, current):
+        # The LZ4 and Zstd codecs are only built on Linux, when pkg-config finds their library (see
+        # cpp/src/Ice/Makefile.mk). Without the codec, the messages would silently be compressed with bzip2.
+        if (
+            isinstance(platform, Linux)
+            and shutil.which("pkg-config")
+            and subprocess.call(["pkg-config", "--exists", self.library]) == 0
+        ):
+            return True
+        current.write(f"{self.library} is not available, ")
+        return False
+
+
 testcases = [ClientServerTestCase(traceProps=traceProps)]
 
+if isinstance(Mapping.getByPath(__name__), CppMapping):
+    # Compress all the messages, including the small ones, with each codec. The test cases of the codecs which aren't
+    # supported by the build are skipped.
+    testcases += [CodecTestCase(codec) for codec in ["lz4", "zstd", "zstd-stream"]]
+    # A small read-ahead buffer with an odd size splits the headers and bodies of the messages across the buffer
+    # boundary. Zero-copy sends are only used on Linux, other platforms ignore the threshold.
+    testcases += [
+        ClientServerTestCase(
+            "client/server with read-ahead", props={"Ice.TCP.ReadAheadSize": 31}, traceProps=traceProps
+        ),
+        ClientServerTestCase(
+            "client/server with zero-copy sends", props={"Ice.TCP.ZeroCopyThreshold": 1024}, traceProps=traceProps
+        ),
+    ]
+
 if Mapping.getByPath(__name__).hasSource("Ice/operations", "collocated"):
     testcases += [CollocatedTestCase(traceProps=traceProps)]
 
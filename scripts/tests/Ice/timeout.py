@@ -1,13 +1,20 @@
 # Copyright (c) ZeroC, Inc.
 
 # Enable some tracing to allow investigating test failures
-from Util import ClientServerTestCase, Server, TestSuite
+from Util import ClientServerTestCase, CppMapping, Linux, Mapping, Server, TestSuite, platform
 
 
 traceProps = {"Ice.Trace.Network": 2, "Ice.Trace.Retry": 1, "Ice.Trace.Protocol": 1}
 
-TestSuite(
-    __name__,
-    [ClientServerTestCase(server=Server(readyCount=2), traceProps=traceProps)],
-    options={"compress": [False]},
-)
+testcases = [ClientServerTestCase(server=Server(readyCount=2), traceProps=traceProps)]
+if isinstance(Mapping.getByPath(__name__), CppMapping) and isinstance(platform, Linux):
+    testcases += [
+        ClientServerTestCase(
+            "client/server with io_uring",
+            server=Server(readyCount=2),
+            props={"Ice.ThreadPool.Client.IoUring": 1, "Ice.ThreadPool.Server.IoUring": 1},
+            traceProps=traceProps,
+        )
+    ]
+
+TestSuite(__name__, testcases, options={"compress": [False]})
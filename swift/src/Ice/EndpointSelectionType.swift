@@ -8,6 +8,9 @@ public enum EndpointSelectionType: UInt8 {
     case Random = 0
     /// Ordered Ordered forces the Ice run time to use the endpoints in the order they appeared in the proxy.
     case Ordered = 1
+    /// Latency Latency causes the endpoints to be arranged from the fastest to the slowest, based on the latency of
+    /// the previous connection establishments and invocations.
+    case Latency = 2
     public init() {
         self = .Random
     }
@@ -19,7 +22,7 @@ extension InputStream {
     ///
     /// - returns: `EndpointSelectionType` - The enumarated value.
     public func read() throws -> EndpointSelectionType {
-        let rawValue: UInt8 = try read(enumMaxValue: 1)
+        let rawValue: UInt8 = try read(enumMaxValue: 2)
         guard let val = EndpointSelectionType(rawValue: rawValue) else {
             throw MarshalException("invalid enum value")
         }
@@ -45,7 +48,7 @@ extension OutputStream {
     ///
     /// parameter _: `EndpointSelectionType` - The enumerator to write.
     public func write(_ v: EndpointSelectionType) {
-        write(enum: v.rawValue, maxValue: 1)
+        write(enum: v.rawValue, maxValue: 2)
     }
 
     /// Writes an optional enumerated value to the stream.
@@ -57,6 +60,6 @@ extension OutputStream {
         guard let v = value else {
             return
         }
-        write(tag: tag, val: v.rawValue, maxValue: 1)
+        write(tag: tag, val: v.rawValue, maxValue: 2)
     }
 }
@@ -121,7 +121,7 @@ public protocol ObjectPrx: CustomStringConvertible, AnyObject {
     /// - returns: The new proxy with the specified caching policy.
     func ice_connectionCached(_ cached: Bool) -> Self
 
-    /// Returns how this proxy selects endpoints (randomly or ordered).
+    /// Returns how this proxy selects endpoints (randomly, ordered or by latency).
     ///
     /// - returns: `Ice.EndpointSelectionType` - The endpoint selection policy.
     func ice_getEndpointSelection() -> EndpointSelectionType
@@ -436,6 +436,12 @@ public func allTests(_ helper: TestHelper) async throws -> MyClassPrx {
     prop.setProperty(key: property, value: "Ordered")
     b1 = try communicator.propertyToProxy(propertyPrefix)!
     try test(b1.ice_getEndpointSelection() == Ice.EndpointSelectionType.Ordered)
+    prop.setProperty(key: property, value: "Latency")
+    b1 = try communicator.propertyToProxy(propertyPrefix)!
+    try test(b1.ice_getEndpointSelection() == Ice.EndpointSelectionType.Latency)
+    try test(
+        b1.ice_endpointSelection(.Ordered).ice_endpointSelection(.Latency).ice_getEndpointSelection()
+            == .Latency)
     prop.setProperty(key: property, value: "")
 
     property = "\(propertyPrefix).CollocationOptimized"